@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// 성능 측정/검증 모음 - 앱에는 링크되지 않는 콘솔 프로그램(Benchmarks.exe)에서만 실행
+// 각 항목은 결과를 표준 출력에 쓰고, 결과가 다르거나 실패하면 false를 반환
+class Benchmarks
+{
+public:
+    // OBJ 파싱 - 합성 OBJ를 임시 파일로 만들어 이전 getline/istringstream 파서와 비교하고
+    // 스레드 1/2/4/8/16개의 병렬 파싱 결과가 단일 스레드와 같은지 확인
+    static bool ObjParsing(size_t faceCount);
+
+    // GLB 접근자 디코딩 - 파일마다 정점/인덱스 디코딩을 이전 스칼라 루프와 GltfAccessor로
+    // repeatCount번씩 측정하고 두 결과가 같은지 확인
+    static bool AccessorDecoding(const std::vector<std::string>& files, size_t repeatCount);
+
+    // GLB 로딩 - 파일마다 GlbFile(매핑, BIN 제자리 참조)과 tinygltf LoadBinaryFromFile(파일과 BIN 복사)로
+    // 읽는 시간과 작업 집합/최대 작업 집합 증가량을 비교하고 두 결과가 같은지 확인
+    static bool GlbLoading(const std::vector<std::string>& files);
+
+    // 가져오기 파이프라인 - GLB를 디바이스 없이 읽기 ~ 업로드 단계까지 실행하고 기록 싱크로 항목 수와 순서,
+    // 프레임 예산(예산 0과 budgetMilliseconds, 항목당 itemMilliseconds로 흉내 낸 업로드 비용)을 확인
+    static bool CheckImportPipeline(const std::vector<std::string>& files, double budgetMilliseconds, double itemMilliseconds);
+
+    // asset\models에서 확장자가 같은 파일 목록 (작업 폴더, 실행 파일 폴더와 그 상위 폴더 순으로 찾음)
+    static std::vector<std::string> FindAssetModels(const std::string& extension);
+
+    // 보고서 출력 (표준 출력)
+    static void Report(const std::string& text);
+};
@@ -0,0 +1,341 @@
+#include "Benchmarks.h"
+#include "GltfLoader.h"
+#include "GltfAccessor.h"
+#include "GlbFile.h"
+#include <windows.h>
+#include <psapi.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+namespace {
+    // 이전 방식의 인덱스 디코딩 (요소마다 push_back) - 성능 비교용
+    void DecodeLegacyIndices(const tinygltf::Model& model, int accessorIndex, std::vector<uint32_t>& indices)
+    {
+        const auto& accessor = model.accessors[accessorIndex];
+        const auto& bufferView = model.bufferViews[accessor.bufferView];
+        const auto& buffer = model.buffers[bufferView.buffer];
+
+        const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
+        int indexCount = static_cast<int>(accessor.count);
+
+        if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
+            const uint16_t* source = reinterpret_cast<const uint16_t*>(data);
+            for (int k = 0; k < indexCount; k++) {
+                indices.push_back(source[k]);
+            }
+        }
+        else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
+            const uint32_t* source = reinterpret_cast<const uint32_t*>(data);
+            for (int k = 0; k < indexCount; k++) {
+                indices.push_back(source[k]);
+            }
+        }
+        else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
+            const uint8_t* source = reinterpret_cast<const uint8_t*>(data);
+            for (int k = 0; k < indexCount; k++) {
+                indices.push_back(source[k]);
+            }
+        }
+    }
+
+    // 이전 방식의 정점 속성 디코딩 (FLOAT만 지원, 요소마다 스트라이드 계산) - 성능 비교용
+    void DecodeLegacyAttribute(const tinygltf::Model& model, int accessorIndex, int components,
+        std::vector<GltfLoader::Vertex>& vertices, size_t memberOffset, bool flipY)
+    {
+        const auto& accessor = model.accessors[accessorIndex];
+        const auto& bufferView = model.bufferViews[accessor.bufferView];
+        const auto& buffer = model.buffers[bufferView.buffer];
+
+        const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
+        int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : static_cast<int>(sizeof(float)) * components;
+        size_t count = (std::min)(static_cast<size_t>(accessor.count), vertices.size());
+
+        for (size_t k = 0; k < count; k++) {
+            const float* source = reinterpret_cast<const float*>(data + k * stride);
+            float* destination = reinterpret_cast<float*>(reinterpret_cast<unsigned char*>(&vertices[k]) + memberOffset);
+            for (int c = 0; c < components; c++) {
+                destination[c] = source[c];
+            }
+            if (flipY) {
+                destination[1] = 1.0f - source[1]; // 텍스처 좌표 Y축 반전
+            }
+        }
+    }
+
+    // 이전 루프가 읽을 수 있는 접근자인지 (FLOAT/인덱스, 버퍼 뷰 있음, 희소 아님)
+    bool IsLegacyDecodable(const tinygltf::Model& model, int accessorIndex, bool isIndex)
+    {
+        if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size())) {
+            return false;
+        }
+        const auto& accessor = model.accessors[accessorIndex];
+        if (accessor.bufferView < 0 || accessor.sparse.isSparse) {
+            return false;
+        }
+        return isIndex || accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT;
+    }
+
+    // 디코딩 비교 대상 속성 (이전 경로가 처리하던 것만)
+    struct BenchmarkAttribute
+    {
+        const char* Name;
+        size_t MemberOffset;
+        int Components;
+    };
+
+    const BenchmarkAttribute benchmarkAttributes[] = {
+        { "POSITION", offsetof(GltfLoader::Vertex, Position), 3 },
+        { "NORMAL", offsetof(GltfLoader::Vertex, Normal), 3 },
+        { "TEXCOORD_0", offsetof(GltfLoader::Vertex, TexCoord), 2 },
+        { "TANGENT", offsetof(GltfLoader::Vertex, Tangent), 4 },
+    };
+}
+
+bool Benchmarks::AccessorDecoding(const std::vector<std::string>& files, size_t repeatCount)
+{
+    if (files.empty() || repeatCount == 0) {
+        Report("Accessor decoding benchmark: no GLB files\n");
+        return false;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto milliseconds = [](Clock::time_point start, Clock::time_point end) {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    std::string report = "Accessor decoding benchmark: " + std::to_string(files.size()) + " GLB files x " +
+        std::to_string(repeatCount) + " runs\n";
+    double totalLegacy = 0.0;
+    double totalAccessor = 0.0;
+    size_t mismatchedFiles = 0;
+    size_t failedFiles = 0;
+
+    for (const auto& filename : files) {
+        // 이전 루프는 buffers[].data를 읽으므로 BIN 청크를 복사하는 기존 로더로 파싱
+        tinygltf::TinyGLTF loader;
+        loader.SetImagesAsIs(true);
+        tinygltf::Model model;
+        std::string err;
+        std::string warn;
+        std::string name = filename.substr(filename.find_last_of("/\\") + 1);
+        if (!loader.LoadBinaryFromFile(&model, &err, &warn, filename)) {
+            report += "  " + name + ": load failed " + err + "\n";
+            failedFiles++;
+            continue;
+        }
+
+        // 두 경로가 모두 읽을 수 있는 프리미티브만 비교 (양자화/희소 접근자는 이전 루프가 지원하지 않음)
+        struct Job
+        {
+            int Indices = -1;
+            int Attributes[4] = { -1, -1, -1, -1 };
+            size_t VertexCount = 0;
+        };
+        std::vector<Job> jobs;
+        size_t skipped = 0;
+        for (const auto& mesh : model.meshes) {
+            for (const auto& primitive : mesh.primitives) {
+                Job job;
+                bool decodable = primitive.indices < 0 || IsLegacyDecodable(model, primitive.indices, true);
+                job.Indices = primitive.indices;
+                for (size_t a = 0; a < 4; a++) {
+                    auto it = primitive.attributes.find(benchmarkAttributes[a].Name);
+                    if (it == primitive.attributes.end()) {
+                        continue;
+                    }
+                    decodable = decodable && IsLegacyDecodable(model, it->second, false);
+                    job.Attributes[a] = it->second;
+                }
+                if (!decodable || job.Attributes[0] < 0) {
+                    skipped++;
+                    continue;
+                }
+                job.VertexCount = static_cast<size_t>(model.accessors[job.Attributes[0]].count);
+                jobs.push_back(job);
+            }
+        }
+
+        std::vector<std::vector<GltfLoader::Vertex>> legacyVertices(jobs.size());
+        std::vector<std::vector<uint32_t>> legacyIndices(jobs.size());
+        std::vector<std::vector<GltfLoader::Vertex>> accessorVertices(jobs.size());
+        std::vector<std::vector<uint32_t>> accessorIndices(jobs.size());
+
+        auto legacyStart = Clock::now();
+        for (size_t run = 0; run < repeatCount; run++) {
+            for (size_t j = 0; j < jobs.size(); j++) {
+                legacyIndices[j].clear();
+                legacyVertices[j].assign(jobs[j].VertexCount, GltfLoader::Vertex());
+                if (jobs[j].Indices >= 0) {
+                    DecodeLegacyIndices(model, jobs[j].Indices, legacyIndices[j]);
+                }
+                for (size_t a = 0; a < 4; a++) {
+                    if (jobs[j].Attributes[a] >= 0) {
+                        DecodeLegacyAttribute(model, jobs[j].Attributes[a], benchmarkAttributes[a].Components,
+                            legacyVertices[j], benchmarkAttributes[a].MemberOffset, a == 2);
+                    }
+                }
+            }
+        }
+
+        auto accessorStart = Clock::now();
+        for (size_t run = 0; run < repeatCount; run++) {
+            GltfAccessor accessors(model);
+            for (size_t j = 0; j < jobs.size(); j++) {
+                std::vector<GltfLoader::Vertex>& vertices = accessorVertices[j];
+                vertices.assign(jobs[j].VertexCount, GltfLoader::Vertex());
+                if (jobs[j].Indices >= 0) {
+                    accessors.ReadIndices(jobs[j].Indices, accessorIndices[j]);
+                }
+                for (size_t a = 0; a < 4; a++) {
+                    if (jobs[j].Attributes[a] >= 0) {
+                        unsigned char* destination = reinterpret_cast<unsigned char*>(vertices.data()) + benchmarkAttributes[a].MemberOffset;
+                        accessors.ReadFloats(jobs[j].Attributes[a], benchmarkAttributes[a].Components, destination,
+                            sizeof(GltfLoader::Vertex), vertices.size());
+                    }
+                }
+                if (jobs[j].Attributes[2] >= 0) {
+                    for (auto& vertex : vertices) {
+                        vertex.TexCoord.y = 1.0f - vertex.TexCoord.y;
+                    }
+                }
+            }
+        }
+        auto accessorEnd = Clock::now();
+
+        // 비교 - 두 경로 모두 같은 기본값에서 시작하므로 정점 전체를 바이트 단위로 비교
+        bool identical = true;
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        for (size_t j = 0; j < jobs.size() && identical; j++) {
+            identical = legacyIndices[j] == accessorIndices[j] &&
+                legacyVertices[j].size() == accessorVertices[j].size() &&
+                (legacyVertices[j].empty() || memcmp(legacyVertices[j].data(), accessorVertices[j].data(),
+                    legacyVertices[j].size() * sizeof(GltfLoader::Vertex)) == 0);
+            vertexCount += accessorVertices[j].size();
+            indexCount += accessorIndices[j].size();
+        }
+        if (!identical) {
+            mismatchedFiles++;
+        }
+
+        double legacyMs = milliseconds(legacyStart, accessorStart) / repeatCount;
+        double accessorMs = milliseconds(accessorStart, accessorEnd) / repeatCount;
+        totalLegacy += legacyMs;
+        totalAccessor += accessorMs;
+
+        char line[512];
+        snprintf(line, sizeof(line), "  %s: %zu primitives (%zu skipped), %zu vertices, %zu indices - scalar (old) %.3f ms, accessor %.3f ms (x%.2f), %s\n",
+            name.c_str(), jobs.size(), skipped, vertexCount, indexCount, legacyMs, accessorMs,
+            accessorMs > 0.0 ? legacyMs / accessorMs : 0.0, identical ? "identical" : "MISMATCH");
+        report += line;
+    }
+
+    char summary[256];
+    snprintf(summary, sizeof(summary), "  total: scalar (old) %.3f ms, accessor %.3f ms, %zu mismatched files, %zu failed\n",
+        totalLegacy, totalAccessor, mismatchedFiles, failedFiles);
+    report += summary;
+    Report(report);
+    return mismatchedFiles == 0 && failedFiles == 0;
+}
+
+bool Benchmarks::GlbLoading(const std::vector<std::string>& files)
+{
+    if (files.empty()) {
+        Report("GLB loading benchmark: no GLB files\n");
+        return false;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto milliseconds = [](Clock::time_point start, Clock::time_point end) {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    auto megabytes = [](size_t after, size_t before) {
+        return after > before ? static_cast<double>(after - before) / (1024.0 * 1024.0) : 0.0;
+    };
+
+    // 최대 작업 집합은 프로세스 전체의 최고 기록이라 줄어들지 않음 - 증가량이 작은 GlbFile을 먼저 측정해야
+    // 기존 경로의 최고 기록에 가려지지 않음 (기존 경로의 증가량은 GlbFile 최고 기록을 넘은 만큼만 보임)
+    std::string report = "GLB loading benchmark: " + std::to_string(files.size()) + " files\n";
+    double totalMapped = 0.0;
+    double totalLegacy = 0.0;
+    size_t mismatchedFiles = 0;
+    size_t failedFiles = 0;
+
+    for (const auto& filename : files) {
+        std::string name = filename.substr(filename.find_last_of("/\\") + 1);
+        PROCESS_MEMORY_COUNTERS before = {};
+        PROCESS_MEMORY_COUNTERS loaded = {};
+
+        // GlbFile - JSON 청크만 파싱하고 BIN 청크는 매핑된 메모리에서 읽음
+        tinygltf::TinyGLTF mappedLoader;
+        mappedLoader.SetImagesAsIs(true);
+        auto mappedModel = std::make_unique<tinygltf::Model>();
+        GlbFile glb;
+        std::string err;
+        std::string warn;
+        GetProcessMemoryInfo(GetCurrentProcess(), &before, sizeof(before));
+        auto mappedStart = Clock::now();
+        bool mappedLoaded = glb.Load(filename, mappedLoader, *mappedModel, err, warn);
+        auto mappedEnd = Clock::now();
+        GetProcessMemoryInfo(GetCurrentProcess(), &loaded, sizeof(loaded));
+        if (!mappedLoaded) {
+            report += "  " + name + ": GlbFile load failed " + err + "\n";
+            failedFiles++;
+            continue;
+        }
+        double mappedMs = milliseconds(mappedStart, mappedEnd);
+        double mappedWorkingSet = megabytes(loaded.WorkingSetSize, before.WorkingSetSize);
+        double mappedPeak = megabytes(loaded.PeakWorkingSetSize, before.PeakWorkingSetSize);
+
+        // 기존 경로 - 파일 전체를 힙에 읽고 BIN 청크를 buffers[].data로 다시 복사
+        tinygltf::TinyGLTF legacyLoader;
+        legacyLoader.SetImagesAsIs(true);
+        auto legacyModel = std::make_unique<tinygltf::Model>();
+        GetProcessMemoryInfo(GetCurrentProcess(), &before, sizeof(before));
+        auto legacyStart = Clock::now();
+        bool legacyLoaded = legacyLoader.LoadBinaryFromFile(legacyModel.get(), &err, &warn, filename);
+        auto legacyEnd = Clock::now();
+        GetProcessMemoryInfo(GetCurrentProcess(), &loaded, sizeof(loaded));
+        if (!legacyLoaded) {
+            report += "  " + name + ": LoadBinaryFromFile failed " + err + "\n";
+            failedFiles++;
+            continue;
+        }
+        double legacyMs = milliseconds(legacyStart, legacyEnd);
+        double legacyWorkingSet = megabytes(loaded.WorkingSetSize, before.WorkingSetSize);
+        double legacyPeak = megabytes(loaded.PeakWorkingSetSize, before.PeakWorkingSetSize);
+
+        // 확인 - 같은 접근자/이미지 수와 같은 BIN 내용
+        int binIndex = glb.GetBinBufferIndex();
+        bool identical = mappedModel->accessors.size() == legacyModel->accessors.size() &&
+            mappedModel->images.size() == legacyModel->images.size() &&
+            mappedModel->meshes.size() == legacyModel->meshes.size();
+        if (identical && binIndex >= 0) {
+            const std::vector<unsigned char>& legacyBin = legacyModel->buffers[binIndex].data;
+            identical = legacyBin.size() >= glb.GetBinSize() &&
+                memcmp(legacyBin.data(), glb.GetBinData(), glb.GetBinSize()) == 0;
+        }
+        if (!identical) {
+            mismatchedFiles++;
+        }
+        totalMapped += mappedMs;
+        totalLegacy += legacyMs;
+
+        char line[512];
+        snprintf(line, sizeof(line), "  %s (%zu KB, BIN %zu KB): GlbFile %.3f ms, working set +%.2f MB, peak +%.2f MB / "
+            "LoadBinaryFromFile %.3f ms, working set +%.2f MB, peak +%.2f MB, %s\n",
+            name.c_str(), glb.GetFileSize() / 1024, glb.GetBinSize() / 1024, mappedMs, mappedWorkingSet, mappedPeak,
+            legacyMs, legacyWorkingSet, legacyPeak, identical ? "identical" : "MISMATCH");
+        report += line;
+    }
+
+    char summary[256];
+    snprintf(summary, sizeof(summary), "  total: GlbFile %.3f ms, LoadBinaryFromFile %.3f ms, %zu mismatched files, %zu failed\n",
+        totalMapped, totalLegacy, mismatchedFiles, failedFiles);
+    report += summary;
+    Report(report);
+    return mismatchedFiles == 0 && failedFiles == 0;
+}
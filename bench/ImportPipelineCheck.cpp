@@ -0,0 +1,244 @@
+#include "Benchmarks.h"
+#include "GltfLoader.h"
+#include "ImportPipeline.h"
+#include "ImportProgress.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+namespace
+{
+    // GLB 가져오기를 ImportPipeline 단계로 나눠 실행하는 작업 - ModelManager의 가져오기 작업과 같은 단계를
+    // 메시/텍스처 캐시 없이 실행 (업로드는 기록 싱크가 받으므로 디바이스가 필요 없음)
+    class GlbCheckJob : public ImportPipeline::Job
+    {
+    public:
+        GlbCheckJob(const std::string& path, std::shared_ptr<GltfLoader> model, std::shared_ptr<ImportProgress> progress)
+            : path(path), model(std::move(model)), progress(std::move(progress))
+        {
+            this->model->SetImportProgress(this->progress);
+        }
+
+        ~GlbCheckJob() override
+        {
+            model->SetImportProgress(nullptr);
+        }
+
+        bool RunStage(ImportPipeline::Stage stage) override
+        {
+            switch (stage)
+            {
+            case ImportPipeline::Stage::Read:
+                return model->ReadImportStage(path, nullptr, nullptr);
+            case ImportPipeline::Stage::Parse:
+                return model->ParseImportStage();
+            case ImportPipeline::Stage::Process:
+                return model->ProcessImportStage();
+            case ImportPipeline::Stage::DecodeTextures:
+                GltfLoader::DecodeTextureImages({ model.get() }, nullptr);
+                return !progress->IsCancelled() && GltfLoader::CompileShaders();
+            default:
+                return true;
+            }
+        }
+
+        void CollectUploads(std::vector<ImportPipeline::UploadItem>& items) override
+        {
+            model->PrepareUploads(items);
+        }
+
+        bool Upload(ID3D11Device* device, const ImportPipeline::UploadItem& item) override
+        {
+            return model->UploadResource(device, item);
+        }
+
+        void Cancel() override
+        {
+            progress->Cancel();
+        }
+
+    private:
+        std::string path;
+        std::shared_ptr<GltfLoader> model;
+        std::shared_ptr<ImportProgress> progress;
+    };
+}
+
+bool Benchmarks::CheckImportPipeline(const std::vector<std::string>& files, double budgetMilliseconds, double itemMilliseconds)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto milliseconds = [](Clock::time_point start, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    if (files.empty())
+    {
+        Report("Import pipeline check: no GLB files\n");
+        return false;
+    }
+
+    // GLB 하나를 새 파이프라인에 넣고 업로드 대기열이 빌 때까지 프레임마다 PumpUploads 호출 (메시/텍스처 캐시는 사용하지 않음)
+    struct PipelineRun
+    {
+        ImportPipeline::Stage Stage = ImportPipeline::Stage::Queued;
+        size_t UploadCount = 0;
+        size_t UploadedCount = 0;
+        ImportPipeline::Stats Stats;
+        std::vector<size_t> PumpItems; // 항목을 올린 호출마다 올린 수
+        double CpuMilliseconds = 0.0;
+        double TotalMilliseconds = 0.0;
+    };
+
+    auto runImport = [&milliseconds](const std::string& path, double frameBudget, ImportPipeline::RecordingUploadSink& sink)
+    {
+        PipelineRun run;
+        auto start = Clock::now();
+        ImportPipeline pipeline;
+        auto entry = pipeline.Submit(std::make_shared<GlbCheckJob>(path, std::make_shared<GltfLoader>(),
+            std::make_shared<ImportProgress>(path)));
+
+        std::vector<std::shared_ptr<ImportPipeline::Entry>> finished;
+        while (finished.empty())
+        {
+            size_t uploaded = pipeline.PumpUploads(sink, frameBudget, finished);
+            if (uploaded > 0)
+            {
+                run.PumpItems.push_back(uploaded);
+            }
+            else if (finished.empty())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        run.TotalMilliseconds = milliseconds(start, Clock::now());
+        run.Stage = entry->GetStage();
+        run.UploadCount = entry->GetUploadCount();
+        run.UploadedCount = entry->GetUploadedCount();
+        run.Stats = pipeline.GetStats();
+        for (ImportPipeline::Stage stage : { ImportPipeline::Stage::Read, ImportPipeline::Stage::Parse,
+            ImportPipeline::Stage::Process, ImportPipeline::Stage::DecodeTextures })
+        {
+            run.CpuMilliseconds += entry->GetStageMilliseconds(stage);
+        }
+        return run;
+    };
+
+    static const char* kindNames[] = { "texture", "primitive", "finalize" };
+    itemMilliseconds = (std::max)(itemMilliseconds, 0.01);
+    budgetMilliseconds = (std::max)(budgetMilliseconds, itemMilliseconds);
+    size_t budgetLimit = static_cast<size_t>(budgetMilliseconds / itemMilliseconds) + 1;
+
+    std::string report = "Import pipeline check: Read -> Parse -> Process -> Decode -> Upload without a device, " +
+        std::to_string(itemMilliseconds) + " ms per simulated upload\n";
+    char line[512];
+    size_t failures = 0;
+
+    for (const auto& path : files)
+    {
+        std::string name = path.substr(path.find_last_of("/\\") + 1);
+
+        // 예산 0 - 호출마다 정확히 한 항목 / 현재 업로드 예산 - 호출마다 예산 / 항목 비용 + 1개 이하
+        ImportPipeline::RecordingUploadSink singleSink(itemMilliseconds);
+        ImportPipeline::RecordingUploadSink budgetSink(itemMilliseconds);
+        PipelineRun single = runImport(path, 0.0, singleSink);
+        PipelineRun budgeted = runImport(path, budgetMilliseconds, budgetSink);
+
+        std::vector<std::string> problems;
+        for (const PipelineRun* run : { &single, &budgeted })
+        {
+            const ImportPipeline::RecordingUploadSink& sink = run == &single ? singleSink : budgetSink;
+            if (run->Stage != ImportPipeline::Stage::Done)
+            {
+                problems.push_back(std::string("stage ") + ImportPipeline::GetStageName(run->Stage));
+            }
+            if (sink.GetItems().size() != run->UploadCount || run->UploadedCount != run->UploadCount ||
+                run->Stats.UploadedItems != run->UploadCount || run->Stats.UploadedBytes != sink.GetBytes())
+            {
+                problems.push_back("item count");
+            }
+        }
+
+        // 두 실행이 같은 항목을 같은 순서로 올렸는지
+        const auto& items = singleSink.GetItems();
+        const auto& budgetItems = budgetSink.GetItems();
+        bool sameItems = items.size() == budgetItems.size();
+        for (size_t i = 0; sameItems && i < items.size(); i++)
+        {
+            sameItems = items[i].Kind == budgetItems[i].Kind && items[i].Index == budgetItems[i].Index &&
+                items[i].SubIndex == budgetItems[i].SubIndex && items[i].Bytes == budgetItems[i].Bytes;
+        }
+        if (!sameItems)
+        {
+            problems.push_back("order differs between runs");
+        }
+
+        // 순서: 텍스처(이미지 순서) -> 프리미티브 -> 마지막에 마무리 하나
+        size_t textureCount = singleSink.GetItemCount(GltfLoader::UploadTexture);
+        bool ordered = !items.empty() && items.back().Kind == GltfLoader::UploadFinalize &&
+            singleSink.GetItemCount(GltfLoader::UploadFinalize) == 1;
+        for (size_t i = 0; ordered && i < items.size(); i++)
+        {
+            ordered = (i == 0 || items[i - 1].Kind <= items[i].Kind) &&
+                (items[i].Kind != GltfLoader::UploadTexture || items[i].Index == i);
+        }
+        if (!ordered)
+        {
+            problems.push_back("upload order");
+        }
+
+        // 프레임 예산
+        size_t maxSingle = single.PumpItems.empty() ? 0 : *std::max_element(single.PumpItems.begin(), single.PumpItems.end());
+        size_t maxBudgeted = budgeted.PumpItems.empty() ? 0 : *std::max_element(budgeted.PumpItems.begin(), budgeted.PumpItems.end());
+        if (maxSingle > 1 || single.PumpItems.size() != items.size())
+        {
+            problems.push_back("zero budget uploaded more than one item per frame");
+        }
+        if (maxBudgeted > budgetLimit)
+        {
+            problems.push_back("budget exceeded");
+        }
+
+        snprintf(line, sizeof(line), "  %s: cpu stages %.2f ms, %zu items (%zu texture, %zu primitive, %zu finalize), %.1f KB\n",
+            name.c_str(), budgeted.CpuMilliseconds, items.size(), textureCount,
+            singleSink.GetItemCount(GltfLoader::UploadPrimitive), singleSink.GetItemCount(GltfLoader::UploadFinalize),
+            singleSink.GetBytes() / 1024.0);
+        report += line;
+
+        // 업로드 순서 (같은 종류가 이어진 구간마다 한 줄)
+        for (size_t begin = 0; begin < items.size();)
+        {
+            size_t end = begin;
+            uint64_t bytes = 0;
+            while (end < items.size() && items[end].Kind == items[begin].Kind)
+            {
+                bytes += items[end].Bytes;
+                end++;
+            }
+            snprintf(line, sizeof(line), "    #%zu-%zu %s x%zu, %.1f KB\n", begin, end - 1,
+                items[begin].Kind < 3 ? kindNames[items[begin].Kind] : "?", end - begin, bytes / 1024.0);
+            report += line;
+            begin = end;
+        }
+
+        snprintf(line, sizeof(line),
+            "    budget 0: %zu frames, max %zu item/frame | budget %.2f ms: %zu frames, max %zu items/frame (limit %zu), "
+            "max pump %.2f ms -> %s\n",
+            single.PumpItems.size(), maxSingle, budgetMilliseconds, budgeted.PumpItems.size(), maxBudgeted, budgetLimit,
+            budgeted.Stats.MaxPumpMilliseconds, problems.empty() ? "ok" : "MISMATCH");
+        report += line;
+        for (const auto& problem : problems)
+        {
+            report += "    ! " + problem + "\n";
+        }
+        failures += problems.empty() ? 0 : 1;
+    }
+
+    snprintf(line, sizeof(line), "  %zu/%zu files ok\n", files.size() - failures, files.size());
+    report += line;
+    Report(report);
+    return failures == 0;
+}
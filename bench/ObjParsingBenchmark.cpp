@@ -0,0 +1,346 @@
+#include "Benchmarks.h"
+#include "Model.h"
+#include "ObjParser.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+// 재질 이름별로 삼각형 꼭짓점을 펼친 버텍스 (파서 결과 비교용)
+typedef std::map<std::string, std::vector<Model::Vertex>> ExpandedMeshes;
+
+// 이전 OBJ 파서 (getline + 줄마다 istringstream) - 성능 비교용
+static bool ParseObjLegacy(const std::string& filename, ExpandedMeshes& expanded)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::vector<XMFLOAT3> positions;
+    std::vector<XMFLOAT3> normals;
+    std::vector<XMFLOAT2> texCoords;
+    std::map<std::string, std::vector<uint32_t>> corners; // 재질별 (위치, 텍스처 좌표, 법선) 인덱스
+    std::string currentMaterialName = "default";
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream iss(line);
+        std::string token;
+        iss >> token;
+
+        if (token == "v")
+        {
+            XMFLOAT3 position;
+            iss >> position.x >> position.y >> position.z;
+            positions.push_back(position);
+        }
+        else if (token == "vn")
+        {
+            XMFLOAT3 normal;
+            iss >> normal.x >> normal.y >> normal.z;
+            normals.push_back(normal);
+        }
+        else if (token == "vt")
+        {
+            XMFLOAT2 texCoord;
+            iss >> texCoord.x >> texCoord.y;
+            texCoord.y = 1.0f - texCoord.y;
+            texCoords.push_back(texCoord);
+        }
+        else if (token == "f")
+        {
+            std::vector<uint32_t> face;
+            std::string faceVertex;
+            while (iss >> faceVertex)
+            {
+                std::replace(faceVertex.begin(), faceVertex.end(), '/', ' ');
+                std::istringstream faceData(faceVertex);
+
+                uint32_t posIndex = 1, texCoordIndex = 1, normalIndex = 1;
+                faceData >> posIndex;
+                if (faceData.peek() != EOF)
+                {
+                    faceData >> texCoordIndex;
+                }
+                if (faceData.peek() != EOF)
+                {
+                    faceData >> normalIndex;
+                }
+                face.push_back(posIndex - 1);
+                face.push_back(texCoordIndex - 1);
+                face.push_back(normalIndex - 1);
+            }
+
+            // 삼각형 팬으로 분할
+            std::vector<uint32_t>& materialCorners = corners[currentMaterialName];
+            size_t vertexCount = face.size() / 3;
+            for (size_t i = 1; i + 1 < vertexCount; i++)
+            {
+                const size_t triangle[3] = { 0, i, i + 1 };
+                for (size_t corner : triangle)
+                {
+                    materialCorners.insert(materialCorners.end(), face.begin() + corner * 3, face.begin() + corner * 3 + 3);
+                }
+            }
+        }
+        else if (token == "usemtl")
+        {
+            iss >> currentMaterialName;
+        }
+    }
+
+    for (const auto& materialCorners : corners)
+    {
+        std::vector<Model::Vertex>& vertices = expanded[materialCorners.first];
+        vertices.reserve(materialCorners.second.size() / 3);
+        for (size_t i = 0; i + 2 < materialCorners.second.size(); i += 3)
+        {
+            Model::Vertex vertex;
+            uint32_t posIndex = materialCorners.second[i];
+            uint32_t texCoordIndex = materialCorners.second[i + 1];
+            uint32_t normalIndex = materialCorners.second[i + 2];
+            vertex.Position = posIndex < positions.size() ? positions[posIndex] : XMFLOAT3(0.0f, 0.0f, 0.0f);
+            vertex.TexCoord = texCoordIndex < texCoords.size() ? texCoords[texCoordIndex] : XMFLOAT2(0.0f, 0.0f);
+            vertex.Normal = normalIndex < normals.size() ? normals[normalIndex] : XMFLOAT3(0.0f, 1.0f, 0.0f);
+            vertices.push_back(vertex);
+        }
+    }
+    return true;
+}
+
+// 새 파서 결과를 재질별 버텍스로 펼침 (BuildFromObj와 같은 기본값)
+static void ExpandObjResult(const ObjParser::Result& result, ExpandedMeshes& expanded)
+{
+    for (const auto& group : result.Groups)
+    {
+        std::vector<Model::Vertex>& vertices = expanded[group.MaterialName];
+        vertices.reserve(vertices.size() + group.Corners.size());
+        for (const ObjParser::Corner& corner : group.Corners)
+        {
+            Model::Vertex vertex;
+            vertex.Position = corner.Position >= 0 && static_cast<size_t>(corner.Position) < result.Positions.size() ?
+                result.Positions[corner.Position] : XMFLOAT3(0.0f, 0.0f, 0.0f);
+            vertex.TexCoord = corner.TexCoord >= 0 && static_cast<size_t>(corner.TexCoord) < result.TexCoords.size() ?
+                result.TexCoords[corner.TexCoord] : XMFLOAT2(0.0f, 0.0f);
+            vertex.Normal = corner.Normal >= 0 && static_cast<size_t>(corner.Normal) < result.Normals.size() ?
+                result.Normals[corner.Normal] : XMFLOAT3(0.0f, 1.0f, 0.0f);
+            vertices.push_back(vertex);
+        }
+    }
+}
+
+static bool SameExpandedMeshes(const ExpandedMeshes& first, const ExpandedMeshes& second)
+{
+    if (first.size() != second.size())
+    {
+        return false;
+    }
+    for (const auto& mesh : first)
+    {
+        auto other = second.find(mesh.first);
+        if (other == second.end() || other->second.size() != mesh.second.size() ||
+            (!mesh.second.empty() && memcmp(mesh.second.data(), other->second.data(), mesh.second.size() * sizeof(Model::Vertex)) != 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 두 파싱 결과가 같은지 (스레드 수별 병합 결과 비교용)
+static bool SameObjResult(const ObjParser::Result& first, const ObjParser::Result& second)
+{
+    auto sameBytes = [](const auto& a, const auto& b)
+    {
+        return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(a[0])) == 0);
+    };
+
+    if (!sameBytes(first.Positions, second.Positions) || !sameBytes(first.Normals, second.Normals) ||
+        !sameBytes(first.TexCoords, second.TexCoords) || first.MtlLib != second.MtlLib ||
+        first.Groups.size() != second.Groups.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < first.Groups.size(); i++)
+    {
+        if (first.Groups[i].MaterialName != second.Groups[i].MaterialName ||
+            !sameBytes(first.Groups[i].Corners, second.Groups[i].Corners))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 합성 OBJ - 격자 위의 사각형 면 (v/vt/vn 모두 사용), 행마다 재질 4개를 번갈아 지정
+// relativeIndices면 면 인덱스를 음수(상대) 인덱스로 써서 청크 병합의 인덱스 보정까지 확인
+static bool WriteSyntheticObj(const std::string& filename, size_t faceCount, bool relativeIndices = false)
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    const size_t columns = 512;
+    const size_t rows = (faceCount + columns - 1) / columns;
+    std::string text;
+    text.reserve(1 << 20);
+    char line[160];
+
+    for (size_t y = 0; y <= rows; y++)
+    {
+        for (size_t x = 0; x <= columns; x++)
+        {
+            float height = sinf(x * 0.05f) * cosf(y * 0.07f);
+            int length = snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                x * 0.01f, height, y * 0.01f, static_cast<float>(x) / columns, static_cast<float>(y) / rows,
+                -0.05f * height, 1.0f, 0.07f * height);
+            text.append(line, length);
+        }
+        if (text.size() > (1 << 20))
+        {
+            file.write(text.data(), text.size());
+            text.clear();
+        }
+    }
+
+    const long long vertexCount = static_cast<long long>((rows + 1) * (columns + 1));
+    size_t written = 0;
+    for (size_t y = 0; y < rows && written < faceCount; y++)
+    {
+        int length = snprintf(line, sizeof(line), "usemtl material_%zu\n", y % 4);
+        text.append(line, length);
+        for (size_t x = 0; x < columns && written < faceCount; x++, written++)
+        {
+            size_t a = y * (columns + 1) + x + 1;
+            size_t b = a + 1;
+            size_t c = a + columns + 2;
+            size_t d = a + columns + 1;
+            if (relativeIndices)
+            {
+                long long ra = static_cast<long long>(a) - vertexCount - 1;
+                long long rb = static_cast<long long>(b) - vertexCount - 1;
+                long long rc = static_cast<long long>(c) - vertexCount - 1;
+                long long rd = static_cast<long long>(d) - vertexCount - 1;
+                length = snprintf(line, sizeof(line), "f %lld/%lld/%lld %lld/%lld/%lld %lld/%lld/%lld %lld/%lld/%lld\n",
+                    ra, ra, ra, rb, rb, rb, rc, rc, rc, rd, rd, rd);
+            }
+            else
+            {
+                length = snprintf(line, sizeof(line), "f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n",
+                    a, a, a, b, b, b, c, c, c, d, d, d);
+            }
+            text.append(line, length);
+        }
+        if (text.size() > (1 << 20))
+        {
+            file.write(text.data(), text.size());
+            text.clear();
+        }
+    }
+    file.write(text.data(), text.size());
+    return file.good();
+}
+
+bool Benchmarks::ObjParsing(size_t faceCount)
+{
+    if (faceCount == 0)
+    {
+        return true;
+    }
+
+    std::error_code error;
+    std::string objPath = (std::filesystem::temp_directory_path(error) / "obj_parse_benchmark.obj").string();
+    if (!WriteSyntheticObj(objPath, faceCount))
+    {
+        Report("OBJ parse benchmark: 합성 OBJ 파일을 만들지 못했습니다.\n");
+        return false;
+    }
+    uint64_t fileBytes = std::filesystem::file_size(objPath, error);
+    double fileMB = fileBytes / (1024.0 * 1024.0);
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto milliseconds = [](Clock::time_point start, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    auto throughput = [fileMB](double ms)
+    {
+        return ms > 0.0 ? fileMB / (ms / 1000.0) : 0.0;
+    };
+
+    // 이전 파서 (getline + istringstream)
+    ExpandedMeshes legacyMeshes;
+    auto legacyStart = Clock::now();
+    bool succeeded = ParseObjLegacy(objPath, legacyMeshes);
+    auto legacyEnd = Clock::now();
+
+    // 메모리 매핑 파서 (단일 스레드로 토크나이저만 비교)
+    ObjParser::Result mappedResult;
+    auto mappedStart = Clock::now();
+    succeeded = ObjParser::ParseFile(objPath, mappedResult, 1) && succeeded;
+    auto mappedEnd = Clock::now();
+
+    ExpandedMeshes mappedMeshes;
+    ExpandObjResult(mappedResult, mappedMeshes);
+    bool identical = succeeded && SameExpandedMeshes(legacyMeshes, mappedMeshes);
+
+    double legacyMs = milliseconds(legacyStart, legacyEnd);
+    double mappedMs = milliseconds(mappedStart, mappedEnd);
+    std::string report = "OBJ parse benchmark: " + std::to_string(faceCount) + " faces, " + std::to_string(fileMB) + " MB" +
+        (succeeded ? "" : " (failed)") +
+        "\n  getline/istringstream (old) " + std::to_string(legacyMs) + " ms (" + std::to_string(throughput(legacyMs)) + " MB/s)" +
+        "\n  memory-mapped               " + std::to_string(mappedMs) + " ms (" + std::to_string(throughput(mappedMs)) + " MB/s), " +
+        (identical ? "meshes identical" : "MESH MISMATCH") + "\n";
+
+    // 스레드 수별 확장성 - 상대 인덱스 파일을 청크 수 1/2/4/8/16으로 나눠 공유 스레드 풀에서 파싱
+    // 병합 결과는 단일 스레드 결과와 바이트 단위로 같아야 함
+    std::filesystem::remove(objPath, error);
+    if (!WriteSyntheticObj(objPath, faceCount, true))
+    {
+        Report(report + "  합성 OBJ 파일(상대 인덱스)을 만들지 못했습니다.\n");
+        return false;
+    }
+
+    ObjParser::Result serialResult;
+    double serialMs = 0.0;
+    const unsigned int threadCounts[] = { 1, 2, 4, 8, 16 };
+    for (unsigned int threadCount : threadCounts)
+    {
+        ObjParser::Result result;
+        auto start = Clock::now();
+        bool parsed = ObjParser::ParseFile(objPath, result, threadCount);
+        double ms = milliseconds(start, Clock::now());
+
+        if (threadCount == 1)
+        {
+            succeeded = parsed && succeeded;
+            serialResult = std::move(result);
+            serialMs = ms;
+            report += "  threads  1: " + std::to_string(ms) + " ms (" + std::to_string(throughput(ms)) + " MB/s)" +
+                (parsed ? "" : " (failed)") + "\n";
+            continue;
+        }
+
+        // 파일이 작으면 요청한 수보다 적은 청크로 나뉨 (result.ThreadCount가 실제 청크 수)
+        bool same = parsed && SameObjResult(serialResult, result);
+        succeeded = same && succeeded;
+        report += "  threads " + std::string(threadCount < 10 ? " " : "") + std::to_string(threadCount) + ": " +
+            std::to_string(ms) + " ms (" + std::to_string(throughput(ms)) + " MB/s, x" +
+            std::to_string(ms > 0.0 ? serialMs / ms : 0.0) + ", " + std::to_string(result.ThreadCount) + " chunks), " +
+            (same ? "identical" : "MISMATCH") + "\n";
+    }
+    report += "  pool workers " + std::to_string(ThreadPool::GetShared().GetThreadCount()) + " + caller\n";
+
+    std::filesystem::remove(objPath, error);
+    Report(report);
+    return succeeded && identical;
+}
@@ -0,0 +1,105 @@
+#include "Benchmarks.h"
+#include <windows.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "dxgi.lib")
+#pragma comment(lib, "d3dcompiler.lib")
+
+void Benchmarks::Report(const std::string& text)
+{
+    fputs(text.c_str(), stdout);
+    fflush(stdout);
+}
+
+std::vector<std::string> Benchmarks::FindAssetModels(const std::string& extension)
+{
+    // 디버거에서 실행하면 작업 폴더가 프로젝트 폴더, 직접 실행하면 bin\<플랫폼>\<구성>\ 이므로 상위 폴더도 확인
+    char modulePath[MAX_PATH] = {};
+    GetModuleFileNameA(nullptr, modulePath, MAX_PATH);
+
+    std::error_code error;
+    std::vector<std::filesystem::path> candidates = { std::filesystem::current_path(error) };
+    std::filesystem::path directory = std::filesystem::path(modulePath).parent_path();
+    for (int depth = 0; depth < 4 && !directory.empty(); depth++)
+    {
+        candidates.push_back(directory);
+        directory = directory.parent_path();
+    }
+
+    std::vector<std::string> files;
+    for (const auto& candidate : candidates)
+    {
+        std::filesystem::path models = candidate / "asset" / "models";
+        if (!std::filesystem::is_directory(models, error))
+        {
+            continue;
+        }
+
+        for (const auto& entry : std::filesystem::directory_iterator(models, error))
+        {
+            std::string path = entry.path().string();
+            if (entry.is_regular_file(error) && path.size() >= extension.size() &&
+                _stricmp(path.c_str() + path.size() - extension.size(), extension.c_str()) == 0)
+            {
+                files.push_back(path);
+            }
+        }
+        std::sort(files.begin(), files.end());
+        break;
+    }
+
+    if (files.empty())
+    {
+        Report("asset\\models에서 " + extension + " 파일을 찾지 못했습니다.\n");
+    }
+    return files;
+}
+
+// 사용법: Benchmarks.exe [all|obj|accessors|glb|pipeline] [GLB 파일...]
+// GLB 파일을 지정하지 않으면 asset\models의 GLB를 사용, 하나라도 실패하면 1을 반환
+int main(int argc, char* argv[])
+{
+    const char* name = argc > 1 ? argv[1] : "all";
+    bool all = strcmp(name, "all") == 0;
+    bool known = all;
+    bool succeeded = true;
+
+    std::vector<std::string> glbFiles(argv + (std::min)(argc, 2), argv + argc);
+    if (glbFiles.empty() && (all || strcmp(name, "obj") != 0))
+    {
+        glbFiles = Benchmarks::FindAssetModels(".glb");
+    }
+
+    if (all || strcmp(name, "obj") == 0)
+    {
+        known = true;
+        succeeded = Benchmarks::ObjParsing(1000000) && succeeded;
+    }
+    if (all || strcmp(name, "accessors") == 0)
+    {
+        known = true;
+        succeeded = Benchmarks::AccessorDecoding(glbFiles, 20) && succeeded;
+    }
+    if (all || strcmp(name, "glb") == 0)
+    {
+        known = true;
+        succeeded = Benchmarks::GlbLoading(glbFiles) && succeeded;
+    }
+    if (all || strcmp(name, "pipeline") == 0)
+    {
+        // 앱의 기본 업로드 예산 2ms, 업로드 항목 하나에 0.25ms
+        known = true;
+        succeeded = Benchmarks::CheckImportPipeline(glbFiles, 2.0, 0.25) && succeeded;
+    }
+
+    if (!known)
+    {
+        fprintf(stderr, "알 수 없는 항목: %s (all, obj, accessors, glb, pipeline)\n", name);
+        return 2;
+    }
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,289 @@
+#include "AnimationEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+    // 재생 중 커서에서 앞으로 확인할 최대 키프레임 수 (넘어가면 이진 탐색)
+    const size_t MaxCursorSteps = 4;
+}
+
+void AnimationEngine::Pose::Resize(size_t nodeCount)
+{
+    Translations.assign(nodeCount, XMFLOAT3(0.0f, 0.0f, 0.0f));
+    Rotations.assign(nodeCount, XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f));
+    Scales.assign(nodeCount, XMFLOAT3(1.0f, 1.0f, 1.0f));
+    Weights.assign(nodeCount, std::vector<float>());
+}
+
+void AnimationEngine::State::Reset(const Pose& restPose, const Clip* clip)
+{
+    Current = restPose;
+    Cursors.assign(clip ? clip->Channels.size() : 0, 0);
+    Dirty.assign(restPose.GetNodeCount(), 0);
+    WeightsDirty.assign(restPose.GetNodeCount(), 0);
+    for (size_t i = 0; i < restPose.Weights.size(); i++)
+    {
+        WeightsDirty[i] = restPose.Weights[i].empty() ? 0 : 1;
+    }
+}
+
+void AnimationEngine::Decompose(FXMMATRIX localTransform, Pose& pose, size_t nodeIndex)
+{
+    XMVECTOR scale, rotation, translation;
+    if (!XMMatrixDecompose(&scale, &rotation, &translation, localTransform))
+    {
+        scale = XMVectorSplatOne();
+        rotation = XMQuaternionIdentity();
+        translation = localTransform.r[3];
+    }
+
+    XMStoreFloat3(&pose.Translations[nodeIndex], translation);
+    XMStoreFloat4(&pose.Rotations[nodeIndex], rotation);
+    XMStoreFloat3(&pose.Scales[nodeIndex], scale);
+}
+
+XMMATRIX AnimationEngine::Compose(const Pose& pose, size_t nodeIndex)
+{
+    // S * R * T를 한 번에 구성
+    return XMMatrixAffineTransformation(
+        XMLoadFloat3(&pose.Scales[nodeIndex]),
+        XMVectorZero(),
+        XMLoadFloat4(&pose.Rotations[nodeIndex]),
+        XMLoadFloat3(&pose.Translations[nodeIndex]));
+}
+
+size_t AnimationEngine::FindKeyframe(const std::vector<float>& times, float time, uint32_t& cursor)
+{
+    size_t count = times.size();
+    size_t key = cursor < count ? cursor : 0;
+
+    if (times[key] <= time)
+    {
+        // 재생 중에는 대부분 같은 구간이거나 바로 다음 구간
+        for (size_t step = 0; step < MaxCursorSteps && key + 1 < count && times[key + 1] <= time; step++)
+        {
+            key++;
+        }
+
+        // 프레임이 길게 끊겼거나 앞으로 탐색한 경우
+        if (key + 1 < count && times[key + 1] <= time)
+        {
+            key = static_cast<size_t>(std::upper_bound(times.begin() + key + 1, times.end(), time) - times.begin()) - 1;
+        }
+    }
+    else
+    {
+        // 반복 재생으로 처음으로 돌아갔거나 뒤로 탐색한 경우
+        auto it = std::upper_bound(times.begin(), times.begin() + key, time);
+        key = it == times.begin() ? 0 : static_cast<size_t>(it - times.begin()) - 1;
+    }
+
+    cursor = static_cast<uint32_t>(key);
+    return key;
+}
+
+void AnimationEngine::Evaluate(const Clip& clip, float time, State& state)
+{
+    size_t nodeCount = state.Current.GetNodeCount();
+    if (state.Cursors.size() != clip.Channels.size())
+    {
+        state.Cursors.assign(clip.Channels.size(), 0);
+    }
+    if (state.Dirty.size() != nodeCount)
+    {
+        state.Dirty.assign(nodeCount, 0);
+    }
+    if (state.WeightsDirty.size() != nodeCount)
+    {
+        state.WeightsDirty.assign(nodeCount, 0);
+    }
+    if (state.Current.Weights.size() != nodeCount)
+    {
+        state.Current.Weights.resize(nodeCount);
+    }
+
+    for (size_t channelIndex = 0; channelIndex < clip.Channels.size(); channelIndex++)
+    {
+        const Channel& channel = clip.Channels[channelIndex];
+        if (channel.NodeIndex < 0 || static_cast<size_t>(channel.NodeIndex) >= nodeCount || channel.Times.empty())
+        {
+            continue;
+        }
+
+        size_t keyCount = channel.Times.size();
+        bool cubic = channel.Mode == Interpolation::CubicSpline;
+        bool weights = channel.Path == Channel::WEIGHTS;
+        if (weights ? (channel.TargetCount == 0 || channel.Weights.size() < keyCount * (cubic ? 3 : 1) * channel.TargetCount) :
+            channel.Values.size() < keyCount * (cubic ? 3 : 1))
+        {
+            continue;
+        }
+
+        // 구간 [key, next]와 구간 안의 위치 t
+        size_t key = FindKeyframe(channel.Times, time, state.Cursors[channelIndex]);
+        size_t next = (std::min)(key + 1, keyCount - 1);
+        float keyDelta = channel.Times[next] - channel.Times[key];
+        float t = 0.0f;
+        if (keyDelta > 0.0f)
+        {
+            t = (std::min)((std::max)((time - channel.Times[key]) / keyDelta, 0.0f), 1.0f);
+        }
+
+        if (weights)
+        {
+            EvaluateWeights(channel, key, next, t, keyDelta, state, static_cast<size_t>(channel.NodeIndex));
+            continue;
+        }
+
+        bool rotation = channel.Path == Channel::ROTATION;
+        XMVECTOR value;
+        switch (channel.Mode)
+        {
+        case Interpolation::Step:
+            value = XMLoadFloat4(&channel.Values[key]);
+            break;
+        case Interpolation::CubicSpline:
+        {
+            // 에르미트 스플라인 - 탄젠트는 구간 길이로 스케일
+            XMVECTOR p0 = XMLoadFloat4(&channel.Values[key * 3 + 1]);
+            XMVECTOR m0 = XMVectorScale(XMLoadFloat4(&channel.Values[key * 3 + 2]), keyDelta);
+            XMVECTOR p1 = XMLoadFloat4(&channel.Values[next * 3 + 1]);
+            XMVECTOR m1 = XMVectorScale(XMLoadFloat4(&channel.Values[next * 3]), keyDelta);
+            value = XMVectorHermite(p0, m0, p1, m1, t);
+            if (rotation)
+            {
+                value = XMQuaternionNormalize(value);
+            }
+            break;
+        }
+        default:
+        {
+            XMVECTOR v0 = XMLoadFloat4(&channel.Values[key]);
+            XMVECTOR v1 = XMLoadFloat4(&channel.Values[next]);
+            value = rotation ? XMQuaternionSlerp(v0, v1, t) : XMVectorLerp(v0, v1, t);
+            break;
+        }
+        }
+
+        // 채널은 노드의 한 성분만 덮어쓰고 나머지 성분은 그대로 유지
+        size_t node = static_cast<size_t>(channel.NodeIndex);
+        switch (channel.Path)
+        {
+        case Channel::TRANSLATION:
+            XMStoreFloat3(&state.Current.Translations[node], value);
+            break;
+        case Channel::ROTATION:
+            XMStoreFloat4(&state.Current.Rotations[node], value);
+            break;
+        case Channel::SCALE:
+            XMStoreFloat3(&state.Current.Scales[node], value);
+            break;
+        default:
+            break;
+        }
+        state.Dirty[node] = 1;
+    }
+}
+
+void AnimationEngine::EvaluateWeights(const Channel& channel, size_t key, size_t next, float t, float keyDelta,
+    State& state, size_t nodeIndex)
+{
+    size_t targetCount = channel.TargetCount;
+    std::vector<float>& current = state.Current.Weights[nodeIndex];
+    if (current.size() != targetCount)
+    {
+        current.assign(targetCount, 0.0f);
+        state.WeightsDirty[nodeIndex] = 1;
+    }
+
+    // 키프레임 k의 타깃 i 값 - CUBICSPLINE이면 (입력 탄젠트, 값, 출력 탄젠트) 블록이 타깃 수만큼씩 이어짐
+    const float* values = channel.Weights.data();
+    bool changed = false;
+    for (size_t i = 0; i < targetCount; i++)
+    {
+        float value;
+        switch (channel.Mode)
+        {
+        case Interpolation::Step:
+            value = values[key * targetCount + i];
+            break;
+        case Interpolation::CubicSpline:
+        {
+            float t2 = t * t;
+            float t3 = t2 * t;
+            float p0 = values[(key * 3 + 1) * targetCount + i];
+            float m0 = values[(key * 3 + 2) * targetCount + i] * keyDelta;
+            float p1 = values[(next * 3 + 1) * targetCount + i];
+            float m1 = values[next * 3 * targetCount + i] * keyDelta;
+            value = (2.0f * t3 - 3.0f * t2 + 1.0f) * p0 + (t3 - 2.0f * t2 + t) * m0 +
+                (-2.0f * t3 + 3.0f * t2) * p1 + (t3 - t2) * m1;
+            break;
+        }
+        default:
+            value = values[key * targetCount + i] + (values[next * targetCount + i] - values[key * targetCount + i]) * t;
+            break;
+        }
+
+        if (current[i] != value)
+        {
+            current[i] = value;
+            changed = true;
+        }
+    }
+
+    // 가중치가 그대로면 정점을 다시 섞지 않음 (정지 구간, STEP 보간 등)
+    if (changed)
+    {
+        state.WeightsDirty[nodeIndex] = 1;
+    }
+}
+
+double AnimationEngine::Benchmark(const Clip& clip, const Pose& restPose, size_t instanceCount, size_t frameCount)
+{
+    if (instanceCount == 0 || frameCount == 0)
+    {
+        return 0.0;
+    }
+
+    std::vector<State> states(instanceCount);
+    for (auto& state : states)
+    {
+        state.Reset(restPose, &clip);
+    }
+    std::vector<XMFLOAT4X4> localTransforms(restPose.GetNodeCount());
+
+    const float frameTime = 1.0f / 60.0f;
+    float duration = clip.EndTime - clip.StartTime;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t frame = 0; frame < frameCount; frame++)
+    {
+        for (size_t i = 0; i < instanceCount; i++)
+        {
+            // 인스턴스마다 재생 위치를 어긋나게 해서 같은 키프레임만 반복하지 않도록 함
+            float time = clip.StartTime;
+            if (duration > 0.0f)
+            {
+                time += fmodf(frame * frameTime + duration * static_cast<float>(i) / instanceCount, duration);
+            }
+
+            State& state = states[i];
+            Evaluate(clip, time, state);
+            for (size_t node = 0; node < state.Dirty.size(); node++)
+            {
+                if (state.Dirty[node])
+                {
+                    XMStoreFloat4x4(&localTransforms[node], Compose(state.Current, node));
+                    state.Dirty[node] = 0;
+                }
+            }
+            std::fill(state.WeightsDirty.begin(), state.WeightsDirty.end(), 0);
+        }
+    }
+
+    double totalMilliseconds = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+    return totalMilliseconds / frameCount;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <directxmath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace DirectX;
+
+// glTF 노드 애니메이션 평가기 (디바이스 없이 동작)
+// 노드별 이동/회전/크기를 SoA 배열로 보관하고, 채널마다 마지막 키프레임 위치(커서)를 기억해서
+// 재생 중에는 앞쪽으로 몇 칸만 확인하고, 되감기나 탐색처럼 크게 움직였을 때만 이진 탐색을 사용한다
+class AnimationEngine
+{
+public:
+    // 키프레임 보간 방식 (glTF sampler.interpolation)
+    enum class Interpolation : uint32_t
+    {
+        Step = 0,
+        Linear,
+        CubicSpline
+    };
+
+    // 애니메이션 채널 - 노드 하나의 이동/회전/크기 중 하나를 움직임
+    struct Channel
+    {
+        int NodeIndex = -1;
+        enum TargetPath { TRANSLATION, ROTATION, SCALE, WEIGHTS } Path = TRANSLATION;
+        Interpolation Mode = Interpolation::Linear;
+        std::vector<float> Times;
+        std::vector<XMFLOAT4> Values; // CUBICSPLINE이면 키프레임마다 (입력 탄젠트, 값, 출력 탄젠트) 3개
+
+        // WEIGHTS 채널 - 키프레임마다 모프 타깃 수(TargetCount)만큼의 가중치 (CUBICSPLINE이면 3배)
+        uint32_t TargetCount = 0;
+        std::vector<float> Weights;
+    };
+
+    // 애니메이션 클립
+    struct Clip
+    {
+        std::string Name;
+        std::vector<Channel> Channels;
+        float StartTime = 0.0f;
+        float EndTime = 0.0f;
+    };
+
+    // 노드 포즈 (SoA - 같은 성분끼리 연속된 메모리에 둠)
+    struct Pose
+    {
+        std::vector<XMFLOAT3> Translations;
+        std::vector<XMFLOAT4> Rotations;
+        std::vector<XMFLOAT3> Scales;
+        std::vector<std::vector<float>> Weights; // 노드 메시의 모프 타깃 가중치 (모프 타깃이 없으면 비어 있음)
+
+        void Resize(size_t nodeCount);
+        size_t GetNodeCount() const { return Translations.size(); }
+    };
+
+    // 재생 상태 - 평가할 때마다 갱신되는 현재 포즈와 채널별 커서
+    struct State
+    {
+        Pose Current;
+        std::vector<uint32_t> Cursors;
+        std::vector<uint8_t> Dirty; // 이번 평가에서 바뀐 노드 (행렬을 다시 만들어야 함)
+        std::vector<uint8_t> WeightsDirty; // 모프 가중치 값이 실제로 바뀐 노드 (정점을 다시 섞어야 함)
+
+        // 클립 재생을 처음부터 시작할 때 호출 (포즈를 기본 포즈로 되돌리고 커서 초기화)
+        // 기본 가중치가 있는 노드는 WeightsDirty로 표시해서 기본 모양으로 다시 섞도록 함
+        void Reset(const Pose& restPose, const Clip* clip);
+    };
+
+    // 로컬 변환 행렬을 이동/회전/크기로 분해 (분해할 수 없으면 기본값)
+    static void Decompose(FXMMATRIX localTransform, Pose& pose, size_t nodeIndex);
+
+    // 노드 하나의 로컬 변환 행렬 (크기 -> 회전 -> 이동)
+    static XMMATRIX Compose(const Pose& pose, size_t nodeIndex);
+
+    // time 이하인 마지막 키프레임 인덱스 (cursor는 다음 호출을 위해 갱신)
+    static size_t FindKeyframe(const std::vector<float>& times, float time, uint32_t& cursor);
+
+    // 클립을 time에서 평가해서 state.Current에 쓰고 바뀐 노드를 state.Dirty에 표시
+    // 모프 가중치는 이전 값과 다를 때만 state.WeightsDirty에 표시
+    static void Evaluate(const Clip& clip, float time, State& state);
+
+    // WEIGHTS 채널 하나를 구간 [key, next]의 t에서 평가해서 노드의 모프 가중치에 기록
+    static void EvaluateWeights(const Channel& channel, size_t key, size_t next, float t, float keyDelta,
+        State& state, size_t nodeIndex);
+
+    // CPU 평가 성능 측정 - instanceCount개의 재생 상태를 서로 다른 시간으로 frameCount 프레임 동안 평가/합성
+    // 프레임당 평균 시간(ms)을 반환
+    static double Benchmark(const Clip& clip, const Pose& restPose, size_t instanceCount, size_t frameCount);
+};
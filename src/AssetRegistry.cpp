@@ -0,0 +1,146 @@
+#include "AssetRegistry.h"
+#include <chrono>
+
+namespace
+{
+    // 로드가 끝났는지 확인
+    bool IsReady(const std::shared_future<bool>& loaded)
+    {
+        return loaded.valid() && loaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // 로드 결과 (예외로 끝났으면 실패로 처리)
+    bool Succeeded(const std::shared_future<bool>& loaded)
+    {
+        try
+        {
+            return loaded.get();
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+}
+
+AssetRegistry::AssetRegistry()
+{
+}
+
+AssetRegistry::Handle<Model> AssetRegistry::AcquireObj(const std::string& path)
+{
+    return Acquire(objEntries, path);
+}
+
+AssetRegistry::Handle<GltfLoader> AssetRegistry::AcquireGlb(const std::string& path)
+{
+    return Acquire(glbEntries, path);
+}
+
+template <typename AssetType>
+AssetRegistry::Handle<AssetType> AssetRegistry::Acquire(std::map<std::string, Entry<AssetType>>& entries, const std::string& path)
+{
+    Handle<AssetType> handle;
+
+    // 원본 파일 식별 (크기와 수정 시간만, 내용은 읽지 않음) - 파일이 없으면 등록하지 않고 로드 실패는 호출 측에서 처리
+    MeshCache::SourceKey key;
+    bool hasKey = MeshCache::MakeStampKey(path, key);
+    handle.Key = key;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    if (hasKey)
+    {
+        auto it = entries.find(key.CanonicalPath);
+        if (it != entries.end())
+        {
+            // 살아 있고, 파일이 바뀌지 않았고, 로드에 실패하지 않은 에셋만 공유
+            Entry<AssetType>& entry = it->second;
+            std::shared_ptr<AssetType> asset = entry.Asset.lock();
+            bool sameContent = entry.Key.Size == key.Size &&
+                entry.Key.WriteTime == key.WriteTime;
+            bool failed = IsReady(entry.Loaded) && !Succeeded(entry.Loaded);
+
+            if (asset && sameContent && !failed)
+            {
+                handle.Asset = asset;
+                handle.Loaded = entry.Loaded;
+                sharedLoads++;
+                OutputDebugStringA(("Asset shared: " + path + " (" + std::to_string(asset.use_count() - 1) +
+                    " existing instances)\n").c_str());
+                return handle;
+            }
+        }
+    }
+
+    // 새 에셋 등록 - 호출 측이 로드 후 LoadPromise에 결과를 설정
+    handle.Asset = std::make_shared<AssetType>();
+    handle.LoadPromise = std::make_shared<std::promise<bool>>();
+    handle.Loaded = handle.LoadPromise->get_future().share();
+
+    if (hasKey)
+    {
+        Entry<AssetType>& entry = entries[key.CanonicalPath];
+        entry.Key = key;
+        entry.Asset = handle.Asset;
+        entry.Loaded = handle.Loaded;
+    }
+
+    // 인스턴스가 모두 사라진 항목 정리
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        if (it->second.Asset.expired())
+        {
+            it = entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return handle;
+}
+
+AssetRegistry::Stats AssetRegistry::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    Stats stats;
+    AccumulateStats(objEntries, stats);
+    AccumulateStats(glbEntries, stats);
+    stats.SharedLoads = sharedLoads;
+    return stats;
+}
+
+template <typename AssetType>
+void AssetRegistry::AccumulateStats(const std::map<std::string, Entry<AssetType>>& entries, Stats& stats) const
+{
+    for (const auto& pair : entries)
+    {
+        const Entry<AssetType>& entry = pair.second;
+        if (!IsReady(entry.Loaded) || !Succeeded(entry.Loaded))
+        {
+            continue;
+        }
+
+        std::shared_ptr<AssetType> asset = entry.Asset.lock();
+        if (!asset)
+        {
+            continue;
+        }
+
+        // 여기서 잠근 참조를 뺀 나머지가 인스턴스 수
+        uint64_t instances = static_cast<uint64_t>(asset.use_count() - 1);
+        if (instances == 0)
+        {
+            continue;
+        }
+
+        uint64_t bytes = asset->GetMemoryUsage();
+        stats.AssetCount++;
+        stats.InstanceCount += static_cast<size_t>(instances);
+        stats.LoadedBytes += bytes;
+        stats.SavedBytes += bytes * (instances - 1);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "GltfLoader.h"
+#include "MeshCache.h"
+#include "Model.h"
+
+// 여러 인스턴스가 공유하는 모델 에셋 레지스트리
+// 정규화된 경로 + 크기 + 수정 시간으로 에셋을 찾아서 같은 파일은 한 번만 파싱하고 업로드한다
+// UI 스레드에서는 파일을 읽지 않으며, 내용 해시는 로드 작업이 Key로 메시 캐시를 조회할 때 한 번만 계산한다
+// 에셋은 인스턴스가 shared_ptr로 참조하며, 마지막 인스턴스가 사라지면 메시/재질/텍스처가 해제된다
+class AssetRegistry
+{
+public:
+    // 에셋 조회 결과
+    // LoadPromise가 있으면 새로 등록된 에셋이므로 호출 측이 로드한 뒤 결과를 설정해야 함
+    // 없으면 이미 등록된 에셋을 공유하며, Loaded로 로드 완료를 기다릴 수 있음
+    // Key는 내용 해시가 없는 원본 식별 정보 (로드 작업이 MeshCache::CompleteKey로 해시를 채워서 캐시 조회에 사용)
+    template <typename AssetType>
+    struct Handle
+    {
+        MeshCache::SourceKey Key;
+        std::shared_ptr<AssetType> Asset;
+        std::shared_future<bool> Loaded;
+        std::shared_ptr<std::promise<bool>> LoadPromise;
+    };
+
+    // 공유 통계
+    struct Stats
+    {
+        size_t AssetCount = 0;     // 로드된 에셋 수
+        size_t InstanceCount = 0;  // 에셋을 참조하는 인스턴스 수
+        uint64_t LoadedBytes = 0;  // 에셋이 실제로 차지하는 메모리
+        uint64_t SavedBytes = 0;   // 인스턴스마다 따로 로드했을 때보다 줄어든 메모리
+        uint64_t SharedLoads = 0;  // 다시 로드하지 않고 공유한 횟수
+    };
+
+    AssetRegistry();
+
+    // 에셋 조회 또는 등록
+    Handle<Model> AcquireObj(const std::string& path);
+    Handle<GltfLoader> AcquireGlb(const std::string& path);
+
+    // 로드가 끝난 에셋 통계 (인스턴스 수는 에셋의 참조 수로 계산)
+    Stats GetStats() const;
+
+private:
+    template <typename AssetType>
+    struct Entry
+    {
+        MeshCache::SourceKey Key;
+        std::weak_ptr<AssetType> Asset;
+        std::shared_future<bool> Loaded;
+    };
+
+    template <typename AssetType>
+    Handle<AssetType> Acquire(std::map<std::string, Entry<AssetType>>& entries, const std::string& path);
+
+    template <typename AssetType>
+    void AccumulateStats(const std::map<std::string, Entry<AssetType>>& entries, Stats& stats) const;
+
+    std::map<std::string, Entry<Model>> objEntries;
+    std::map<std::string, Entry<GltfLoader>> glbEntries;
+    uint64_t sharedLoads = 0;
+
+    mutable std::mutex registryMutex;
+};
@@ -0,0 +1,180 @@
+#include "Avx2Kernels.h"
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+    // 길이가 0이 아니면 정규화해서 기록 (std::sqrt 대신 내장 함수를 써서 공유 인라인 함수를 만들지 않음)
+    inline void StoreNormalized3(unsigned char* destination, float x, float y, float z)
+    {
+        float length = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x * x + y * y + z * z)));
+        if (length > 0.0f)
+        {
+            x /= length;
+            y /= length;
+            z /= length;
+        }
+
+        float values[3] = { x, y, z };
+        memcpy(destination, values, sizeof(values));
+    }
+}
+
+void Avx2Kernels::Skin(const SkinningKernel::JointMatrix* palette, uint32_t jointCount, const SkinningKernel::Layout& layout,
+    const void* source, void* destination, size_t begin, size_t end)
+{
+    const unsigned char* sourceBytes = static_cast<const unsigned char*>(source);
+    unsigned char* destinationBytes = static_cast<unsigned char*>(destination);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const unsigned char* input = sourceBytes + i * layout.Stride;
+        unsigned char* output = destinationBytes + i * layout.Stride;
+
+        // 텍스처 좌표 등 변환하지 않는 속성은 그대로 복사
+        memcpy(output, input, layout.Stride);
+        if (jointCount == 0)
+        {
+            continue;
+        }
+
+        float weights[4];
+        uint32_t joints[4];
+        float position[3];
+        float normal[3];
+        float tangent[4];
+        memcpy(weights, input + layout.Weights, sizeof(weights));
+        memcpy(joints, input + layout.Joints, sizeof(joints));
+        memcpy(position, input + layout.Position, sizeof(position));
+        memcpy(normal, input + layout.Normal, sizeof(normal));
+        memcpy(tangent, input + layout.Tangent, sizeof(tangent));
+
+        // 조인트 행렬 섞기 - upper = 행 0|1, lower = 행 2|3
+        __m256 upper = _mm256_setzero_ps();
+        __m256 lower = _mm256_setzero_ps();
+        float totalWeight = 0.0f;
+        for (int k = 0; k < 4; k++)
+        {
+            if (weights[k] == 0.0f || joints[k] >= jointCount)
+            {
+                continue;
+            }
+
+            const float* rows = &palette[joints[k]].Rows[0][0];
+            __m256 weight = _mm256_set1_ps(weights[k]);
+            upper = _mm256_add_ps(upper, _mm256_mul_ps(weight, _mm256_loadu_ps(rows)));
+            lower = _mm256_add_ps(lower, _mm256_mul_ps(weight, _mm256_loadu_ps(rows + 8)));
+            totalWeight += weights[k];
+        }
+
+        // 영향을 주는 조인트가 없으면 바인드 포즈 유지
+        if (totalWeight == 0.0f)
+        {
+            continue;
+        }
+
+        // 행 벡터 변환: x * R0 + y * R1 + z * R2 + w * R3 (두 행씩 곱한 뒤 상위/하위 128비트를 더함)
+        auto transform = [&upper, &lower](float x, float y, float z, float w, float* result)
+        {
+            __m256 xy = _mm256_set_m128(_mm_set1_ps(y), _mm_set1_ps(x));
+            __m256 zw = _mm256_set_m128(_mm_set1_ps(w), _mm_set1_ps(z));
+            __m256 sum = _mm256_add_ps(_mm256_mul_ps(upper, xy), _mm256_mul_ps(lower, zw));
+            _mm_storeu_ps(result, _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)));
+        };
+
+        float skinnedPosition[4];
+        float skinnedNormal[4];
+        float skinnedTangent[4];
+        transform(position[0], position[1], position[2], 1.0f, skinnedPosition);
+        transform(normal[0], normal[1], normal[2], 0.0f, skinnedNormal);
+        transform(tangent[0], tangent[1], tangent[2], 0.0f, skinnedTangent);
+
+        memcpy(output + layout.Position, skinnedPosition, sizeof(float) * 3);
+        StoreNormalized3(output + layout.Normal, skinnedNormal[0], skinnedNormal[1], skinnedNormal[2]);
+        StoreNormalized3(output + layout.Tangent, skinnedTangent[0], skinnedTangent[1], skinnedTangent[2]);
+    }
+}
+
+size_t Avx2Kernels::ConvertUInt8(const unsigned char* source, size_t count, float scale, float* destination)
+{
+    size_t i = 0;
+    __m256 scale8 = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+        _mm256_storeu_ps(destination + i, _mm256_mul_ps(_mm256_cvtepi32_ps(wide), scale8));
+    }
+    return i;
+}
+
+size_t Avx2Kernels::ConvertInt8(const unsigned char* source, size_t count, float scale, float minimum, float* destination)
+{
+    size_t i = 0;
+    __m256 scale8 = _mm256_set1_ps(scale);
+    __m256 minimum8 = _mm256_set1_ps(minimum);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+        _mm256_storeu_ps(destination + i, _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(wide), scale8), minimum8));
+    }
+    return i;
+}
+
+size_t Avx2Kernels::ConvertUInt16(const unsigned char* source, size_t count, float scale, float* destination)
+{
+    size_t i = 0;
+    __m256 scale8 = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2)));
+        _mm256_storeu_ps(destination + i, _mm256_mul_ps(_mm256_cvtepi32_ps(wide), scale8));
+    }
+    return i;
+}
+
+size_t Avx2Kernels::ConvertInt16(const unsigned char* source, size_t count, float scale, float minimum, float* destination)
+{
+    size_t i = 0;
+    __m256 scale8 = _mm256_set1_ps(scale);
+    __m256 minimum8 = _mm256_set1_ps(minimum);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2)));
+        _mm256_storeu_ps(destination + i, _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(wide), scale8), minimum8));
+    }
+    return i;
+}
+
+size_t Avx2Kernels::WidenUInt8(const unsigned char* source, size_t count, uint32_t* destination)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), wide);
+    }
+    return i;
+}
+
+size_t Avx2Kernels::WidenUInt16(const unsigned char* source, size_t count, uint32_t* destination)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i wide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), wide);
+    }
+    return i;
+}
+
+size_t Avx2Kernels::Accumulate(float* destination, const float* delta, float weight, size_t count)
+{
+    size_t i = 0;
+    __m256 weight8 = _mm256_set1_ps(weight);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 value = _mm256_loadu_ps(destination + i);
+        _mm256_storeu_ps(destination + i, _mm256_add_ps(value, _mm256_mul_ps(weight8, _mm256_loadu_ps(delta + i))));
+    }
+    return i;
+}
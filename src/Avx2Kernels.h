@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "SkinningKernel.h"
+
+// /arch:AVX2로 따로 컴파일하는 SIMD 커널 (나머지 프로젝트는 SSE2 기준)
+// CpuFeatures::HasAvx2()가 true일 때만 호출해야 하며, 변환 함수는 8개 단위로 처리한 요소 수를 반환한다 (나머지는 호출 측이 처리)
+// 구현 파일에서는 DirectXMath 등 다른 번역 단위와 공유하는 인라인 함수를 호출하지 않는다 (AVX2 코드가 링커를 통해 섞이지 않도록)
+class Avx2Kernels
+{
+public:
+    // SkinningKernel::Skin의 AVX2 버전 (행렬 하나를 256비트 레지스터 두 개로 섞음)
+    static void Skin(const SkinningKernel::JointMatrix* palette, uint32_t jointCount, const SkinningKernel::Layout& layout,
+        const void* source, void* destination, size_t begin, size_t end);
+
+    // 정수 -> float 변환 (value * scale, 부호 있는 타입은 minimum 아래로 내려가지 않음)
+    static size_t ConvertUInt8(const unsigned char* source, size_t count, float scale, float* destination);
+    static size_t ConvertInt8(const unsigned char* source, size_t count, float scale, float minimum, float* destination);
+    static size_t ConvertUInt16(const unsigned char* source, size_t count, float scale, float* destination);
+    static size_t ConvertInt16(const unsigned char* source, size_t count, float scale, float minimum, float* destination);
+
+    // 부호 없는 정수 -> uint32 확장
+    static size_t WidenUInt8(const unsigned char* source, size_t count, uint32_t* destination);
+    static size_t WidenUInt16(const unsigned char* source, size_t count, uint32_t* destination);
+
+    // destination[i] += weight * delta[i]
+    static size_t Accumulate(float* destination, const float* delta, float weight, size_t count);
+};
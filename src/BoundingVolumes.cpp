@@ -0,0 +1,185 @@
+#include "BoundingVolumes.h"
+
+namespace
+{
+    bool SameVector(const XMFLOAT3& first, const XMFLOAT3& second)
+    {
+        return first.x == second.x && first.y == second.y && first.z == second.z;
+    }
+
+    XMVECTOR LoadPosition(const uint8_t* base, size_t stride, size_t index)
+    {
+        return XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(base + index * stride));
+    }
+}
+
+BoundingBox BoundingVolumes::FromPositions(const XMFLOAT3* positions, size_t stride, size_t count)
+{
+    if (!positions || count == 0)
+    {
+        return FromMinMax(XMVectorZero(), XMVectorZero());
+    }
+
+    // 누적값을 네 쌍으로 나눠서 min/max 의존 사슬이 겹쳐 실행되도록 함
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(positions);
+    XMVECTOR first = LoadPosition(base, stride, 0);
+    XMVECTOR min0 = first, min1 = first, min2 = first, min3 = first;
+    XMVECTOR max0 = first, max1 = first, max2 = first, max3 = first;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        XMVECTOR p0 = LoadPosition(base, stride, i);
+        XMVECTOR p1 = LoadPosition(base, stride, i + 1);
+        XMVECTOR p2 = LoadPosition(base, stride, i + 2);
+        XMVECTOR p3 = LoadPosition(base, stride, i + 3);
+        min0 = XMVectorMin(min0, p0);
+        max0 = XMVectorMax(max0, p0);
+        min1 = XMVectorMin(min1, p1);
+        max1 = XMVectorMax(max1, p1);
+        min2 = XMVectorMin(min2, p2);
+        max2 = XMVectorMax(max2, p2);
+        min3 = XMVectorMin(min3, p3);
+        max3 = XMVectorMax(max3, p3);
+    }
+    for (; i < count; i++)
+    {
+        XMVECTOR p = LoadPosition(base, stride, i);
+        min0 = XMVectorMin(min0, p);
+        max0 = XMVectorMax(max0, p);
+    }
+
+    XMVECTOR boxMin = XMVectorMin(XMVectorMin(min0, min1), XMVectorMin(min2, min3));
+    XMVECTOR boxMax = XMVectorMax(XMVectorMax(max0, max1), XMVectorMax(max2, max3));
+    return FromMinMax(boxMin, boxMax);
+}
+
+BoundingBox BoundingVolumes::FromMinMax(FXMVECTOR boxMin, FXMVECTOR boxMax)
+{
+    BoundingBox box;
+    XMStoreFloat3(&box.min, boxMin);
+    XMStoreFloat3(&box.max, boxMax);
+    XMStoreFloat3(&box.center, XMVectorScale(XMVectorAdd(boxMin, boxMax), 0.5f));
+    box.radius = XMVectorGetX(XMVector3Length(XMVectorSubtract(boxMax, boxMin))) * 0.5f;
+    return box;
+}
+
+BoundingBox BoundingVolumes::Merge(const BoundingBox& first, const BoundingBox& second)
+{
+    return FromMinMax(
+        XMVectorMin(XMLoadFloat3(&first.min), XMLoadFloat3(&second.min)),
+        XMVectorMax(XMLoadFloat3(&first.max), XMLoadFloat3(&second.max)));
+}
+
+BoundingBox BoundingVolumes::Transform(const BoundingBox& box, FXMMATRIX transform)
+{
+    XMVECTOR boxMin = XMLoadFloat3(&box.min);
+    XMVECTOR boxMax = XMLoadFloat3(&box.max);
+    XMVECTOR center = XMVector3Transform(XMVectorScale(XMVectorAdd(boxMin, boxMax), 0.5f), transform);
+    XMVECTOR extents = XMVectorScale(XMVectorSubtract(boxMax, boxMin), 0.5f);
+
+    // 월드 축마다 박스 축 세 개의 기여를 절댓값으로 더함
+    XMVECTOR worldExtents = XMVectorAdd(XMVectorAdd(
+        XMVectorMultiply(XMVectorAbs(transform.r[0]), XMVectorSplatX(extents)),
+        XMVectorMultiply(XMVectorAbs(transform.r[1]), XMVectorSplatY(extents))),
+        XMVectorMultiply(XMVectorAbs(transform.r[2]), XMVectorSplatZ(extents)));
+
+    return FromMinMax(XMVectorSubtract(center, worldExtents), XMVectorAdd(center, worldExtents));
+}
+
+OrientedBoundingBox BoundingVolumes::TransformOriented(const BoundingBox& box, FXMMATRIX transform)
+{
+    XMVECTOR boxMin = XMLoadFloat3(&box.min);
+    XMVECTOR boxMax = XMLoadFloat3(&box.max);
+    XMVECTOR extents = XMVectorScale(XMVectorSubtract(boxMax, boxMin), 0.5f);
+
+    OrientedBoundingBox oriented;
+    XMStoreFloat3(&oriented.center, XMVector3Transform(XMVectorScale(XMVectorAdd(boxMin, boxMax), 0.5f), transform));
+
+    // 행렬의 각 행이 박스 축 - 길이는 크기 조정이므로 절반 길이에 곱하고 축은 정규화
+    float lengths[3];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        XMVECTOR row = transform.r[axis];
+        lengths[axis] = XMVectorGetX(XMVector3Length(row));
+        XMStoreFloat3(&oriented.axes[axis], lengths[axis] > 0.0f ? XMVectorScale(row, 1.0f / lengths[axis]) : XMVectorZero());
+    }
+    oriented.extents = XMFLOAT3(XMVectorGetX(extents) * lengths[0], XMVectorGetY(extents) * lengths[1],
+        XMVectorGetZ(extents) * lengths[2]);
+    return oriented;
+}
+
+XMMATRIX BoundingVolumes::InstanceMatrix(const XMFLOAT3& position, const XMFLOAT3& rotation, const XMFLOAT3& scale)
+{
+    XMMATRIX scaling = XMMatrixScaling(scale.x, scale.y, scale.z);
+    XMMATRIX rotating = XMMatrixRotationRollPitchYaw(
+        XMConvertToRadians(rotation.x),
+        XMConvertToRadians(rotation.y),
+        XMConvertToRadians(rotation.z));
+    XMMATRIX translation = XMMatrixTranslation(position.x, position.y, position.z);
+    return scaling * rotating * translation;
+}
+
+BoundingVolumes::Frustum BoundingVolumes::ExtractFrustum(FXMMATRIX viewProjection)
+{
+    // 행 벡터 규약의 클립 좌표 = 점 * 행렬 이므로 평면은 전치 행렬의 행 조합
+    XMMATRIX columns = XMMatrixTranspose(viewProjection);
+    XMVECTOR planes[6] = {
+        XMVectorAdd(columns.r[3], columns.r[0]),      // 왼쪽
+        XMVectorSubtract(columns.r[3], columns.r[0]), // 오른쪽
+        XMVectorAdd(columns.r[3], columns.r[1]),      // 아래
+        XMVectorSubtract(columns.r[3], columns.r[1]), // 위
+        columns.r[2],                                 // 가까운 평면 (깊이 0)
+        XMVectorSubtract(columns.r[3], columns.r[2])  // 먼 평면
+    };
+
+    Frustum frustum;
+    for (int i = 0; i < 6; i++)
+    {
+        XMStoreFloat4(&frustum.Planes[i], XMPlaneNormalize(planes[i]));
+    }
+    return frustum;
+}
+
+bool BoundingVolumes::Intersects(const Frustum& frustum, const BoundingBox& box)
+{
+    for (const XMFLOAT4& plane : frustum.Planes)
+    {
+        // 평면 법선 방향으로 가장 멀리 있는 꼭짓점이 바깥이면 박스 전체가 바깥
+        float x = plane.x >= 0.0f ? box.max.x : box.min.x;
+        float y = plane.y >= 0.0f ? box.max.y : box.min.y;
+        float z = plane.z >= 0.0f ? box.max.z : box.min.z;
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BoundingVolumes::Intersects(const BoundingBox& first, const BoundingBox& second)
+{
+    return first.min.x <= second.max.x && first.max.x >= second.min.x &&
+        first.min.y <= second.max.y && first.max.y >= second.min.y &&
+        first.min.z <= second.max.z && first.max.z >= second.min.z;
+}
+
+void InstanceBounds::Update(const BoundingBox& localBounds, const XMFLOAT3& newPosition, const XMFLOAT3& newRotation,
+    const XMFLOAT3& newScale)
+{
+    if (version > 0 && SameVector(position, newPosition) && SameVector(rotation, newRotation) &&
+        SameVector(scale, newScale) && SameVector(local.min, localBounds.min) && SameVector(local.max, localBounds.max))
+    {
+        return;
+    }
+
+    local = localBounds;
+    position = newPosition;
+    rotation = newRotation;
+    scale = newScale;
+
+    XMMATRIX transform = BoundingVolumes::InstanceMatrix(position, rotation, scale);
+    world = BoundingVolumes::Transform(local, transform);
+    oriented = BoundingVolumes::TransformOriented(local, transform);
+    version++;
+}
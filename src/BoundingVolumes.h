@@ -0,0 +1,81 @@
+#pragma once
+#include "Common.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 방향 있는 바운딩 박스 (로컬 박스를 인스턴스의 크기/회전/이동으로 옮긴 박스)
+struct OrientedBoundingBox {
+    XMFLOAT3 center;  // 월드 공간 중심
+    XMFLOAT3 extents; // 박스 축 방향 절반 길이 (크기 조정 포함)
+    XMFLOAT3 axes[3]; // 월드 공간의 박스 축 (단위 벡터)
+};
+
+// 바운딩 볼륨 계산 (디바이스 없이 동작)
+class BoundingVolumes
+{
+public:
+    // 시야 절두체 평면 6개 (ax + by + cz + d >= 0 이 안쪽)
+    struct Frustum
+    {
+        XMFLOAT4 Planes[6];
+    };
+
+    // 버텍스 배열 위치의 축 정렬 박스 - 누적값 네 쌍으로 DirectXMath(SSE2) min/max를 겹쳐 실행 (비어 있으면 원점의 0 크기 박스)
+    static BoundingBox FromPositions(const XMFLOAT3* positions, size_t stride, size_t count);
+
+    // Position 멤버가 있는 버텍스 배열의 축 정렬 박스
+    template <typename Vertex>
+    static BoundingBox FromVertices(const std::vector<Vertex>& vertices)
+    {
+        return FromPositions(vertices.empty() ? nullptr : &vertices[0].Position, sizeof(Vertex), vertices.size());
+    }
+
+    // 최소/최대 점으로 중심과 반지름까지 채운 박스
+    static BoundingBox FromMinMax(FXMVECTOR boxMin, FXMVECTOR boxMax);
+
+    // 두 박스를 감싸는 박스
+    static BoundingBox Merge(const BoundingBox& first, const BoundingBox& second);
+
+    // 변환한 박스를 감싸는 축 정렬 박스 (꼭짓점 8개 대신 중심 변환 + 행렬 절댓값 * 절반 크기)
+    static BoundingBox Transform(const BoundingBox& box, FXMMATRIX transform);
+
+    // 변환한 박스 그대로의 방향 있는 박스
+    static OrientedBoundingBox TransformOriented(const BoundingBox& box, FXMMATRIX transform);
+
+    // 인스턴스 월드 행렬 (크기 -> 회전(도, roll-pitch-yaw) -> 이동, 모델 렌더링과 같은 순서)
+    static XMMATRIX InstanceMatrix(const XMFLOAT3& position, const XMFLOAT3& rotation, const XMFLOAT3& scale);
+
+    // 뷰 * 투영 행렬에서 절두체 평면 추출 (왼손 좌표계, 깊이 0 ~ 1)
+    static Frustum ExtractFrustum(FXMMATRIX viewProjection);
+
+    // 박스가 절두체와 겹치는지 (평면마다 가장 안쪽 꼭짓점만 검사하므로 경계 근처는 보수적으로 겹침 처리)
+    static bool Intersects(const Frustum& frustum, const BoundingBox& box);
+
+    // 두 축 정렬 박스가 겹치는지
+    static bool Intersects(const BoundingBox& first, const BoundingBox& second);
+};
+
+// 인스턴스 월드 바운딩 볼륨 캐시
+// 변환(위치/회전/크기)이나 에셋의 로컬 박스가 마지막 계산과 다를 때만 월드 AABB/OBB를 다시 계산
+class InstanceBounds
+{
+public:
+    void Update(const BoundingBox& local, const XMFLOAT3& position, const XMFLOAT3& rotation, const XMFLOAT3& scale);
+
+    const BoundingBox& GetWorld() const { return world; }
+    const OrientedBoundingBox& GetOriented() const { return oriented; }
+
+    // 다시 계산할 때마다 증가 (0은 아직 계산하지 않음) - 월드 박스를 복사해 둔 쪽에서 바뀌었는지 비교용
+    uint64_t GetVersion() const { return version; }
+
+private:
+    BoundingBox local = {};
+    XMFLOAT3 position = {};
+    XMFLOAT3 rotation = {};
+    XMFLOAT3 scale = {};
+
+    BoundingBox world = {};
+    OrientedBoundingBox oriented = {};
+    uint64_t version = 0;
+};
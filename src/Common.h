@@ -10,3 +10,11 @@ struct BoundingBox {
     XMFLOAT3 center; // 중심점
     float radius;    // 경계 구의 반지름
 };
+
+// 인스턴스별 재질 덮어쓰기 (hover, 선택, 고스트 미리보기)
+// 공유 재질은 건드리지 않고 그릴 때 상수 버퍼에만 적용
+struct MaterialOverride {
+    XMFLOAT4 tint = { 1.0f, 1.0f, 1.0f, 1.0f }; // 재질 색에 곱하는 색 (a는 투명도)
+    XMFLOAT3 highlight = { 0.0f, 0.0f, 0.0f };  // 조명 결과에 더하는 강조 색
+    float emissiveBoost = 1.0f;                 // 자체 발광 배율 (OBJ는 앰비언트에 적용)
+};
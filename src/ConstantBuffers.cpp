@@ -0,0 +1,98 @@
+#include "ConstantBuffers.h"
+
+namespace
+{
+    // 렌더링 스레드에서만 갱신하므로 잠금 없이 사용
+    ConstantBuffers::FrameStats currentFrame;
+    ConstantBuffers::FrameStats lastFrame;
+}
+
+uint64_t ConstantBuffers::FrameStats::GetTotalUpdates() const
+{
+    uint64_t total = 0;
+    for (uint64_t count : Updates)
+    {
+        total += count;
+    }
+    return total;
+}
+
+uint64_t ConstantBuffers::FrameStats::GetTotalBytes() const
+{
+    uint64_t total = 0;
+    for (uint64_t bytes : Bytes)
+    {
+        total += bytes;
+    }
+    return total;
+}
+
+bool ConstantBuffers::Create(ID3D11Device* device, UINT size, ID3D11Buffer** buffer)
+{
+    // 상수 버퍼 크기는 16바이트 배수여야 함
+    D3D11_BUFFER_DESC cbDesc;
+    ZeroMemory(&cbDesc, sizeof(cbDesc));
+    cbDesc.Usage = D3D11_USAGE_DEFAULT;
+    cbDesc.ByteWidth = (size + 15) & ~15u;
+    cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    HRESULT hr = device->CreateBuffer(&cbDesc, nullptr, buffer);
+    if (FAILED(hr))
+    {
+        OutputDebugStringA("상수 버퍼 생성 실패\n");
+        return false;
+    }
+    return true;
+}
+
+bool ConstantBuffers::Update(ID3D11DeviceContext* deviceContext, ID3D11Buffer** buffer, const void* data, UINT size,
+    Frequency frequency)
+{
+    if (!*buffer)
+    {
+        ID3D11Device* device = nullptr;
+        deviceContext->GetDevice(&device);
+        bool created = device && Create(device, size, buffer);
+        if (device)
+        {
+            device->Release();
+        }
+        if (!created)
+        {
+            return false;
+        }
+    }
+
+    deviceContext->UpdateSubresource(*buffer, 0, nullptr, data, 0, 0);
+    currentFrame.Updates[frequency]++;
+    currentFrame.Bytes[frequency] += size;
+    return true;
+}
+
+ObjectConstants ConstantBuffers::MakeObjectConstants(FXMMATRIX world, const MaterialOverride& materialOverride)
+{
+    ObjectConstants constants;
+    constants.world = XMMatrixTranspose(world);
+    constants.overrideTint = materialOverride.tint;
+    constants.overrideHighlight = XMFLOAT4(materialOverride.highlight.x, materialOverride.highlight.y,
+        materialOverride.highlight.z, materialOverride.emissiveBoost);
+    return constants;
+}
+
+void ConstantBuffers::RecordDraw(UINT materialSize)
+{
+    // 분리 전에는 그리기마다 월드/뷰/투영 + 재질 + 인스턴스 덮어쓰기를 한 버퍼로 올렸음
+    currentFrame.Draws++;
+    currentFrame.LegacyUpdates++;
+    currentFrame.LegacyBytes += sizeof(ObjectConstants) + sizeof(XMMATRIX) * 2 + materialSize;
+}
+
+void ConstantBuffers::EndFrame()
+{
+    lastFrame = currentFrame;
+    currentFrame = FrameStats();
+}
+
+const ConstantBuffers::FrameStats& ConstantBuffers::GetLastFrame()
+{
+    return lastFrame;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <d3d11.h>
+#include <cstdint>
+#include "Common.h"
+
+// 프레임별 상수 (b2) - 프레임마다 한 번 올리고 모든 모델 셰이더가 공유
+struct FrameConstants {
+    XMMATRIX view;
+    XMMATRIX projection;
+    XMFLOAT4 cameraPosition; // w는 사용하지 않음
+};
+
+// 오브젝트별 상수 (b0) - 인스턴스(GLB는 노드)마다 올림
+struct ObjectConstants {
+    XMMATRIX world;
+    XMFLOAT4 overrideTint;      // 인스턴스 색상 배율 (a는 투명도)
+    XMFLOAT4 overrideHighlight; // 인스턴스 강조 색 (a는 앰비언트/자체 발광 배율)
+};
+
+// 갱신 빈도별로 나눈 상수 버퍼의 생성과 업로드
+// 모든 업로드가 Update를 거치므로 프레임마다 횟수와 바이트를 기록하고,
+// 분리 전 방식(그리기마다 뷰/투영 + 재질 + 인스턴스 값을 한 버퍼로 올림)의 양과 비교
+class ConstantBuffers
+{
+public:
+    // 모델 셰이더 공통 슬롯 (b1은 LightManager의 조명 버퍼)
+    enum Slot : UINT
+    {
+        SLOT_OBJECT = 0,
+        SLOT_LIGHT = 1,
+        SLOT_FRAME = 2,
+        SLOT_MATERIAL = 3
+    };
+
+    // 갱신 빈도
+    enum Frequency
+    {
+        FREQUENCY_FRAME,
+        FREQUENCY_MATERIAL,
+        FREQUENCY_OBJECT,
+        FREQUENCY_COUNT
+    };
+
+    // 한 프레임 동안의 상수 버퍼 업로드 기록
+    struct FrameStats
+    {
+        uint64_t Draws = 0;
+        uint64_t Updates[FREQUENCY_COUNT] = {};
+        uint64_t Bytes[FREQUENCY_COUNT] = {};
+        uint64_t LegacyUpdates = 0; // 분리 전 방식이었다면 올렸을 횟수 (그리기마다 한 번)
+        uint64_t LegacyBytes = 0;
+
+        uint64_t GetTotalUpdates() const;
+        uint64_t GetTotalBytes() const;
+    };
+
+    // 기본 사용 상수 버퍼 생성 (UpdateSubresource로 갱신)
+    static bool Create(ID3D11Device* device, UINT size, ID3D11Buffer** buffer);
+
+    // 상수 버퍼에 올리고 기록 (버퍼가 없으면 컨텍스트의 디바이스로 먼저 생성)
+    static bool Update(ID3D11DeviceContext* deviceContext, ID3D11Buffer** buffer, const void* data, UINT size,
+        Frequency frequency);
+
+    // 인스턴스 변환과 재질 덮어쓰기로 오브젝트별 상수 채우기
+    static ObjectConstants MakeObjectConstants(FXMMATRIX world, const MaterialOverride& materialOverride);
+
+    // 그리기 한 번 기록 (materialSize는 셰이더의 재질 블록 크기 - 분리 전 업로드 양 계산용)
+    static void RecordDraw(UINT materialSize);
+
+    // 현재 프레임 기록을 마치고 새 프레임 시작 (렌더링 스레드에서만 호출)
+    static void EndFrame();
+
+    // 마지막으로 마친 프레임의 기록
+    static const FrameStats& GetLastFrame();
+};
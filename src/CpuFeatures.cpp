@@ -0,0 +1,48 @@
+#include "CpuFeatures.h"
+#include <intrin.h>
+#include <windows.h>
+
+namespace
+{
+    bool DetectAvx2()
+    {
+        int registers[4] = {};
+        __cpuid(registers, 0);
+        if (registers[0] < 7)
+        {
+            return false;
+        }
+
+        // AVX + OSXSAVE, 그리고 OS가 XMM/YMM 상태를 저장하는지 (XCR0 비트 1, 2)
+        __cpuid(registers, 1);
+        const int osxsave = 1 << 27;
+        const int avx = 1 << 28;
+        if ((registers[2] & (osxsave | avx)) != (osxsave | avx) || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        // AVX2 (leaf 7, EBX 비트 5)
+        __cpuidex(registers, 7, 0);
+        return (registers[1] & (1 << 5)) != 0;
+    }
+
+    bool SelectAvx2()
+    {
+        bool supported = DetectAvx2();
+        OutputDebugStringA(supported ? "SIMD kernels: AVX2 (runtime dispatch)\n" :
+            "SIMD kernels: SSE2 (AVX2 not supported by this CPU/OS)\n");
+        return supported;
+    }
+}
+
+bool CpuFeatures::HasAvx2()
+{
+    static const bool avx2 = SelectAvx2();
+    return avx2;
+}
+
+const char* CpuFeatures::GetInstructionSetName()
+{
+    return HasAvx2() ? "AVX2" : "SSE2";
+}
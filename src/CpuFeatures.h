@@ -0,0 +1,13 @@
+#pragma once
+
+// 실행 중인 CPU의 SIMD 명령어 집합 확인 (처음 호출할 때 한 번만 검사하고 선택 결과를 디버그 출력)
+// 프로젝트는 SSE2 기준으로 빌드하고, AVX2 커널(Avx2Kernels)은 여기서 지원을 확인한 뒤에만 호출한다
+class CpuFeatures
+{
+public:
+    // CPU가 AVX2를 지원하고 OS가 YMM 레지스터를 저장하는지
+    static bool HasAvx2();
+
+    // 선택된 커널 명령어 집합 ("AVX2" 또는 "SSE2", 로그용)
+    static const char* GetInstructionSetName();
+};
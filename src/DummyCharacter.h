@@ -46,6 +46,10 @@ public:
     // 간단한 충돌 체크
     bool CheckCollision(const XMFLOAT3& newPosition, float roomWidth, float roomHeight, float roomDepth);
 
+    // 충돌 크기 (위치는 발 기준, 반경과 키)
+    float GetRadius() const { return radius; }
+    float GetHeight() const { return height; }
+
 private:
     // 캐릭터 데이터
     XMFLOAT3 position;     // 캐릭터 위치
@@ -0,0 +1,195 @@
+#include "GlbFile.h"
+#include <algorithm>
+#include <cstring>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+    const uint32_t glbMagic = 0x46546C67;  // "glTF"
+    const uint32_t chunkJson = 0x4E4F534A; // "JSON"
+    const uint32_t chunkBin = 0x004E4942;  // "BIN\0"
+
+    // bufferView 이미지를 tinygltf가 읽지 않도록 바꿔 넣는 외부 URI (외부 이미지는 로드하지 않음)
+    const char* imagePlaceholderUri = "glb-bufferview-image";
+
+    inline uint32_t Load32(const unsigned char* p)
+    {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline void Append32(std::string& out, uint32_t value)
+    {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+GlbFile::GlbFile()
+{
+}
+
+bool GlbFile::Load(const std::string& filename, tinygltf::TinyGLTF& loader, tinygltf::Model& model,
+    std::string& err, std::string& warn)
+{
+    return Open(filename, err) && Parse(loader, model, err, warn);
+}
+
+bool GlbFile::Open(const std::string& filename, std::string& err)
+{
+    Close();
+    path = filename;
+
+    if (!file.Open(filename))
+    {
+        err = "Failed to map GLB file: " + filename;
+        return false;
+    }
+
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(file.GetData());
+    size_t size = file.GetSize();
+
+    // 헤더 (magic, version, length) + 첫 번째 청크 헤더
+    if (size < 20 || Load32(data) != glbMagic || Load32(data + 4) != 2 || Load32(data + 8) > size)
+    {
+        err = "Invalid GLB header: " + filename;
+        Close();
+        return false;
+    }
+
+    size_t glbLength = Load32(data + 8);
+    size_t jsonLength = Load32(data + 12);
+    if (Load32(data + 16) != chunkJson || 20 + jsonLength > glbLength)
+    {
+        err = "Invalid GLB JSON chunk: " + filename;
+        Close();
+        return false;
+    }
+
+    // BIN 청크 (선택) - 청크는 4바이트 단위로 정렬됨
+    size_t binOffset = 20 + ((jsonLength + 3) & ~static_cast<size_t>(3));
+    if (binOffset + 8 <= glbLength && Load32(data + binOffset + 4) == chunkBin)
+    {
+        size_t binLength = Load32(data + binOffset);
+        if (binOffset + 8 + binLength <= glbLength)
+        {
+            binData = data + binOffset + 8;
+            binSize = binLength;
+        }
+    }
+
+    jsonChunk = reinterpret_cast<const char*>(data + 20);
+    jsonChunkSize = jsonLength;
+    return true;
+}
+
+bool GlbFile::Parse(tinygltf::TinyGLTF& loader, tinygltf::Model& model, std::string& err, std::string& warn)
+{
+    if (!jsonChunk)
+    {
+        err = "GLB file is not open";
+        return false;
+    }
+
+    const std::string& filename = path;
+    const char* jsonData = jsonChunk;
+    nlohmann::json document = nlohmann::json::parse(jsonData, jsonData + jsonChunkSize, nullptr, false);
+    if (document.is_discarded() || !document.is_object())
+    {
+        err = "Failed to parse GLB JSON chunk: " + filename;
+        Close();
+        return false;
+    }
+
+    // uri가 없는 버퍼(BIN 청크)는 1바이트로 줄여서 tinygltf가 복사하지 않도록 함
+    size_t binByteLength = 0;
+    auto buffersIt = document.find("buffers");
+    if (binData && buffersIt != document.end() && buffersIt->is_array())
+    {
+        for (size_t i = 0; i < buffersIt->size(); i++)
+        {
+            nlohmann::json& buffer = (*buffersIt)[i];
+            if (buffer.is_object() && !buffer.contains("uri"))
+            {
+                binByteLength = buffer.value("byteLength", static_cast<size_t>(0));
+                buffer["byteLength"] = 1;
+                binBufferIndex = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+
+    // bufferView 이미지는 자리표시 URI로 바꾸고 파싱 후 복원 (이미지 인덱스 유지)
+    std::vector<int> imageBufferViews;
+    std::vector<std::string> imageMimeTypes;
+    auto imagesIt = document.find("images");
+    if (imagesIt != document.end() && imagesIt->is_array())
+    {
+        for (auto& image : *imagesIt)
+        {
+            int bufferView = -1;
+            std::string mimeType;
+            if (image.is_object() && image.contains("bufferView") && image["bufferView"].is_number_integer())
+            {
+                bufferView = image["bufferView"].get<int>();
+                mimeType = image.value("mimeType", std::string());
+                image.erase("bufferView");
+                image["uri"] = imagePlaceholderUri;
+            }
+            imageBufferViews.push_back(bufferView);
+            imageMimeTypes.push_back(mimeType);
+        }
+    }
+
+    // JSON 청크와 4바이트 BIN 청크만 있는 작은 GLB를 만들어서 tinygltf에 전달
+    std::string json = document.dump();
+    json.append((4 - json.size() % 4) % 4, ' ');
+
+    std::string glb;
+    glb.reserve(12 + 8 + json.size() + 8 + 4);
+    Append32(glb, glbMagic);
+    Append32(glb, 2);
+    Append32(glb, static_cast<uint32_t>(12 + 8 + json.size() + 8 + 4));
+    Append32(glb, static_cast<uint32_t>(json.size()));
+    Append32(glb, chunkJson);
+    glb += json;
+    Append32(glb, 4);
+    Append32(glb, chunkBin);
+    Append32(glb, 0);
+
+    std::string baseDir = filename.substr(0, filename.find_last_of("/\\") + 1);
+    if (!loader.LoadBinaryFromMemory(&model, &err, &warn,
+        reinterpret_cast<const unsigned char*>(glb.data()), static_cast<unsigned int>(glb.size()), baseDir))
+    {
+        Close();
+        return false;
+    }
+
+    // 이미지 bufferView 복원
+    for (size_t i = 0; i < model.images.size() && i < imageBufferViews.size(); i++)
+    {
+        if (imageBufferViews[i] >= 0)
+        {
+            model.images[i].bufferView = imageBufferViews[i];
+            model.images[i].mimeType = imageMimeTypes[i];
+            model.images[i].uri.clear();
+        }
+    }
+
+    if (binBufferIndex >= 0)
+    {
+        binSize = (std::min)(binSize, binByteLength);
+    }
+
+    return true;
+}
+
+void GlbFile::Close()
+{
+    file.Close();
+    binData = nullptr;
+    binSize = 0;
+    binBufferIndex = -1;
+    jsonChunk = nullptr;
+    jsonChunkSize = 0;
+}
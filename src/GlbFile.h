@@ -0,0 +1,46 @@
+#pragma once
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+// 구현 매크로 없이 tinygltf를 포함
+#include "tiny_gltf.h"
+
+// 메모리 매핑된 GLB 파일
+// JSON 청크만 tinygltf로 파싱하고, BIN 청크는 복사하지 않고 매핑된 메모리를 그대로 참조한다
+// 접근자와 이미지 데이터를 모두 읽을 때까지만 열어두고 닫는다
+class GlbFile
+{
+public:
+    GlbFile();
+
+    // GLB 파일을 매핑하고 JSON 청크를 파싱
+    // BIN 청크를 쓰는 버퍼와 bufferView 이미지는 model에 데이터 없이 들어가므로 GetBinData로 읽어야 함
+    bool Load(const std::string& filename, tinygltf::TinyGLTF& loader, tinygltf::Model& model,
+        std::string& err, std::string& warn);
+
+    // Load를 두 단계로 나눠서 실행 (가져오기 파이프라인의 읽기/파싱 단계)
+    // Open: 파일 매핑과 헤더 검사, Parse: Open한 파일의 JSON 청크 파싱
+    bool Open(const std::string& filename, std::string& err);
+    bool Parse(tinygltf::TinyGLTF& loader, tinygltf::Model& model, std::string& err, std::string& warn);
+
+    // 매핑 해제
+    void Close();
+
+    // 매핑된 BIN 청크 (없으면 nullptr)
+    const unsigned char* GetBinData() const { return binData; }
+    size_t GetBinSize() const { return binSize; }
+
+    // BIN 청크를 사용하는 버퍼 인덱스 (-1은 없음)
+    int GetBinBufferIndex() const { return binBufferIndex; }
+
+    size_t GetFileSize() const { return file.GetSize(); }
+
+private:
+    MappedFile file;
+    std::string path;
+    const char* jsonChunk = nullptr;
+    size_t jsonChunkSize = 0;
+    const unsigned char* binData = nullptr;
+    size_t binSize = 0;
+    int binBufferIndex = -1;
+};
@@ -0,0 +1,470 @@
+#include "GltfAccessor.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLTF_ACCESSOR_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "Avx2Kernels.h"
+#include "CpuFeatures.h"
+
+namespace
+{
+    // 한 번에 모아서 변환하는 요소 수 (MAT4 기준 스크래치가 L1에 들어가는 크기)
+    const size_t blockElements = 64;
+    const int maxComponents = 16;
+
+    template <typename T>
+    inline T LoadScalar(const unsigned char* p)
+    {
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    // 스칼라 변환 (SIMD 처리 후 남은 요소)
+    template <typename Source, typename Destination>
+    void ConvertTail(const unsigned char* source, size_t begin, size_t count, Destination* destination,
+        float scale, bool clampNegative)
+    {
+        for (size_t i = begin; i < count; i++)
+        {
+            float value = static_cast<float>(LoadScalar<Source>(source + i * sizeof(Source))) * scale;
+            destination[i] = static_cast<Destination>(clampNegative ? (std::max)(value, -1.0f) : value);
+        }
+    }
+
+    template <typename Source>
+    void WidenTail(const unsigned char* source, size_t begin, size_t count, uint32_t* destination)
+    {
+        for (size_t i = begin; i < count; i++)
+        {
+            destination[i] = static_cast<uint32_t>(LoadScalar<Source>(source + i * sizeof(Source)));
+        }
+    }
+
+    // 부동소수점 변환 커널 - source는 구성 요소가 빈틈없이 나열된 스트림
+    void ConvertToFloat(const unsigned char* source, int componentType, bool normalized, size_t count, float* destination)
+    {
+        size_t i = 0;
+
+        switch (componentType)
+        {
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            memcpy(destination, source, count * sizeof(float));
+            break;
+
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        {
+            float scale = normalized ? 1.0f / 255.0f : 1.0f;
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::ConvertUInt8(source, count, scale, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128 scale4 = _mm_set1_ps(scale);
+                __m128i zero = _mm_setzero_si128();
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                    __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                    __m128i high = _mm_unpackhi_epi8(bytes, zero);
+                    _mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale4));
+                    _mm_storeu_ps(destination + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale4));
+                    _mm_storeu_ps(destination + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale4));
+                    _mm_storeu_ps(destination + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale4));
+                }
+            }
+#endif
+            ConvertTail<uint8_t>(source, i, count, destination, scale, false);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+        {
+            // 정규화된 부호 있는 값은 -128이 -1.0 미만이 되지 않도록 고정
+            float scale = normalized ? 1.0f / 127.0f : 1.0f;
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::ConvertInt8(source, count, scale, normalized ? -1.0f : -128.0f, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128 scale4 = _mm_set1_ps(scale);
+                __m128 minusOne4 = _mm_set1_ps(normalized ? -1.0f : -128.0f);
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                    // 부호 확장: 상위 바이트에 복사한 뒤 산술 시프트
+                    __m128i low = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+                    __m128i high = _mm_srai_epi16(_mm_unpackhi_epi8(bytes, bytes), 8);
+                    __m128i words[4] = {
+                        _mm_srai_epi32(_mm_unpacklo_epi16(low, low), 16),
+                        _mm_srai_epi32(_mm_unpackhi_epi16(low, low), 16),
+                        _mm_srai_epi32(_mm_unpacklo_epi16(high, high), 16),
+                        _mm_srai_epi32(_mm_unpackhi_epi16(high, high), 16)
+                    };
+                    for (int k = 0; k < 4; k++)
+                    {
+                        _mm_storeu_ps(destination + i + k * 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(words[k]), scale4), minusOne4));
+                    }
+                }
+            }
+#endif
+            ConvertTail<int8_t>(source, i, count, destination, scale, normalized);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        {
+            float scale = normalized ? 1.0f / 65535.0f : 1.0f;
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::ConvertUInt16(source, count, scale, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128 scale4 = _mm_set1_ps(scale);
+                __m128i zero = _mm_setzero_si128();
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2));
+                    _mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)), scale4));
+                    _mm_storeu_ps(destination + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)), scale4));
+                }
+            }
+#endif
+            ConvertTail<uint16_t>(source, i, count, destination, scale, false);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+        {
+            float scale = normalized ? 1.0f / 32767.0f : 1.0f;
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::ConvertInt16(source, count, scale, normalized ? -1.0f : -32768.0f, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128 scale4 = _mm_set1_ps(scale);
+                __m128 minusOne4 = _mm_set1_ps(normalized ? -1.0f : -32768.0f);
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2));
+                    __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+                    __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+                    _mm_storeu_ps(destination + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(low), scale4), minusOne4));
+                    _mm_storeu_ps(destination + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(high), scale4), minusOne4));
+                }
+            }
+#endif
+            ConvertTail<int16_t>(source, i, count, destination, scale, normalized);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            ConvertTail<uint32_t>(source, 0, count, destination, 1.0f, false);
+            break;
+
+        default:
+            memset(destination, 0, count * sizeof(float));
+            break;
+        }
+    }
+
+    // 부호 없는 정수 변환 커널 (인덱스, 조인트)
+    void ConvertToUInt(const unsigned char* source, int componentType, bool normalized, size_t count, uint32_t* destination)
+    {
+        (void)normalized;
+        size_t i = 0;
+
+        switch (componentType)
+        {
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            memcpy(destination, source, count * sizeof(uint32_t));
+            break;
+
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        {
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::WidenUInt8(source, count, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128i zero = _mm_setzero_si128();
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                    __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                    __m128i high = _mm_unpackhi_epi8(bytes, zero);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 12), _mm_unpackhi_epi16(high, zero));
+                }
+            }
+#endif
+            WidenTail<uint8_t>(source, i, count, destination);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        {
+            if (CpuFeatures::HasAvx2())
+            {
+                i = Avx2Kernels::WidenUInt16(source, count, destination);
+            }
+#if defined(GLTF_ACCESSOR_SSE2)
+            else
+            {
+                __m128i zero = _mm_setzero_si128();
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_unpacklo_epi16(words, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 4), _mm_unpackhi_epi16(words, zero));
+                }
+            }
+#endif
+            WidenTail<uint16_t>(source, i, count, destination);
+            break;
+        }
+
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            for (; i < count; i++)
+            {
+                destination[i] = static_cast<uint32_t>(LoadScalar<float>(source + i * sizeof(float)));
+            }
+            break;
+
+        default:
+            memset(destination, 0, count * sizeof(uint32_t));
+            break;
+        }
+    }
+
+    // 버퍼 뷰 범위 확인 후 첫 요소 주소와 스트라이드 계산
+    bool ResolveBufferView(const tinygltf::Model& model, const std::vector<GltfAccessor::BufferSpan>& buffers,
+        int bufferViewIndex, size_t byteOffset, size_t elementSize, size_t count, bool allowStride,
+        const unsigned char*& data, size_t& stride)
+    {
+        if (bufferViewIndex < 0 || bufferViewIndex >= static_cast<int>(model.bufferViews.size()))
+        {
+            return false;
+        }
+
+        const auto& bufferView = model.bufferViews[bufferViewIndex];
+        if (bufferView.buffer < 0 || bufferView.buffer >= static_cast<int>(buffers.size()))
+        {
+            return false;
+        }
+
+        const GltfAccessor::BufferSpan& buffer = buffers[bufferView.buffer];
+        stride = (allowStride && bufferView.byteStride > 0) ? bufferView.byteStride : elementSize;
+
+        // 마지막 요소 끝이 버퍼 뷰와 버퍼 안에 있어야 함
+        size_t required = count > 0 ? byteOffset + (count - 1) * stride + elementSize : byteOffset;
+        if (required > bufferView.byteLength || bufferView.byteOffset + required > buffer.Size)
+        {
+            return false;
+        }
+
+        data = buffer.Data + bufferView.byteOffset + byteOffset;
+        return true;
+    }
+
+    // 블록 단위 모으기 -> 변환 -> 흩뿌리기
+    template <typename T, typename Convert>
+    size_t Decode(const tinygltf::Model& model, const std::vector<GltfAccessor::BufferSpan>& buffers, int accessorIndex, int components,
+        void* destination, size_t destinationStride, size_t maxCount, Convert convert)
+    {
+        if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size()) || !destination)
+        {
+            return 0;
+        }
+
+        const auto& accessor = model.accessors[accessorIndex];
+        int accessorComponents = tinygltf::GetNumComponentsInType(static_cast<uint32_t>(accessor.type));
+        int componentSize = tinygltf::GetComponentSizeInBytes(static_cast<uint32_t>(accessor.componentType));
+        if (accessorComponents <= 0 || accessorComponents > maxComponents || componentSize <= 0)
+        {
+            return 0;
+        }
+
+        size_t count = (std::min)(accessor.count, maxCount);
+        int copyComponents = (std::min)(components, accessorComponents);
+        size_t elementSize = static_cast<size_t>(accessorComponents) * componentSize;
+        size_t copyBytes = copyComponents * sizeof(T);
+        unsigned char* output = static_cast<unsigned char*>(destination);
+
+        if (accessor.bufferView >= 0)
+        {
+            const unsigned char* source = nullptr;
+            size_t sourceStride = 0;
+            if (!ResolveBufferView(model, buffers, accessor.bufferView, accessor.byteOffset, elementSize, count, true, source, sourceStride))
+            {
+                return 0;
+            }
+
+            bool packedSource = sourceStride == elementSize;
+            bool packedDestination = destinationStride == accessorComponents * sizeof(T) && copyComponents == accessorComponents;
+
+            if (packedSource && packedDestination)
+            {
+                // 원본과 대상이 모두 빈틈없이 나열되어 있으면 바로 변환
+                convert(source, accessor.componentType, accessor.normalized, count * accessorComponents, reinterpret_cast<T*>(output));
+            }
+            else
+            {
+                unsigned char gathered[blockElements * maxComponents * sizeof(uint32_t)];
+                T converted[blockElements * maxComponents];
+
+                for (size_t start = 0; start < count; start += blockElements)
+                {
+                    size_t blockCount = (std::min)(blockElements, count - start);
+
+                    // 스트라이드가 있는 원본은 먼저 연속된 스크래치로 모음
+                    const unsigned char* blockSource = source + start * sourceStride;
+                    if (!packedSource)
+                    {
+                        for (size_t i = 0; i < blockCount; i++)
+                        {
+                            memcpy(gathered + i * elementSize, blockSource + i * sourceStride, elementSize);
+                        }
+                        blockSource = gathered;
+                    }
+
+                    convert(blockSource, accessor.componentType, accessor.normalized, blockCount * accessorComponents, converted);
+
+                    for (size_t i = 0; i < blockCount; i++)
+                    {
+                        memcpy(output + (start + i) * destinationStride, converted + i * accessorComponents, copyBytes);
+                    }
+                }
+            }
+        }
+        else
+        {
+            // 버퍼 뷰가 없는 접근자는 0으로 초기화 (희소 값만 적용)
+            for (size_t i = 0; i < count; i++)
+            {
+                memset(output + i * destinationStride, 0, copyBytes);
+            }
+        }
+
+        // 희소 접근자 - 지정된 요소만 덮어씀
+        const auto& sparse = accessor.sparse;
+        if (sparse.isSparse && sparse.count > 0)
+        {
+            size_t sparseCount = static_cast<size_t>(sparse.count);
+            int indexSize = tinygltf::GetComponentSizeInBytes(static_cast<uint32_t>(sparse.indices.componentType));
+            const unsigned char* indexData = nullptr;
+            const unsigned char* valueData = nullptr;
+            size_t unusedStride = 0;
+
+            if (indexSize <= 0 ||
+                !ResolveBufferView(model, buffers, sparse.indices.bufferView, sparse.indices.byteOffset, indexSize, sparseCount, false, indexData, unusedStride) ||
+                !ResolveBufferView(model, buffers, sparse.values.bufferView, sparse.values.byteOffset, elementSize, sparseCount, false, valueData, unusedStride))
+            {
+                return 0;
+            }
+
+            std::vector<uint32_t> sparseIndices(sparseCount);
+            std::vector<T> sparseValues(sparseCount * accessorComponents);
+            ConvertToUInt(indexData, sparse.indices.componentType, false, sparseCount, sparseIndices.data());
+            convert(valueData, accessor.componentType, accessor.normalized, sparseCount * accessorComponents, sparseValues.data());
+
+            for (size_t i = 0; i < sparseCount; i++)
+            {
+                if (sparseIndices[i] < count)
+                {
+                    memcpy(output + sparseIndices[i] * destinationStride, sparseValues.data() + i * accessorComponents, copyBytes);
+                }
+            }
+        }
+
+        return count;
+    }
+}
+
+GltfAccessor::GltfAccessor(const tinygltf::Model& model) : model(model)
+{
+    buffers.resize(model.buffers.size());
+    for (size_t i = 0; i < model.buffers.size(); i++)
+    {
+        buffers[i].Data = model.buffers[i].data.data();
+        buffers[i].Size = model.buffers[i].data.size();
+    }
+}
+
+void GltfAccessor::SetBufferData(int bufferIndex, const unsigned char* data, size_t size)
+{
+    if (bufferIndex >= 0 && bufferIndex < static_cast<int>(buffers.size()))
+    {
+        buffers[bufferIndex].Data = data;
+        buffers[bufferIndex].Size = size;
+    }
+}
+
+bool GltfAccessor::GetBufferViewData(int bufferViewIndex, const unsigned char*& data, size_t& size) const
+{
+    if (bufferViewIndex < 0 || bufferViewIndex >= static_cast<int>(model.bufferViews.size()))
+    {
+        return false;
+    }
+
+    size_t unusedStride = 0;
+    size = model.bufferViews[bufferViewIndex].byteLength;
+    return ResolveBufferView(model, buffers, bufferViewIndex, 0, size, 1, false, data, unusedStride);
+}
+
+size_t GltfAccessor::GetCount(int accessorIndex) const
+{
+    if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size()))
+    {
+        return 0;
+    }
+    return model.accessors[accessorIndex].count;
+}
+
+int GltfAccessor::GetComponentCount(int accessorIndex) const
+{
+    if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size()))
+    {
+        return 0;
+    }
+    return tinygltf::GetNumComponentsInType(static_cast<uint32_t>(model.accessors[accessorIndex].type));
+}
+
+size_t GltfAccessor::ReadFloats(int accessorIndex, int components, void* destination, size_t destinationStride, size_t maxCount) const
+{
+    return Decode<float>(model, buffers, accessorIndex, components, destination, destinationStride, maxCount, ConvertToFloat);
+}
+
+size_t GltfAccessor::ReadUInts(int accessorIndex, int components, void* destination, size_t destinationStride, size_t maxCount) const
+{
+    return Decode<uint32_t>(model, buffers, accessorIndex, components, destination, destinationStride, maxCount, ConvertToUInt);
+}
+
+bool GltfAccessor::ReadIndices(int accessorIndex, std::vector<uint32_t>& indices) const
+{
+    size_t count = GetCount(accessorIndex);
+    indices.resize(count);
+    size_t decoded = ReadUInts(accessorIndex, 1, indices.data(), sizeof(uint32_t), count);
+    if (decoded != count)
+    {
+        indices.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+// 구현 매크로 없이 tinygltf를 포함
+#include "tiny_gltf.h"
+
+// GLTF 접근자(accessor) 디코딩
+// 스트라이드가 있는 버퍼 뷰를 블록 단위로 모은 뒤 SIMD로 일괄 변환해서 대상 레이아웃에 기록한다
+// 정규화된 BYTE/SHORT 정수 타입과 희소(sparse) 접근자를 지원한다
+class GltfAccessor
+{
+public:
+    // 버퍼 데이터 범위
+    struct BufferSpan
+    {
+        const unsigned char* Data = nullptr;
+        size_t Size = 0;
+    };
+
+    // 기본적으로 model.buffers의 데이터를 참조
+    explicit GltfAccessor(const tinygltf::Model& model);
+
+    // 버퍼 데이터를 외부 메모리로 교체 (메모리 매핑된 GLB BIN 청크 등, 복사하지 않음)
+    void SetBufferData(int bufferIndex, const unsigned char* data, size_t size);
+
+    // 버퍼 뷰 데이터 범위 조회 (이미지 등 접근자를 거치지 않는 데이터)
+    bool GetBufferViewData(int bufferViewIndex, const unsigned char*& data, size_t& size) const;
+
+    // 요소 수 (잘못된 인덱스면 0)
+    size_t GetCount(int accessorIndex) const;
+
+    // 요소 하나의 구성 요소 수 (SCALAR = 1, VEC3 = 3, MAT4 = 16)
+    int GetComponentCount(int accessorIndex) const;
+
+    // 부동소수점으로 디코딩 - 정규화된 정수는 [0, 1] 또는 [-1, 1]로 변환
+    // 요소마다 최대 components개를 destinationStride 간격으로 기록하고, 기록한 요소 수를 반환
+    size_t ReadFloats(int accessorIndex, int components, void* destination, size_t destinationStride, size_t maxCount) const;
+
+    // 부호 없는 정수로 디코딩 (JOINTS_0 등)
+    size_t ReadUInts(int accessorIndex, int components, void* destination, size_t destinationStride, size_t maxCount) const;
+
+    // 인덱스 디코딩 - 8/16/32비트 인덱스를 32비트로 확장
+    bool ReadIndices(int accessorIndex, std::vector<uint32_t>& indices) const;
+
+private:
+    const tinygltf::Model& model;
+    std::vector<BufferSpan> buffers;
+};
@@ -1,8 +1,16 @@
 #include "GltfLoader.h"
+#include "GltfAccessor.h"
+#include "GlbFile.h"
+#include "ThreadPool.h"
 #include <d3dcompiler.h>
 #include <DirectXTex.h>
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <psapi.h>
 #include "WICTextureLoader11.h"
 
 namespace tinygltf {
@@ -22,12 +30,9 @@ namespace tinygltf {
 #define TINYGLTF_NO_STB_IMAGE_WRITE
 #endif
 #include "tiny_gltf.h"
-// 상수 버퍼 구조체 (PBR 셰이딩을 위해 확장)
-struct ConstantBuffer
+// 재질별 상수 버퍼 구조체 (b3) - 뷰/투영은 프레임별(b2), 월드와 인스턴스 덮어쓰기는 오브젝트별(b0) 버퍼
+struct PbrMaterialConstants
 {
-    XMMATRIX World;
-    XMMATRIX View;
-    XMMATRIX Projection;
     XMFLOAT4 BaseColorFactor;
     XMFLOAT3 EmissiveFactor;
     float MetallicFactor;
@@ -37,26 +42,23 @@ struct ConstantBuffer
     float HasNormalTexture;
     float HasEmissiveTexture;
     float HasOcclusionTexture;
-    XMFLOAT3 Padding;
+    XMFLOAT2 Padding;           // HLSL 16바이트 경계에 맞춤
 };
 
 // PBR 버텍스 셰이더 코드
 const char* glbVertexShaderCode = R"(
-cbuffer ConstantBuffer : register(b0)
+cbuffer ObjectConstantBuffer : register(b0)
 {
     matrix World;
+    float4 OverrideTint;
+    float4 OverrideHighlight;
+}
+
+cbuffer FrameConstantBuffer : register(b2)
+{
     matrix View;
     matrix Projection;
-    float4 BaseColorFactor;
-    float3 EmissiveFactor;
-    float MetallicFactor;
-    float RoughnessFactor;
-    float HasBaseColorTexture;
-    float HasMetallicRoughnessTexture;
-    float HasNormalTexture;
-    float HasEmissiveTexture;
-    float HasOcclusionTexture;
-    float3 Padding;
+    float4 CameraPosition;
 }
 
 struct VS_INPUT
@@ -114,11 +116,25 @@ Texture2D emissiveTexture : register(t3);
 Texture2D occlusionTexture : register(t4);
 SamplerState samplerState : register(s0);
 
-cbuffer ConstantBuffer : register(b0)
+// 오브젝트별 상수 버퍼 (b0)
+cbuffer ObjectConstantBuffer : register(b0)
 {
     matrix World;
+    float4 OverrideTint;
+    float4 OverrideHighlight;
+}
+
+// 프레임별 상수 버퍼 (b2)
+cbuffer FrameConstantBuffer : register(b2)
+{
     matrix View;
     matrix Projection;
+    float4 CameraPosition;
+}
+
+// 재질별 상수 버퍼 (b3)
+cbuffer MaterialConstantBuffer : register(b3)
+{
     float4 BaseColorFactor;
     float3 EmissiveFactor;
     float MetallicFactor;
@@ -128,7 +144,7 @@ cbuffer ConstantBuffer : register(b0)
     float HasNormalTexture;
     float HasEmissiveTexture;
     float HasOcclusionTexture;
-    float3 Padding;
+    float2 Padding;
 }
 
 // 조명용 상수 버퍼 (b1)
@@ -244,7 +260,7 @@ float3 CalculatePointLight(float3 normal, float3 worldPos, float3 viewDir, int l
 float4 main(PS_INPUT input) : SV_Target
 {
     // 텍스처에서 값 샘플링
-    float4 baseColor = BaseColorFactor;
+    float4 baseColor = BaseColorFactor * OverrideTint;
     if (HasBaseColorTexture > 0.5)
     {
         baseColor *= baseColorTexture.Sample(samplerState, input.TexCoord);
@@ -262,8 +278,9 @@ float4 main(PS_INPUT input) : SV_Target
     float3 normal = normalize(input.Normal);
     if (HasNormalTexture > 0.5)
     {
-        // 노멀 맵에서 노멀 추출
-        float3 normalSample = normalTexture.Sample(samplerState, input.TexCoord).rgb * 2.0 - 1.0;
+        // 노멀 맵에서 노멀 추출 (BC5 노멀 맵은 XY만 저장하므로 Z는 단위 길이로 복원)
+        float2 normalXY = normalTexture.Sample(samplerState, input.TexCoord).rg * 2.0 - 1.0;
+        float3 normalSample = float3(normalXY, sqrt(saturate(1.0 - dot(normalXY, normalXY))));
         
         // TBN 행렬 생성
         float3 N = normal;
@@ -281,7 +298,7 @@ float4 main(PS_INPUT input) : SV_Target
         ambientOcclusion = occlusionTexture.Sample(samplerState, input.TexCoord).r;
     }
     
-    float3 emissive = EmissiveFactor;
+    float3 emissive = EmissiveFactor * OverrideHighlight.a;
     if (HasEmissiveTexture > 0.5)
     {
         emissive *= emissiveTexture.Sample(samplerState, input.TexCoord).rgb;
@@ -289,7 +306,7 @@ float4 main(PS_INPUT input) : SV_Target
     
     // 간단한 PBR 렌더링 (완전한 PBR은 복잡하므로 여기서는 간략화)
     float3 lightDir = normalize(float3(0.5, 0.5, -0.5));
-    float3 viewDir = normalize(float3(0.0, 0.0, -5.0) - input.WorldPos);
+    float3 viewDir = normalize(CameraPosition.xyz - input.WorldPos);
     float3 halfVector = normalize(lightDir + viewDir);
     
     float3 F0 = float3(0.04, 0.04, 0.04);
@@ -398,6 +415,9 @@ else {
 // 이미시브 추가
 color += emissive;
 
+// 인스턴스 강조 색 추가
+color += OverrideHighlight.rgb;
+
 
     // 감마 보정
     color = color / (color + float3(1.0, 1.0, 1.0));
@@ -407,8 +427,27 @@ color += emissive;
 }
 )";
 
+// 단계별 가져오기 중인 상태 - 읽기 단계에서 만들고 처리 단계가 끝나면 해제
+struct GltfLoader::ImportState
+{
+    std::string Filename;
+    MeshCache* Cache = nullptr;
+    MeshCache::SourceKey CacheKey;
+    bool UseCache = false;
+    bool LoadedFromCache = false;
+    bool IsGlb = false;
+
+    // GLB는 파일을 메모리 매핑하고 BIN 청크를 복사하지 않고 접근자에서 직접 읽음
+    GlbFile File;
+    tinygltf::Model Model;
+
+    std::chrono::high_resolution_clock::time_point LoadStart;
+    std::chrono::high_resolution_clock::time_point ParseEnd;
+};
+
 GltfLoader::GltfLoader()
 {
+    defaultMaterial.Name = "default";
 }
 
 GltfLoader::~GltfLoader()
@@ -416,32 +455,122 @@ GltfLoader::~GltfLoader()
     Release();
 }
 
-bool GltfLoader::LoadGlbModel(const std::string& filename, ID3D11Device* device)
+bool GltfLoader::LoadGlbModel(const std::string& filename, ID3D11Device* device, MeshCache* meshCache,
+    MeshCache* textureCache, const MeshCache::SourceKey* sourceKey)
 {
-    // tinygltf 설정
-    tinygltf::TinyGLTF loader;
-    // 이미지 쓰기 기능 비활성화
-    
-    tinygltf::Model model;
-    std::string err;
-    std::string warn;
+    // 가져오기 -> 텍스처 디코딩 -> GPU 업로드 단계를 차례로 실행
+    if (!ImportGlbModel(filename, meshCache, sourceKey)) {
+        return false;
+    }
+
+    DecodeTextureImages({ this }, textureCache);
+    return CreateDeviceResources(device);
+}
+
+bool GltfLoader::ImportGlbModel(const std::string& filename, MeshCache* meshCache, const MeshCache::SourceKey* sourceKey)
+{
+    return ReadImportStage(filename, meshCache, sourceKey) && ParseImportStage() && ProcessImportStage();
+}
+
+bool GltfLoader::ReadImportStage(const std::string& filename, MeshCache* meshCache, const MeshCache::SourceKey* sourceKey)
+{
+    // 모델 정보 설정
+    modelInfo.Name = filename.substr(filename.find_last_of("/\\") + 1);
+    modelInfo.FilePath = filename;
+
+    importState = std::make_unique<ImportState>();
+    ImportState& state = *importState;
+    state.Filename = filename;
+    state.Cache = meshCache;
+
+    // 메시 캐시 조회 - 원본이 바뀌지 않았으면 GLTF 파싱을 건너뜀 (내용 해시는 이 작업에서 한 번만 계산)
+    if (sourceKey) {
+        state.CacheKey = *sourceKey;
+    }
+    state.UseCache = meshCache && meshCache->IsEnabled() && MeshCache::CompleteKey(filename, state.CacheKey);
+
+    if (state.UseCache) {
+        MappedFile cacheFile;
+        MeshCache::Reader reader;
+        if (meshCache->Lookup(state.CacheKey, MeshCache::AssetGlb, cacheFile, reader) && ReadCache(reader)) {
+            meshCache->RecordHit();
+            state.LoadedFromCache = true;
+            if (importProgress) {
+                importProgress->BeginPhase(ImportProgress::Phase::Read, cacheFile.GetSize());
+                importProgress->Advance(ImportProgress::Phase::Read, cacheFile.GetSize());
+            }
+            OutputDebugStringA(("GLB loaded from mesh cache: " + filename + "\n").c_str());
+            return true;
+        }
+
+        // 일부만 읽힌 데이터 정리
+        meshes.clear();
+        nodes.clear();
+        materials.clear();
+        animations.clear();
+        rootNodes.clear();
+        textureImages.clear();
+        skins.clear();
+        meshCache->RecordMiss();
+    }
 
     // 파일 확장자 검사
     std::string ext = filename.substr(filename.find_last_of(".") + 1);
-    bool isGlb = (ext == "glb");
+    state.IsGlb = (ext == "glb");
+    state.LoadStart = std::chrono::high_resolution_clock::now();
+
+    // GLB는 여기서 매핑과 헤더 검사만 하고, GLTF는 파싱 단계에서 tinygltf가 파일을 읽음
+    if (state.IsGlb) {
+        std::string err;
+        if (!state.File.Open(filename, err)) {
+            std::cerr << "Failed to load GLTF/GLB file: " << filename << std::endl;
+            if (!err.empty()) std::cerr << "Error: " << err << std::endl;
+            importState.reset();
+            return false;
+        }
+
+        if (importProgress) {
+            importProgress->BeginPhase(ImportProgress::Phase::Read, state.File.GetFileSize());
+            importProgress->Advance(ImportProgress::Phase::Read, state.File.GetFileSize());
+        }
+    }
+
+    return true;
+}
+
+bool GltfLoader::ParseImportStage()
+{
+    if (!importState) {
+        return false;
+    }
+
+    ImportState& state = *importState;
+    if (state.LoadedFromCache) {
+        return true;
+    }
+
+    if (importProgress) {
+        importProgress->BeginPhase(ImportProgress::Phase::Parse, 1);
+    }
+
+    // tinygltf 설정 - 이미지는 디코딩하지 않고 인코딩된 그대로 보관
+    tinygltf::TinyGLTF loader;
+    loader.SetImagesAsIs(true);
 
-    // GLB 또는 GLTF 파일 로드
+    std::string err;
+    std::string warn;
     bool ret = false;
-    if (isGlb) {
-        ret = loader.LoadBinaryFromFile(&model, &err, &warn, filename);
+    if (state.IsGlb) {
+        ret = state.File.Parse(loader, state.Model, err, warn);
     }
     else {
-        ret = loader.LoadASCIIFromFile(&model, &err, &warn, filename);
+        ret = loader.LoadASCIIFromFile(&state.Model, &err, &warn, state.Filename);
     }
 
     if (!ret) {
-        std::cerr << "Failed to load GLTF/GLB file: " << filename << std::endl;
+        std::cerr << "Failed to load GLTF/GLB file: " << state.Filename << std::endl;
         if (!err.empty()) std::cerr << "Error: " << err << std::endl;
+        importState.reset();
         return false;
     }
 
@@ -449,15 +578,313 @@ bool GltfLoader::LoadGlbModel(const std::string& filename, ID3D11Device* device)
         std::cout << "Warning: " << warn << std::endl;
     }
 
-    // 모델 정보 설정
-    modelInfo.Name = filename.substr(filename.find_last_of("/\\") + 1);
-    modelInfo.FilePath = filename;
+    if (importProgress) {
+        // GLTF는 JSON과 외부 버퍼를 파싱 단계에서 읽음
+        if (!state.IsGlb) {
+            uint64_t bufferBytes = 0;
+            for (const auto& buffer : state.Model.buffers) {
+                bufferBytes += buffer.data.size();
+            }
+            importProgress->AddTotal(ImportProgress::Phase::Read, bufferBytes);
+            importProgress->Advance(ImportProgress::Phase::Read, bufferBytes);
+        }
+        importProgress->Advance(ImportProgress::Phase::Parse);
+    }
 
-    // GLTF 모델 처리
-    if (!ProcessGltfModel(model, device)) {
+    // 취소되었으면 파싱한 모델과 매핑을 바로 해제
+    if (IsImportCancelled()) {
+        importState.reset();
         return false;
     }
 
+    state.ParseEnd = std::chrono::high_resolution_clock::now();
+    return true;
+}
+
+bool GltfLoader::ProcessImportStage()
+{
+    if (!importState) {
+        return false;
+    }
+
+    // 처리가 끝나면 매핑과 파싱한 모델을 해제
+    std::unique_ptr<ImportState> finishedState = std::move(importState);
+    ImportState& state = *finishedState;
+
+    if (!state.LoadedFromCache) {
+        // GLTF 모델 처리 - 매핑은 처리가 끝날 때까지만 유지
+        GltfAccessor accessors(state.Model);
+        if (state.File.GetBinBufferIndex() >= 0) {
+            accessors.SetBufferData(state.File.GetBinBufferIndex(), state.File.GetBinData(), state.File.GetBinSize());
+        }
+
+        bool processed = ProcessGltfModel(state.Model, accessors);
+        size_t mappedBytes = state.File.GetFileSize();
+        size_t binBytes = state.File.GetBinSize();
+        state.File.Close();
+
+        if (!processed) {
+            return false;
+        }
+
+        // 로드 시간과 메모리 사용량 기록 (기존 경로는 파일 전체와 BIN 청크를 각각 힙에 복사했음)
+        auto processEnd = std::chrono::high_resolution_clock::now();
+        PROCESS_MEMORY_COUNTERS memoryCounters = {};
+        GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters));
+        OutputDebugStringA(("GLB load: " + state.Filename +
+            "\n  mapped " + std::to_string(mappedBytes / 1024) + " KB, BIN " + std::to_string(binBytes / 1024) +
+            " KB read in place (" + std::to_string((mappedBytes + binBytes) / 1024) + " KB of heap copies avoided)" +
+            "\n  parse " + std::to_string(std::chrono::duration<double, std::milli>(state.ParseEnd - state.LoadStart).count()) +
+            " ms, process " + std::to_string(std::chrono::duration<double, std::milli>(processEnd - state.ParseEnd).count()) + " ms" +
+            "\n  working set " + std::to_string(memoryCounters.WorkingSetSize / (1024 * 1024)) +
+            " MB, peak " + std::to_string(memoryCounters.PeakWorkingSetSize / (1024 * 1024)) + " MB\n").c_str());
+
+        if (state.UseCache) {
+            MeshCache::Writer writer;
+            WriteCache(writer);
+            state.Cache->Store(state.CacheKey, MeshCache::AssetGlb, writer);
+        }
+    }
+
+    if (state.LoadedFromCache && importProgress) {
+        size_t primitiveCount = 0;
+        for (const auto& mesh : meshes) {
+            primitiveCount += mesh.Primitives.size();
+        }
+        importProgress->BeginPhase(ImportProgress::Phase::Process, primitiveCount);
+        importProgress->Advance(ImportProgress::Phase::Process, primitiveCount);
+    }
+
+    BuildNodeHierarchy();
+    AssignDeformedPrimitives();
+    BuildPickingBvhs();
+    InitializeAnimationPose();
+    return true;
+}
+
+void GltfLoader::DecodeTextureImages(const std::vector<GltfLoader*>& loaders, MeshCache* textureCache)
+{
+    // 모든 모델의 이미지를 한 목록으로 모아서 공유 스레드 풀에서 처리
+    // 이미지마다 모델의 진행 상태를 함께 기록 (취소된 모델의 이미지는 건너뜀)
+    std::vector<TextureImage*> images;
+    std::vector<ImportProgress*> imageProgress;
+    for (GltfLoader* loader : loaders) {
+        if (!loader || loader->IsImportCancelled()) continue;
+        loader->AssignTextureRoles();
+        size_t firstImage = images.size();
+        for (auto& image : loader->textureImages) {
+            if (!image.Encoded.empty() && !image.Processed.IsValid()) {
+                images.push_back(&image);
+                imageProgress.push_back(loader->importProgress.get());
+            }
+        }
+        if (loader->importProgress) {
+            loader->importProgress->BeginPhase(ImportProgress::Phase::DecodeTextures, images.size() - firstImage);
+        }
+    }
+
+    if (images.empty()) {
+        return;
+    }
+
+    ThreadPool& pool = ThreadPool::GetShared();
+    auto stageStart = std::chrono::high_resolution_clock::now();
+
+    pool.ParallelFor(images.size(), [&images, &imageProgress, textureCache](size_t i) {
+        ImportProgress* progress = imageProgress[i];
+        if (progress && progress->IsCancelled()) {
+            return;
+        }
+
+        TextureImage& image = *images[i];
+        TextureProcessor::Process(image.Encoded, image.Role, textureCache, image.Processed);
+        if (progress) {
+            progress->Advance(ImportProgress::Phase::DecodeTextures);
+        }
+    });
+
+    auto stageEnd = std::chrono::high_resolution_clock::now();
+
+    // 이미지별 처리 시간과 압축 품질 기록 (작업자 스레드가 아닌 호출 스레드에서 출력)
+    double processTotal = 0.0;
+    size_t cacheHits = 0;
+    uint64_t uncompressedBytes = 0;
+    uint64_t processedBytes = 0;
+    std::string report;
+    for (size_t i = 0; i < images.size(); i++) {
+        if (imageProgress[i] && imageProgress[i]->IsCancelled()) {
+            continue;
+        }
+
+        const TextureImage* image = images[i];
+        const TextureProcessor::Result& processed = image->Processed;
+        processTotal += processed.TotalMilliseconds;
+        if (!processed.IsValid()) {
+            report += "  failed: " + image->Name + " (" + image->MimeType + ")\n";
+            continue;
+        }
+
+        // 같은 밉 체인을 RGBA8로 저장했을 때의 크기 (약 4/3배)
+        uncompressedBytes += static_cast<uint64_t>(processed.Width) * processed.Height * 4 * 4 / 3;
+        processedBytes += processed.Pixels.size();
+
+        report += "  " + image->Name + " " + std::to_string(processed.Width) + "x" + std::to_string(processed.Height) +
+            " " + TextureProcessor::GetFormatName(processed.Format) + " " + std::to_string(processed.Levels.size()) + " mips";
+        if (processed.FromCache) {
+            cacheHits++;
+            report += ", cached in " + std::to_string(processed.TotalMilliseconds) + " ms\n";
+        }
+        else {
+            report += ", decode " + std::to_string(processed.DecodeMilliseconds) +
+                " ms, mips " + std::to_string(processed.MipMilliseconds) +
+                " ms, compress " + std::to_string(processed.CompressMilliseconds) + " ms";
+            if (processed.Psnr > 0.0f) {
+                report += ", PSNR " + std::to_string(processed.Psnr) + " dB";
+            }
+            report += "\n";
+        }
+    }
+
+    OutputDebugStringA(("Texture decode: " + std::to_string(images.size()) + " images from " +
+        std::to_string(loaders.size()) + " models in " +
+        std::to_string(std::chrono::duration<double, std::milli>(stageEnd - stageStart).count()) +
+        " ms (sum " + std::to_string(processTotal) + " ms, " +
+        std::to_string(pool.GetThreadCount() + 1) + " threads, " + std::to_string(cacheHits) + " cache hits, " +
+        std::to_string(processedBytes / 1024) + " KB vs " + std::to_string(uncompressedBytes / 1024) + " KB RGBA8)\n" +
+        report).c_str());
+}
+
+void GltfLoader::AssignTextureRoles()
+{
+    // 재질에서 참조하는 용도로 이미지 용도 결정 (한 이미지를 여러 용도로 쓰면 먼저 찾은 용도 사용)
+    auto assign = [this](int imageIndex, TextureProcessor::Role role) {
+        if (imageIndex >= 0 && imageIndex < static_cast<int>(textureImages.size()) &&
+            textureImages[imageIndex].Role == TextureProcessor::Role::Unused) {
+            textureImages[imageIndex].Role = role;
+        }
+    };
+
+    for (const auto& matPair : materials) {
+        const PbrMaterial& material = matPair.second;
+        assign(material.BaseColorImage, TextureProcessor::Role::Color);
+        assign(material.EmissiveImage, TextureProcessor::Role::Color);
+        assign(material.NormalImage, TextureProcessor::Role::Normal);
+        assign(material.MetallicRoughnessImage, TextureProcessor::Role::Data);
+        assign(material.OcclusionImage, TextureProcessor::Role::Data);
+    }
+}
+
+bool GltfLoader::CreateDeviceResources(ID3D11Device* device)
+{
+    // 디코딩 단계를 거치지 않았으면 여기서 디코딩
+    DecodeTextureImages({ this });
+
+    // 업로드 항목을 한 번에 모두 업로드 (ImportPipeline은 같은 항목을 여러 프레임에 나눠 업로드)
+    auto uploadStart = std::chrono::high_resolution_clock::now();
+    std::vector<ImportPipeline::UploadItem> items;
+    PrepareUploads(items);
+    for (const auto& item : items) {
+        if (!UploadResource(device, item)) {
+            return false;
+        }
+    }
+
+    OutputDebugStringA(("GPU upload: " + std::to_string(items.size()) + " items (" +
+        std::to_string(textureImages.size()) + " images, " + std::to_string(textureBytes / 1024) + " KB textures) in " +
+        std::to_string(std::chrono::duration<double, std::milli>(
+            std::chrono::high_resolution_clock::now() - uploadStart).count()) + " ms\n").c_str());
+    return true;
+}
+
+void GltfLoader::PrepareUploads(std::vector<ImportPipeline::UploadItem>& items)
+{
+    textureViews.assign(textureImages.size(), nullptr);
+    textureBytes = 0;
+    size_t firstItem = items.size();
+
+    // 이미지별 텍스처 (같은 이미지를 쓰는 재질은 리소스 뷰를 공유)
+    for (size_t i = 0; i < textureImages.size(); i++) {
+        ImportPipeline::UploadItem item;
+        item.Kind = UploadTexture;
+        item.Index = static_cast<uint32_t>(i);
+        item.Bytes = textureImages[i].Processed.Pixels.size();
+        items.push_back(item);
+    }
+
+    // 프리미티브별 정점/인덱스 버퍼
+    for (size_t meshIndex = 0; meshIndex < meshes.size(); meshIndex++) {
+        const Mesh& mesh = meshes[meshIndex];
+        for (size_t primitiveIndex = 0; primitiveIndex < mesh.Primitives.size(); primitiveIndex++) {
+            const MeshPrimitive& primitive = mesh.Primitives[primitiveIndex];
+            ImportPipeline::UploadItem item;
+            item.Kind = UploadPrimitive;
+            item.Index = static_cast<uint32_t>(meshIndex);
+            item.SubIndex = static_cast<uint32_t>(primitiveIndex);
+            item.Bytes = primitive.Vertices.size() * sizeof(Vertex) + primitive.Indices.size() * sizeof(uint32_t);
+            items.push_back(item);
+        }
+    }
+
+    ImportPipeline::UploadItem finalize;
+    finalize.Kind = UploadFinalize;
+    items.push_back(finalize);
+
+    if (importProgress) {
+        importProgress->BeginPhase(ImportProgress::Phase::Upload, items.size() - firstItem);
+    }
+}
+
+bool GltfLoader::UploadResource(ID3D11Device* device, const ImportPipeline::UploadItem& item)
+{
+    if (importProgress) {
+        importProgress->Advance(ImportProgress::Phase::Upload);
+    }
+
+    switch (item.Kind) {
+    case UploadTexture: {
+        if (item.Index >= textureImages.size() || item.Index >= textureViews.size()) {
+            return true;
+        }
+
+        TextureImage& image = textureImages[item.Index];
+        if (LoadTextureFromBuffer(image, device, &textureViews[item.Index])) {
+            textureBytes += image.Processed.Pixels.size();
+        }
+
+        // 업로드가 끝난 데이터는 해제 (인코딩된 원본은 캐시 기록용으로 유지)
+        image.Processed = TextureProcessor::Result();
+        return true;
+    }
+    case UploadPrimitive:
+        if (item.Index < meshes.size() && item.SubIndex < meshes[item.Index].Primitives.size()) {
+            CreateBuffers(device, meshes[item.Index].Primitives[item.SubIndex]);
+        }
+        return true;
+    case UploadFinalize:
+        return FinalizeDeviceResources(device);
+    default:
+        return true;
+    }
+}
+
+bool GltfLoader::FinalizeDeviceResources(ID3D11Device* device)
+{
+    auto bindTexture = [this](int imageIndex, ID3D11ShaderResourceView** textureView) {
+        if (imageIndex >= 0 && imageIndex < static_cast<int>(textureViews.size()) && textureViews[imageIndex]) {
+            *textureView = textureViews[imageIndex];
+            (*textureView)->AddRef();
+        }
+    };
+
+    for (auto& matPair : materials) {
+        PbrMaterial& material = matPair.second;
+        bindTexture(material.BaseColorImage, &material.BaseColorTexture);
+        bindTexture(material.MetallicRoughnessImage, &material.MetallicRoughnessTexture);
+        bindTexture(material.NormalImage, &material.NormalTexture);
+        bindTexture(material.EmissiveImage, &material.EmissiveTexture);
+        bindTexture(material.OcclusionImage, &material.OcclusionTexture);
+    }
+
     // 셰이더 생성
     if (!CreateShaders(device)) {
         return false;
@@ -510,7 +937,7 @@ bool GltfLoader::LoadGlbModel(const std::string& filename, ID3D11Device* device)
     return true;
 }
 
-bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* device)
+bool GltfLoader::ProcessGltfModel(tinygltf::Model& model, const GltfAccessor& accessors)
 {
     // 씬 정보 가져오기
     int defaultScene = model.defaultScene > -1 ? model.defaultScene : 0;
@@ -547,6 +974,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
         nodes[i].Name = node.name;
         nodes[i].Children = node.children;
         nodes[i].MeshIndex = node.mesh;
+        nodes[i].SkinIndex = node.skin;
+        nodes[i].Weights.assign(node.weights.begin(), node.weights.end());
 
         // 노드 변환 행렬 계산
         XMMATRIX transform = XMMatrixIdentity();
@@ -606,6 +1035,42 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
         }
     }
 
+    // 스킨 처리 - 역 바인드 행렬이 없으면 단위 행렬
+    skins.resize(model.skins.size());
+    for (size_t i = 0; i < model.skins.size(); i++) {
+        const auto& gltfSkin = model.skins[i];
+        Skin& skin = skins[i];
+        skin.Name = gltfSkin.name.empty() ? "skin_" + std::to_string(i) : gltfSkin.name;
+        skin.Joints = gltfSkin.joints;
+
+        XMFLOAT4X4 identity;
+        XMStoreFloat4x4(&identity, XMMatrixIdentity());
+        skin.InverseBindMatrices.assign(skin.Joints.size(), identity);
+        if (gltfSkin.inverseBindMatrices >= 0) {
+            // 열 우선 MAT4를 그대로 읽으면 DirectX 행 벡터 규칙의 행렬이 됨
+            accessors.ReadFloats(gltfSkin.inverseBindMatrices, 16, skin.InverseBindMatrices.data(),
+                sizeof(XMFLOAT4X4), skin.InverseBindMatrices.size());
+        }
+    }
+
+    // 이미지 처리 - 인코딩된 데이터를 그대로 가져옴
+    // GLB의 bufferView 이미지는 매핑된 BIN 청크에서 바로 복사
+    textureImages.resize(model.images.size());
+    for (size_t i = 0; i < model.images.size(); i++) {
+        auto& image = model.images[i];
+        textureImages[i].Name = image.name;
+        textureImages[i].MimeType = image.mimeType;
+
+        const unsigned char* imageData = nullptr;
+        size_t imageSize = 0;
+        if (!image.image.empty()) {
+            textureImages[i].Encoded = std::move(image.image);
+        }
+        else if (image.bufferView >= 0 && accessors.GetBufferViewData(image.bufferView, imageData, imageSize)) {
+            textureImages[i].Encoded.assign(imageData, imageData + imageSize);
+        }
+    }
+
     // 머티리얼 처리
     for (size_t i = 0; i < model.materials.size(); i++) {
         const auto& material = model.materials[i];
@@ -645,9 +1110,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
             int texIndex = pbrInfo.baseColorTexture.index;
             const auto& texture = model.textures[texIndex];
             if (texture.source >= 0 && texture.source < model.images.size()) {
-                const auto& image = model.images[texture.source];
-                LoadTextureFromBuffer(image, device, &pbrMaterial.BaseColorTexture);
-                pbrMaterial.BaseColorTexturePath = image.uri;
+                pbrMaterial.BaseColorImage = texture.source;
+                pbrMaterial.BaseColorTexturePath = model.images[texture.source].uri;
             }
         }
 
@@ -656,9 +1120,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
             int texIndex = pbrInfo.metallicRoughnessTexture.index;
             const auto& texture = model.textures[texIndex];
             if (texture.source >= 0 && texture.source < model.images.size()) {
-                const auto& image = model.images[texture.source];
-                LoadTextureFromBuffer(image, device, &pbrMaterial.MetallicRoughnessTexture);
-                pbrMaterial.MetallicRoughnessTexturePath = image.uri;
+                pbrMaterial.MetallicRoughnessImage = texture.source;
+                pbrMaterial.MetallicRoughnessTexturePath = model.images[texture.source].uri;
             }
         }
 
@@ -667,9 +1130,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
             int texIndex = material.normalTexture.index;
             const auto& texture = model.textures[texIndex];
             if (texture.source >= 0 && texture.source < model.images.size()) {
-                const auto& image = model.images[texture.source];
-                LoadTextureFromBuffer(image, device, &pbrMaterial.NormalTexture);
-                pbrMaterial.NormalTexturePath = image.uri;
+                pbrMaterial.NormalImage = texture.source;
+                pbrMaterial.NormalTexturePath = model.images[texture.source].uri;
             }
         }
 
@@ -678,9 +1140,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
             int texIndex = material.emissiveTexture.index;
             const auto& texture = model.textures[texIndex];
             if (texture.source >= 0 && texture.source < model.images.size()) {
-                const auto& image = model.images[texture.source];
-                LoadTextureFromBuffer(image, device, &pbrMaterial.EmissiveTexture);
-                pbrMaterial.EmissiveTexturePath = image.uri;
+                pbrMaterial.EmissiveImage = texture.source;
+                pbrMaterial.EmissiveTexturePath = model.images[texture.source].uri;
             }
         }
 
@@ -689,9 +1150,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
             int texIndex = material.occlusionTexture.index;
             const auto& texture = model.textures[texIndex];
             if (texture.source >= 0 && texture.source < model.images.size()) {
-                const auto& image = model.images[texture.source];
-                LoadTextureFromBuffer(image, device, &pbrMaterial.OcclusionTexture);
-                pbrMaterial.OcclusionTexturePath = image.uri;
+                pbrMaterial.OcclusionImage = texture.source;
+                pbrMaterial.OcclusionTexturePath = model.images[texture.source].uri;
             }
         }
 
@@ -700,13 +1160,31 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
     }
 
     // 메시 처리
+    auto decodeStart = std::chrono::high_resolution_clock::now();
+    size_t decodedVertices = 0;
+    size_t decodedIndices = 0;
+
+    if (importProgress) {
+        size_t primitiveCount = 0;
+        for (const auto& gltfMesh : model.meshes) {
+            primitiveCount += gltfMesh.primitives.size();
+        }
+        importProgress->BeginPhase(ImportProgress::Phase::Process, primitiveCount);
+    }
+
     meshes.resize(model.meshes.size());
     for (size_t i = 0; i < model.meshes.size(); i++) {
+        // 취소되었으면 메시 단위로 멈춤 (만든 데이터는 로더와 함께 해제)
+        if (IsImportCancelled()) {
+            return false;
+        }
+
         const auto& gltfMesh = model.meshes[i];
         auto& mesh = meshes[i];
 
         mesh.Name = gltfMesh.name.empty() ? "mesh_" + std::to_string(i) : gltfMesh.name;
         mesh.Primitives.resize(gltfMesh.primitives.size());
+        mesh.Weights.assign(gltfMesh.weights.begin(), gltfMesh.weights.end());
 
         // 각 프리미티브 처리
         for (size_t j = 0; j < gltfMesh.primitives.size(); j++) {
@@ -724,113 +1202,100 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
                 meshPrimitive.MaterialName = "default";
             }
 
-            // 정점 데이터 처리
-            // 위치, 법선, 텍스처 좌표, 탄젠트 등의 속성 처리
-
-            // 인덱스 버퍼 처리
+            // 인덱스 버퍼 처리 (8/16/32비트 인덱스를 32비트로 확장)
             if (primitive.indices >= 0) {
-                const auto& accessor = model.accessors[primitive.indices];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
-
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int indexCount = accessor.count;
-                meshPrimitive.IndexCount = indexCount;
-
-                // 인덱스 타입에 따라 추출
-                if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-                    const uint16_t* indices = reinterpret_cast<const uint16_t*>(data);
-                    for (int k = 0; k < indexCount; k++) {
-                        meshPrimitive.Indices.push_back(indices[k]);
-                    }
-                }
-                else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
-                    const uint32_t* indices = reinterpret_cast<const uint32_t*>(data);
-                    for (int k = 0; k < indexCount; k++) {
-                        meshPrimitive.Indices.push_back(indices[k]);
-                    }
-                }
-                else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-                    const uint8_t* indices = reinterpret_cast<const uint8_t*>(data);
-                    for (int k = 0; k < indexCount; k++) {
-                        meshPrimitive.Indices.push_back(indices[k]);
-                    }
-                }
+                accessors.ReadIndices(primitive.indices, meshPrimitive.Indices);
+                meshPrimitive.IndexCount = static_cast<UINT>(meshPrimitive.Indices.size());
             }
 
-            // 위치 데이터 처리
+            // 위치 데이터 처리 - 정점 수는 POSITION 접근자 기준
             auto positionIt = primitive.attributes.find("POSITION");
             if (positionIt != primitive.attributes.end()) {
-                const auto& accessor = model.accessors[positionIt->second];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
-
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float) * 3;
-                int vertexCount = accessor.count;
+                meshPrimitive.Vertices.resize(accessors.GetCount(positionIt->second));
+            }
 
-                // 정점 데이터 준비
-                meshPrimitive.Vertices.resize(vertexCount);
+            // 정점 속성을 Vertex 레이아웃에 바로 디코딩
+            auto readAttribute = [&](const char* name, size_t memberOffset, int components) {
+                auto it = primitive.attributes.find(name);
+                if (it == primitive.attributes.end() || meshPrimitive.Vertices.empty()) {
+                    return;
+                }
+                unsigned char* destination = reinterpret_cast<unsigned char*>(meshPrimitive.Vertices.data()) + memberOffset;
+                accessors.ReadFloats(it->second, components, destination, sizeof(Vertex), meshPrimitive.Vertices.size());
+            };
 
-                for (int k = 0; k < vertexCount; k++) {
-                    const float* position = reinterpret_cast<const float*>(data + k * stride);
-                    meshPrimitive.Vertices[k].Position = XMFLOAT3(position[0], position[1], position[2]);
+            readAttribute("POSITION", offsetof(Vertex, Position), 3);
+            readAttribute("NORMAL", offsetof(Vertex, Normal), 3);
+            readAttribute("TEXCOORD_0", offsetof(Vertex, TexCoord), 2);
+            readAttribute("TANGENT", offsetof(Vertex, Tangent), 4);
+            readAttribute("WEIGHTS_0", offsetof(Vertex, Weights), 4);
+
+            // 조인트 인덱스 (UNSIGNED_BYTE/SHORT)
+            auto jointsIt = primitive.attributes.find("JOINTS_0");
+            if (jointsIt != primitive.attributes.end() && !meshPrimitive.Vertices.empty()) {
+                unsigned char* destination = reinterpret_cast<unsigned char*>(meshPrimitive.Vertices.data()) + offsetof(Vertex, Joints);
+                accessors.ReadUInts(jointsIt->second, 4, destination, sizeof(Vertex), meshPrimitive.Vertices.size());
+
+                // 가중치 합을 1로 정규화 (양자화된 가중치의 오차 보정)
+                for (auto& vertex : meshPrimitive.Vertices) {
+                    float total = vertex.Weights.x + vertex.Weights.y + vertex.Weights.z + vertex.Weights.w;
+                    if (total > 0.0f) {
+                        vertex.Weights.x /= total;
+                        vertex.Weights.y /= total;
+                        vertex.Weights.z /= total;
+                        vertex.Weights.w /= total;
+                    }
                 }
             }
 
-            // 법선 데이터 처리
-            auto normalIt = primitive.attributes.find("NORMAL");
-            if (normalIt != primitive.attributes.end()) {
-                const auto& accessor = model.accessors[normalIt->second];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
-
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float) * 3;
-
-                for (int k = 0; k < accessor.count; k++) {
-                    const float* normal = reinterpret_cast<const float*>(data + k * stride);
-                    meshPrimitive.Vertices[k].Normal = XMFLOAT3(normal[0], normal[1], normal[2]);
+            // 텍스처 좌표 Y축 반전
+            if (primitive.attributes.count("TEXCOORD_0")) {
+                for (auto& vertex : meshPrimitive.Vertices) {
+                    vertex.TexCoord.y = 1.0f - vertex.TexCoord.y;
                 }
             }
 
-            // 텍스처 좌표 처리
-            auto texcoordIt = primitive.attributes.find("TEXCOORD_0");
-            if (texcoordIt != primitive.attributes.end()) {
-                const auto& accessor = model.accessors[texcoordIt->second];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
+            // 모프 타깃 - 희소 접근자도 정점 수만큼 펼쳐서 읽은 뒤 움직이는 정점만 남김 (탄젠트 변화량은 사용하지 않음)
+            if (!primitive.targets.empty() && !meshPrimitive.Vertices.empty()) {
+                size_t vertexCount = meshPrimitive.Vertices.size();
+                std::vector<std::vector<XMFLOAT3>> positionDeltas(primitive.targets.size());
+                std::vector<std::vector<XMFLOAT3>> normalDeltas(primitive.targets.size());
+                auto readTarget = [&](const std::map<std::string, int>& target, const char* name, std::vector<XMFLOAT3>& deltas) {
+                    auto it = target.find(name);
+                    if (it == target.end()) {
+                        return;
+                    }
+                    deltas.assign(vertexCount, XMFLOAT3(0.0f, 0.0f, 0.0f));
+                    accessors.ReadFloats(it->second, 3, deltas.data(), sizeof(XMFLOAT3), vertexCount);
+                };
 
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float) * 2;
+                for (size_t t = 0; t < primitive.targets.size(); t++) {
+                    readTarget(primitive.targets[t], "POSITION", positionDeltas[t]);
+                    readTarget(primitive.targets[t], "NORMAL", normalDeltas[t]);
+                }
 
-                for (int k = 0; k < accessor.count; k++) {
-                    const float* texcoord = reinterpret_cast<const float*>(data + k * stride);
-                    meshPrimitive.Vertices[k].TexCoord = XMFLOAT2(texcoord[0], 1.0f - texcoord[1]); // 텍스처 좌표 Y축 반전
+                MorphTargets::Build(positionDeltas, normalDeltas, meshPrimitive.Vertices.data(), vertexCount,
+                    sizeof(Vertex), offsetof(Vertex, Position), offsetof(Vertex, Normal), meshPrimitive.Morph);
+                if (mesh.Weights.size() < primitive.targets.size()) {
+                    mesh.Weights.resize(primitive.targets.size(), 0.0f);
                 }
             }
 
-            // 탄젠트 처리
-            auto tangentIt = primitive.attributes.find("TANGENT");
-            if (tangentIt != primitive.attributes.end()) {
-                const auto& accessor = model.accessors[tangentIt->second];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
+            // 프리미티브 로컬 바운딩 박스 (이후 모델/메시 박스는 이 박스만 합침)
+            meshPrimitive.Bounds = BoundingVolumes::FromVertices(meshPrimitive.Vertices);
 
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float) * 4;
-
-                for (int k = 0; k < accessor.count; k++) {
-                    const float* tangent = reinterpret_cast<const float*>(data + k * stride);
-                    meshPrimitive.Vertices[k].Tangent = XMFLOAT4(tangent[0], tangent[1], tangent[2], tangent[3]);
-                }
+            decodedVertices += meshPrimitive.Vertices.size();
+            decodedIndices += meshPrimitive.Indices.size();
+            if (importProgress) {
+                importProgress->Advance(ImportProgress::Phase::Process);
             }
-
-            // 버퍼 생성
-            CreateBuffers(device, meshPrimitive);
         }
     }
 
+    double decodeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - decodeStart).count();
+    OutputDebugStringA(("GLB accessors decoded: " + std::to_string(decodedVertices) + " vertices, " +
+        std::to_string(decodedIndices) + " indices in " + std::to_string(decodeMs) + " ms\n").c_str());
+
     // 애니메이션 처리 (간략화)
     for (size_t i = 0; i < model.animations.size(); i++) {
         const auto& gltfAnimation = model.animations[i];
@@ -861,57 +1326,51 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
 
             // 샘플러 처리
             const auto& sampler = gltfAnimation.samplers[channel.sampler];
+            if (sampler.interpolation == "STEP") {
+                animChannel.Mode = AnimationEngine::Interpolation::Step;
+            }
+            else if (sampler.interpolation == "CUBICSPLINE") {
+                animChannel.Mode = AnimationEngine::Interpolation::CubicSpline;
+            }
+            else {
+                animChannel.Mode = AnimationEngine::Interpolation::Linear;
+            }
 
             // 시간 데이터 처리
             if (sampler.input >= 0 && sampler.input < model.accessors.size()) {
-                const auto& accessor = model.accessors[sampler.input];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
-
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float);
-
-                for (int k = 0; k < accessor.count; k++) {
-                    const float* time = reinterpret_cast<const float*>(data + k * stride);
-                    animChannel.Times.push_back(*time);
+                animChannel.Times.resize(accessors.GetCount(sampler.input));
+                animChannel.Times.resize(accessors.ReadFloats(sampler.input, 1,
+                    animChannel.Times.data(), sizeof(float), animChannel.Times.size()));
 
-                    
+                for (float time : animChannel.Times) {
                     // min 
-                    if (*time < animation.StartTime) {
-                        animation.StartTime = *time;
+                    if (time < animation.StartTime) {
+                        animation.StartTime = time;
                     }
 
                     // max 
-                    if (*time > animation.EndTime) {
-                        animation.EndTime = *time;
+                    if (time > animation.EndTime) {
+                        animation.EndTime = time;
                     }
                 }
             }
 
-            // 값 데이터 처리
-            if (sampler.output >= 0 && sampler.output < model.accessors.size()) {
-                const auto& accessor = model.accessors[sampler.output];
-                const auto& bufferView = model.bufferViews[accessor.bufferView];
-                const auto& buffer = model.buffers[bufferView.buffer];
-
-                const unsigned char* data = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
-                int components = accessor.type == TINYGLTF_TYPE_VEC3 ? 3 : (accessor.type == TINYGLTF_TYPE_VEC4 ? 4 : 1);
-                int stride = accessor.ByteStride(bufferView) ? accessor.ByteStride(bufferView) : sizeof(float) * components;
-
-                for (int k = 0; k < accessor.count; k++) {
-                    const float* value = reinterpret_cast<const float*>(data + k * stride);
-
-                    if (components == 1) {
-                        animChannel.Values.push_back(XMFLOAT4(value[0], 0.0f, 0.0f, 0.0f));
-                    }
-                    else if (components == 3) {
-                        animChannel.Values.push_back(XMFLOAT4(value[0], value[1], value[2], 0.0f));
-                    }
-                    else if (components == 4) {
-                        animChannel.Values.push_back(XMFLOAT4(value[0], value[1], value[2], value[3]));
-                    }
+            // 모프 가중치는 키프레임마다 타깃 수만큼의 스칼라 값
+            if (animChannel.Path == AnimationChannel::WEIGHTS) {
+                size_t keyValues = animChannel.Times.size() * (animChannel.Mode == AnimationEngine::Interpolation::CubicSpline ? 3 : 1);
+                if (sampler.output >= 0 && sampler.output < model.accessors.size() && keyValues > 0) {
+                    animChannel.Weights.resize(accessors.GetCount(sampler.output));
+                    animChannel.Weights.resize(accessors.ReadFloats(sampler.output, 1,
+                        animChannel.Weights.data(), sizeof(float), animChannel.Weights.size()));
+                    animChannel.TargetCount = static_cast<uint32_t>(animChannel.Weights.size() / keyValues);
                 }
             }
+            // 값 데이터 처리 (정규화된 정수 회전값도 부동소수점으로 변환)
+            else if (sampler.output >= 0 && sampler.output < model.accessors.size()) {
+                animChannel.Values.resize(accessors.GetCount(sampler.output));
+                animChannel.Values.resize(accessors.ReadFloats(sampler.output, 4,
+                    animChannel.Values.data(), sizeof(XMFLOAT4), animChannel.Values.size()));
+            }
 
             animation.Channels.push_back(animChannel);
         }
@@ -920,7 +1379,8 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
     }
 
     // 모델 로드 후 바운딩 박스 계산
-    BoundingBox box = CalculateBoundingBox();
+    bounds = CalculateBoundingBox();
+    const BoundingBox& box = bounds;
 
     // 모델을 원점에 중심 맞춤
     modelInfo.Position = XMFLOAT3(-box.center.x, -box.center.y, -box.center.z);
@@ -938,135 +1398,319 @@ bool GltfLoader::ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* de
     return true;
 }
 
-void GltfLoader::AutoResizeModel()
+void GltfLoader::WriteCache(MeshCache::Writer& writer) const
 {
-    // 모든 메시의 모든 버텍스를 검사하여 바운딩 박스 계산
-    BoundingBox box = CalculateBoundingBox();
+    // 자동 크기 조정 및 중심 맞춤 결과
+    writer.Write(modelInfo.Position);
+    writer.Write(modelInfo.Scale);
+    writer.Write(bounds);
+
+    // 노드 계층
+    writer.WriteVector(rootNodes);
+    writer.Write(static_cast<uint64_t>(nodes.size()));
+    for (const auto& node : nodes) {
+        XMFLOAT4X4 localTransform;
+        XMStoreFloat4x4(&localTransform, node.LocalTransform);
+        writer.WriteString(node.Name);
+        writer.Write(localTransform);
+        writer.WriteVector(node.Children);
+        writer.Write(node.MeshIndex);
+        writer.Write(node.SkinIndex);
+        writer.WriteVector(node.Weights);
+    }
 
-    // 매우 큰 모델인 경우에만 크기 조정 (비정상적인 크기 방지)
-    float maxDimension = max(max(
-        abs(box.max.x - box.min.x),
-        abs(box.max.y - box.min.y)),
-        abs(box.max.z - box.min.z));
+    // 스킨
+    writer.Write(static_cast<uint64_t>(skins.size()));
+    for (const auto& skin : skins) {
+        writer.WriteString(skin.Name);
+        writer.WriteVector(skin.Joints);
+        writer.WriteVector(skin.InverseBindMatrices);
+    }
 
-    if (maxDimension > 10.0f) {
-        // 적절한 크기로 스케일 조정
-        float scale = 1.0f / (maxDimension / 10.0f);
-        modelInfo.Scale = XMFLOAT3(scale, scale, scale);
+    // 텍스처 이미지 (인코딩된 원본)
+    writer.Write(static_cast<uint64_t>(textureImages.size()));
+    for (const auto& image : textureImages) {
+        writer.WriteString(image.Name);
+        writer.WriteString(image.MimeType);
+        writer.WriteVector(image.Encoded);
+    }
 
-        
+    // 재질
+    writer.Write(static_cast<uint64_t>(materials.size()));
+    for (const auto& matPair : materials) {
+        const PbrMaterial& material = matPair.second;
+        writer.WriteString(material.Name);
+        writer.Write(material.BaseColorFactor);
+        writer.Write(material.MetallicFactor);
+        writer.Write(material.RoughnessFactor);
+        writer.Write(material.EmissiveFactor);
+        writer.WriteString(material.BaseColorTexturePath);
+        writer.WriteString(material.MetallicRoughnessTexturePath);
+        writer.WriteString(material.NormalTexturePath);
+        writer.WriteString(material.EmissiveTexturePath);
+        writer.WriteString(material.OcclusionTexturePath);
+        writer.Write(material.BaseColorImage);
+        writer.Write(material.MetallicRoughnessImage);
+        writer.Write(material.NormalImage);
+        writer.Write(material.EmissiveImage);
+        writer.Write(material.OcclusionImage);
     }
 
-    // 중심 조정 (선택적)
-    modelInfo.Position = XMFLOAT3(
-        -box.center.x,
-        -box.center.y,
-        -box.center.z);
+    // 메시
+    writer.Write(static_cast<uint64_t>(meshes.size()));
+    for (const auto& mesh : meshes) {
+        writer.WriteString(mesh.Name);
+        writer.WriteVector(mesh.Weights);
+        writer.Write(static_cast<uint64_t>(mesh.Primitives.size()));
+        for (const auto& primitive : mesh.Primitives) {
+            writer.WriteString(primitive.MaterialName);
+            writer.WriteVector(primitive.Vertices);
+            writer.WriteVector(primitive.Indices);
+            writer.Write(primitive.IndexCount);
+
+            const MorphTargets::Set& morph = primitive.Morph;
+            writer.Write(morph.TargetCount);
+            writer.WriteVector(morph.Vertices);
+            writer.WriteVector(morph.BasePositions);
+            writer.WriteVector(morph.BaseNormals);
+            writer.WriteVector(morph.PositionDeltas);
+            writer.WriteVector(morph.NormalDeltas);
+        }
+    }
+
+    // 애니메이션
+    writer.Write(static_cast<uint64_t>(animations.size()));
+    for (const auto& animation : animations) {
+        writer.WriteString(animation.Name);
+        writer.Write(animation.StartTime);
+        writer.Write(animation.EndTime);
+        writer.Write(static_cast<uint64_t>(animation.Channels.size()));
+        for (const auto& channel : animation.Channels) {
+            writer.Write(channel.NodeIndex);
+            writer.Write(channel.Path);
+            writer.Write(channel.Mode);
+            writer.WriteVector(channel.Times);
+            writer.WriteVector(channel.Values);
+            writer.Write(channel.TargetCount);
+            writer.WriteVector(channel.Weights);
+        }
+    }
 }
 
-bool GltfLoader::LoadTextureFromBuffer(const tinygltf::Image& image, ID3D11Device* device, ID3D11ShaderResourceView** textureView)
+bool GltfLoader::ReadCache(MeshCache::Reader& reader)
 {
-    // 이미지 데이터가 있는지 확인
-    if (image.width <= 0 || image.height <= 0 || image.image.empty()) {
+    if (!reader.Read(modelInfo.Position) || !reader.Read(modelInfo.Scale) || !reader.Read(bounds)) {
         return false;
     }
-    
-    // 텍스처 생성에 필요한 데이터 준비
-    UINT width = static_cast<UINT>(image.width);
-    UINT height = static_cast<UINT>(image.height);
-    
-    // RGB 또는 RGBA 데이터로 텍스처 생성
-    std::vector<uint8_t> textureData;
-    UINT rowPitch;
-    
-    if (image.component == 3) {
-        // RGB를 RGBA로 변환
-        textureData.resize(width * height * 4);
-        const uint8_t* srcData = static_cast<const uint8_t*>(image.image.data());
-        
-        for (size_t i = 0; i < width * height; i++) {
-            textureData[i * 4 + 0] = srcData[i * 3 + 0]; // R
-            textureData[i * 4 + 1] = srcData[i * 3 + 1]; // G
-            textureData[i * 4 + 2] = srcData[i * 3 + 2]; // B
-            textureData[i * 4 + 3] = 255;               // A
-        }
-        
-        rowPitch = width * 4;
+
+    // 노드 계층
+    uint64_t nodeCount = 0;
+    if (!reader.ReadVector(rootNodes) || !reader.ReadCount(nodeCount)) {
+        return false;
     }
-    else if (image.component == 4) {
-        // RGBA 데이터 그대로 사용
-        textureData = image.image;
-        rowPitch = width * 4;
+    nodes.resize(static_cast<size_t>(nodeCount));
+    for (auto& node : nodes) {
+        XMFLOAT4X4 localTransform;
+        if (!reader.ReadString(node.Name) || !reader.Read(localTransform) ||
+            !reader.ReadVector(node.Children) || !reader.Read(node.MeshIndex) || !reader.Read(node.SkinIndex) ||
+            !reader.ReadVector(node.Weights)) {
+            return false;
+        }
+        node.LocalTransform = XMLoadFloat4x4(&localTransform);
     }
-    else {
-        // 지원하지 않는 형식
+
+    // 스킨
+    uint64_t skinCount = 0;
+    if (!reader.ReadCount(skinCount)) {
         return false;
     }
-    
-    // DirectX::CreateWICTextureFromMemory 함수 사용
-    ID3D11Resource* texture = nullptr;
-    HRESULT hr = DirectX::CreateWICTextureFromMemoryEx(
-        device,
-        textureData.data(),
-        textureData.size(),
-        0, // maxsize (0 = 제한 없음)
-        D3D11_USAGE_DEFAULT,
-        D3D11_BIND_SHADER_RESOURCE,
-        0, // cpuAccessFlags
-        0, // miscFlags
-        DirectX::WIC_LOADER_DEFAULT, // loadFlags
-        &texture,
-        textureView
-    );
-    
-    if (SUCCEEDED(hr) && texture) {
-        texture->Release();  // 셰이더 리소스 뷰만 필요하므로 텍스처 리소스는 해제
-        return true;
+    skins.resize(static_cast<size_t>(skinCount));
+    for (auto& skin : skins) {
+        if (!reader.ReadString(skin.Name) || !reader.ReadVector(skin.Joints) ||
+            !reader.ReadVector(skin.InverseBindMatrices) || skin.InverseBindMatrices.size() != skin.Joints.size()) {
+            return false;
+        }
     }
-    
-    // 만약 WIC 함수가 실패하면, 기본적인 D3D11 방식으로 시도
-    if (FAILED(hr)) {
-        // 텍스처 설명 구조체 설정
-        D3D11_TEXTURE2D_DESC textureDesc = {};
-        textureDesc.Width = width;
-        textureDesc.Height = height;
-        textureDesc.MipLevels = 1;
-        textureDesc.ArraySize = 1;
-        textureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        textureDesc.SampleDesc.Count = 1;
-        textureDesc.SampleDesc.Quality = 0;
-        textureDesc.Usage = D3D11_USAGE_DEFAULT;
-        textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-        textureDesc.CPUAccessFlags = 0;
-        textureDesc.MiscFlags = 0;
-        
-        // 초기 데이터 설정
-        D3D11_SUBRESOURCE_DATA initData = {};
-        initData.pSysMem = textureData.data();
-        initData.SysMemPitch = rowPitch;
-        initData.SysMemSlicePitch = 0; // 3D 텍스처가 아니므로 무시됨
-        
-        // 텍스처 생성
-        ID3D11Texture2D* texture2D = nullptr;
-        hr = device->CreateTexture2D(&textureDesc, &initData, &texture2D);
-        
-        if (SUCCEEDED(hr) && texture2D) {
-            // 셰이더 리소스 뷰 생성
-            D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-            srvDesc.Format = textureDesc.Format;
-            srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-            srvDesc.Texture2D.MostDetailedMip = 0;
-            srvDesc.Texture2D.MipLevels = 1;
-            
-            hr = device->CreateShaderResourceView(texture2D, &srvDesc, textureView);
-            texture2D->Release(); // 셰이더 리소스 뷰만 필요하므로 텍스처 리소스는 해제
-            
-            if (SUCCEEDED(hr)) {
-                return true;
+
+    // 텍스처 이미지
+    uint64_t imageCount = 0;
+    if (!reader.ReadCount(imageCount)) {
+        return false;
+    }
+    textureImages.resize(static_cast<size_t>(imageCount));
+    for (auto& image : textureImages) {
+        if (!reader.ReadString(image.Name) || !reader.ReadString(image.MimeType) || !reader.ReadVector(image.Encoded)) {
+            return false;
+        }
+    }
+
+    // 재질
+    uint64_t materialCount = 0;
+    if (!reader.ReadCount(materialCount)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < materialCount; i++) {
+        PbrMaterial material;
+        if (!reader.ReadString(material.Name) || !reader.Read(material.BaseColorFactor) ||
+            !reader.Read(material.MetallicFactor) || !reader.Read(material.RoughnessFactor) ||
+            !reader.Read(material.EmissiveFactor) ||
+            !reader.ReadString(material.BaseColorTexturePath) || !reader.ReadString(material.MetallicRoughnessTexturePath) ||
+            !reader.ReadString(material.NormalTexturePath) || !reader.ReadString(material.EmissiveTexturePath) ||
+            !reader.ReadString(material.OcclusionTexturePath) ||
+            !reader.Read(material.BaseColorImage) || !reader.Read(material.MetallicRoughnessImage) ||
+            !reader.Read(material.NormalImage) || !reader.Read(material.EmissiveImage) ||
+            !reader.Read(material.OcclusionImage)) {
+            return false;
+        }
+        materials[material.Name] = material;
+    }
+
+    // 메시
+    uint64_t meshCount = 0;
+    if (!reader.ReadCount(meshCount)) {
+        return false;
+    }
+    meshes.resize(static_cast<size_t>(meshCount));
+    for (auto& mesh : meshes) {
+        uint64_t primitiveCount = 0;
+        if (!reader.ReadString(mesh.Name) || !reader.ReadVector(mesh.Weights) || !reader.ReadCount(primitiveCount)) {
+            return false;
+        }
+        mesh.Primitives.resize(static_cast<size_t>(primitiveCount));
+        for (auto& primitive : mesh.Primitives) {
+            if (!reader.ReadString(primitive.MaterialName) || !reader.ReadVector(primitive.Vertices) ||
+                !reader.ReadVector(primitive.Indices) || !reader.Read(primitive.IndexCount)) {
+                return false;
+            }
+
+            MorphTargets::Set& morph = primitive.Morph;
+            if (!reader.Read(morph.TargetCount) || !reader.ReadVector(morph.Vertices) ||
+                !reader.ReadVector(morph.BasePositions) || !reader.ReadVector(morph.BaseNormals) ||
+                !reader.ReadVector(morph.PositionDeltas) || !reader.ReadVector(morph.NormalDeltas)) {
+                return false;
+            }
+
+            // 크기가 맞지 않으면 손상된 것으로 판단
+            size_t floatCount = morph.Vertices.size() * 3;
+            if (morph.BasePositions.size() != floatCount || morph.BaseNormals.size() != floatCount ||
+                morph.PositionDeltas.size() != floatCount * morph.TargetCount ||
+                (!morph.NormalDeltas.empty() && morph.NormalDeltas.size() != floatCount * morph.TargetCount)) {
+                return false;
             }
+            for (uint32_t vertex : morph.Vertices) {
+                if (vertex >= primitive.Vertices.size()) {
+                    return false;
+                }
+            }
+
+            primitive.Bounds = BoundingVolumes::FromVertices(primitive.Vertices);
         }
     }
-    
+
+    // 애니메이션
+    uint64_t animationCount = 0;
+    if (!reader.ReadCount(animationCount)) {
+        return false;
+    }
+    animations.resize(static_cast<size_t>(animationCount));
+    for (auto& animation : animations) {
+        uint64_t channelCount = 0;
+        if (!reader.ReadString(animation.Name) || !reader.Read(animation.StartTime) ||
+            !reader.Read(animation.EndTime) || !reader.ReadCount(channelCount)) {
+            return false;
+        }
+        animation.Channels.resize(static_cast<size_t>(channelCount));
+        for (auto& channel : animation.Channels) {
+            if (!reader.Read(channel.NodeIndex) || !reader.Read(channel.Path) || !reader.Read(channel.Mode) ||
+                !reader.ReadVector(channel.Times) || !reader.ReadVector(channel.Values) ||
+                !reader.Read(channel.TargetCount) || !reader.ReadVector(channel.Weights)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void GltfLoader::AutoResizeModel()
+{
+    // 로드 시 계산한 바운딩 박스 사용
+    const BoundingBox& box = bounds;
+
+    // 매우 큰 모델인 경우에만 크기 조정 (비정상적인 크기 방지)
+    float maxDimension = max(max(
+        abs(box.max.x - box.min.x),
+        abs(box.max.y - box.min.y)),
+        abs(box.max.z - box.min.z));
+
+    if (maxDimension > 10.0f) {
+        // 적절한 크기로 스케일 조정
+        float scale = 1.0f / (maxDimension / 10.0f);
+        modelInfo.Scale = XMFLOAT3(scale, scale, scale);
+
+        
+    }
+
+    // 중심 조정 (선택적)
+    modelInfo.Position = XMFLOAT3(
+        -box.center.x,
+        -box.center.y,
+        -box.center.z);
+}
+
+bool GltfLoader::LoadTextureFromBuffer(const TextureImage& image, ID3D11Device* device, ID3D11ShaderResourceView** textureView)
+{
+    // 처리된 데이터가 있는지 확인 (디코딩, 밉 생성, 압축은 DecodeTextureImages 단계에서 수행)
+    const TextureProcessor::Result& processed = image.Processed;
+    if (!processed.IsValid()) {
+        if (!image.Encoded.empty()) {
+            std::cerr << "Failed to decode texture image: " << image.Name << std::endl;
+        }
+        return false;
+    }
+
+    // 텍스처 설명 구조체 설정
+    D3D11_TEXTURE2D_DESC textureDesc = {};
+    textureDesc.Width = processed.Width;
+    textureDesc.Height = processed.Height;
+    textureDesc.MipLevels = static_cast<UINT>(processed.Levels.size());
+    textureDesc.ArraySize = 1;
+    textureDesc.Format = processed.Format;
+    textureDesc.SampleDesc.Count = 1;
+    textureDesc.SampleDesc.Quality = 0;
+    textureDesc.Usage = D3D11_USAGE_DEFAULT;
+    textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    textureDesc.CPUAccessFlags = 0;
+    textureDesc.MiscFlags = 0;
+
+    // 밉 레벨별 초기 데이터 설정
+    std::vector<D3D11_SUBRESOURCE_DATA> initData(processed.Levels.size());
+    for (size_t level = 0; level < processed.Levels.size(); level++) {
+        initData[level].pSysMem = processed.Pixels.data() + processed.Levels[level].Offset;
+        initData[level].SysMemPitch = processed.Levels[level].RowPitch;
+        initData[level].SysMemSlicePitch = 0; // 3D 텍스처가 아니므로 무시됨
+    }
+
+    // 텍스처 생성
+    ID3D11Texture2D* texture2D = nullptr;
+    HRESULT hr = device->CreateTexture2D(&textureDesc, initData.data(), &texture2D);
+
+    if (SUCCEEDED(hr) && texture2D) {
+        // 셰이더 리소스 뷰 생성
+        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+        srvDesc.Format = textureDesc.Format;
+        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+        srvDesc.Texture2D.MostDetailedMip = 0;
+        srvDesc.Texture2D.MipLevels = textureDesc.MipLevels;
+
+        hr = device->CreateShaderResourceView(texture2D, &srvDesc, textureView);
+        texture2D->Release(); // 셰이더 리소스 뷰만 필요하므로 텍스처 리소스는 해제
+
+        if (SUCCEEDED(hr)) {
+            return true;
+        }
+    }
+
     std::cerr << "Failed to create texture from memory." << std::endl;
     return false;
 }
@@ -1115,6 +1759,20 @@ bool GltfLoader::CreateBuffers(ID3D11Device* device, MeshPrimitive& primitive)
         return false;
     }
 
+    // 스키닝/모프 출력용 동적 버퍼 두 개 (처음에는 바인드 포즈)
+    if (primitive.SkinIndex >= 0 || !primitive.Morph.IsEmpty()) {
+        D3D11_BUFFER_DESC skinnedDesc = vbDesc;
+        skinnedDesc.Usage = D3D11_USAGE_DYNAMIC;
+        skinnedDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        for (auto& dynamicBuffer : primitive.DynamicBuffers) {
+            hr = device->CreateBuffer(&skinnedDesc, &vbData, &dynamicBuffer);
+            if (FAILED(hr)) {
+                return false;
+            }
+        }
+        primitive.DynamicBufferIndex = 0;
+    }
+
     // 인덱스 버퍼가 있는 경우에만 생성
     if (!primitive.Indices.empty()) {
         D3D11_BUFFER_DESC ibDesc;
@@ -1137,46 +1795,65 @@ bool GltfLoader::CreateBuffers(ID3D11Device* device, MeshPrimitive& primitive)
     return true;
 }
 
-bool GltfLoader::CreateShaders(ID3D11Device* device)
+namespace {
+    // 컴파일된 GLB 셰이더 바이트코드 - 프로세스가 끝날 때까지 유지하고 모든 로더가 공유
+    std::mutex shaderCompileMutex;
+    ID3DBlob* compiledVertexShader = nullptr;
+    ID3DBlob* compiledPixelShader = nullptr;
+    bool shaderCompileFailed = false;
+}
+
+bool GltfLoader::CompileShaders()
 {
-    // 셰이더 컴파일 및 생성
-    ID3DBlob* vsBlob = nullptr;
-    ID3DBlob* psBlob = nullptr;
-    ID3DBlob* errorBlob = nullptr;
+    std::lock_guard<std::mutex> lock(shaderCompileMutex);
+    if (compiledVertexShader && compiledPixelShader) {
+        return true;
+    }
+    if (shaderCompileFailed) {
+        return false;
+    }
 
-    // 정점 셰이더 컴파일
-    HRESULT hr = D3DCompile(glbVertexShaderCode, strlen(glbVertexShaderCode), "VS", nullptr, nullptr, "main", "vs_4_0", 0, 0, &vsBlob, &errorBlob);
-    if (FAILED(hr)) {
+    auto compile = [](const char* source, const char* name, const char* target, ID3DBlob** blob) {
+        ID3DBlob* errorBlob = nullptr;
+        HRESULT hr = D3DCompile(source, strlen(source), name, nullptr, nullptr, "main", target, 0, 0, blob, &errorBlob);
         if (errorBlob) {
             OutputDebugStringA((char*)errorBlob->GetBufferPointer());
             errorBlob->Release();
         }
+        return SUCCEEDED(hr);
+    };
+
+    // 정점 셰이더와 픽셀 셰이더 컴파일
+    auto compileStart = std::chrono::high_resolution_clock::now();
+    if (!compile(glbVertexShaderCode, "VS", "vs_4_0", &compiledVertexShader) ||
+        !compile(glbPixelShaderCode, "PS", "ps_4_0", &compiledPixelShader)) {
+        shaderCompileFailed = true;
         return false;
     }
 
-    // 픽셀 셰이더 컴파일
-    hr = D3DCompile(glbPixelShaderCode, strlen(glbPixelShaderCode), "PS", nullptr, nullptr, "main", "ps_4_0", 0, 0, &psBlob, &errorBlob);
-    if (FAILED(hr)) {
-        if (errorBlob) {
-            OutputDebugStringA((char*)errorBlob->GetBufferPointer());
-            errorBlob->Release();
-        }
-        if (vsBlob) vsBlob->Release();
+    OutputDebugStringA(("GLB shaders compiled in " + std::to_string(std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - compileStart).count()) + " ms\n").c_str());
+    return true;
+}
+
+bool GltfLoader::CreateShaders(ID3D11Device* device)
+{
+    // 바이트코드는 텍스처 디코딩 단계에서 미리 컴파일됨 (없으면 여기서 컴파일)
+    if (!CompileShaders()) {
         return false;
     }
 
+    ID3DBlob* vsBlob = compiledVertexShader;
+    ID3DBlob* psBlob = compiledPixelShader;
+
     // 셰이더 생성
-    hr = device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), nullptr, &vertexShader);
+    HRESULT hr = device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), nullptr, &vertexShader);
     if (FAILED(hr)) {
-        vsBlob->Release();
-        psBlob->Release();
         return false;
     }
 
     hr = device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &pixelShader);
     if (FAILED(hr)) {
-        vsBlob->Release();
-        psBlob->Release();
         return false;
     }
 
@@ -1191,20 +1868,12 @@ bool GltfLoader::CreateShaders(ID3D11Device* device)
     };
 
     hr = device->CreateInputLayout(layout, ARRAYSIZE(layout), vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), &inputLayout);
-    vsBlob->Release();
-    psBlob->Release();
     if (FAILED(hr)) {
         return false;
     }
 
-    // 상수 버퍼 생성
-    D3D11_BUFFER_DESC cbDesc;
-    ZeroMemory(&cbDesc, sizeof(cbDesc));
-    cbDesc.Usage = D3D11_USAGE_DEFAULT;
-    cbDesc.ByteWidth = sizeof(ConstantBuffer);
-    cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    hr = device->CreateBuffer(&cbDesc, nullptr, &constantBuffer);
-    if (FAILED(hr)) {
+    // 오브젝트별 상수 버퍼 생성 (재질 버퍼는 재질마다 처음 그릴 때 생성)
+    if (!ConstantBuffers::Create(device, sizeof(ObjectConstants), &constantBuffer)) {
         return false;
     }
 
@@ -1214,7 +1883,12 @@ bool GltfLoader::CreateShaders(ID3D11Device* device)
 // Render 함수 수정하여 계층 구조를 올바르게 렌더링
 void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera)
 {
-    if (!modelInfo.Visible || meshes.empty()) {
+    Render(deviceContext, camera, modelInfo);
+}
+
+void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, const ModelInfo& instance)
+{
+    if (!instance.Visible || meshes.empty()) {
         return;
     }
 
@@ -1227,19 +1901,34 @@ void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera
     // 샘플러 상태 설정
     deviceContext->PSSetSamplers(0, 1, &samplerState);
 
-    // 전역 월드 변환 행렬
-    XMMATRIX globalWorldMatrix = CalculateWorldMatrix();
+    // 오브젝트별 상수 버퍼 (노드마다 RenderNode에서 올림, 뷰/투영/카메라 위치는 ModelManager가 프레임마다 b2로 올림)
+    deviceContext->VSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
+    deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
 
-    // 루트 노드부터 시작하여 계층적으로 렌더링
-    for (int rootNodeIdx : rootNodes) {
-        RenderNode(deviceContext, camera, rootNodeIdx, globalWorldMatrix);
+    // 전역 월드 변환 행렬
+    XMMATRIX globalWorldMatrix = CalculateWorldMatrix(instance);
+
+    // 바뀐 노드의 월드 행렬만 갱신한 뒤 평탄화된 순서로 메시가 있는 노드만 렌더링
+    UpdateWorldTransforms();
+    UpdateMorphTargets(deviceContext);
+    UpdateSkinning(deviceContext);
+    for (int nodeIndex : nodeOrder) {
+        if (nodes[nodeIndex].MeshIndex >= 0) {
+            RenderNode(deviceContext, camera, nodeIndex, globalWorldMatrix, instance.Override);
+        }
     }
 }
 
 // GltfLoader.cpp에 추가 - constantBuffer 사용 버전
 void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager)
 {
-    if (!modelInfo.Visible || meshes.empty()) {
+    Render(deviceContext, camera, lightManager, modelInfo);
+}
+
+void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager,
+    const ModelInfo& instance)
+{
+    if (!instance.Visible || meshes.empty()) {
         return;
     }
 
@@ -1259,28 +1948,29 @@ void GltfLoader::Render(ID3D11DeviceContext* deviceContext, const Camera& camera
     // 샘플러 상태 설정
     deviceContext->PSSetSamplers(0, 1, &samplerState);
 
-    // 전역 월드 변환 행렬
-    XMMATRIX globalWorldMatrix = CalculateWorldMatrix();
+    // 오브젝트별 상수 버퍼 (노드마다 RenderNode에서 올림, 뷰/투영/카메라 위치는 ModelManager가 프레임마다 b2로 올림)
+    deviceContext->VSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
+    deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
 
-    // 조명 정보 설정 (조명 관리자가 있을 경우)
-    if (lightManager) {
-        lightManager->UpdateLightBuffer(deviceContext);
-        lightManager->SetLightBuffer(deviceContext);
+    // 전역 월드 변환 행렬
+    XMMATRIX globalWorldMatrix = CalculateWorldMatrix(instance);
 
-        // 디버깅용 로그
-        OutputDebugStringA("GLB 모델에 조명 정보가 적용되었습니다.\n");
-        OutputDebugStringA(("조명 개수: " + std::to_string(lightManager->GetLightCount()) + "\n").c_str());
-    }
+    // 조명 상수 버퍼는 ModelManager가 프레임마다 한 번 올리고 바인딩
 
-    // 루트 노드부터 시작하여 계층적으로 렌더링
-    for (int rootNodeIdx : rootNodes) {
-        RenderNode(deviceContext, camera, rootNodeIdx, globalWorldMatrix);
+    // 바뀐 노드의 월드 행렬만 갱신한 뒤 평탄화된 순서로 메시가 있는 노드만 렌더링
+    UpdateWorldTransforms();
+    UpdateMorphTargets(deviceContext);
+    UpdateSkinning(deviceContext);
+    for (int nodeIndex : nodeOrder) {
+        if (nodes[nodeIndex].MeshIndex >= 0) {
+            RenderNode(deviceContext, camera, nodeIndex, globalWorldMatrix, instance.Override);
+        }
     }
 }
 
 // 노드 렌더링 함수 추가
 void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& camera,
-    int nodeIndex, XMMATRIX parentTransform)
+    int nodeIndex, FXMMATRIX instanceTransform, const MaterialOverride& materialOverride)
 {
     if (nodeIndex < 0 || nodeIndex >= nodes.size()) {
         return;
@@ -1288,49 +1978,17 @@ void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& ca
 
     const Node& node = nodes[nodeIndex];
 
-    // 노드 변환 행렬과 부모 변환 행렬 결합
-    XMMATRIX localTransform = node.LocalTransform;
-    XMMATRIX worldTransform = XMMatrixMultiply(localTransform, parentTransform);
-
-    
-    // 노드 변환 행렬 결합 - 부모 변환을 "오른쪽에서" 곱하여 올바른 계층 구조 유지
-    XMMATRIX nodeTransform = XMMatrixMultiply(node.LocalTransform, parentTransform);
-
-    // 디버그용 스케일 검사 (비정상적인 크기 확인)
-    XMVECTOR scale, rotation, translation;
-    XMMatrixDecompose(&scale, &rotation, &translation, nodeTransform);
-
-    // 올바른 방법으로 scale 값 추출
-    XMFLOAT3 scaleFloat;
-    XMStoreFloat3(&scaleFloat, scale);
-    float scaleX = scaleFloat.x;
-    float scaleY = scaleFloat.y;
-    float scaleZ = scaleFloat.z;
-
-    // 기존 코드에서 잘못된 부분:
-    //XMStoreFloat3(XMFLOAT3(scaleX, scaleY, scaleZ), scale);
-
-    // 스케일이 비정상적으로 큰 경우 고정
-    const float MAX_SCALE = 100.0f;
-    if (scaleX > MAX_SCALE || scaleY > MAX_SCALE || scaleZ > MAX_SCALE) {
-        // 스케일 제한
-        scaleX = min(scaleX, MAX_SCALE);
-        scaleY = min(scaleY, MAX_SCALE);
-        scaleZ = min(scaleZ, MAX_SCALE);
-
-        // 새 스케일로 변환 행렬 재구성
-        XMFLOAT3 newScale(scaleX, scaleY, scaleZ);
-        scale = XMLoadFloat3(&newScale);
-        nodeTransform = XMMatrixTransformation(
-            XMVectorZero(), XMQuaternionIdentity(),
-            scale, XMVectorZero(), rotation, translation);
-    }
-
+    // 캐시된 모델 공간 월드 행렬에 인스턴스 변환 적용
+    XMMATRIX worldTransform = XMMatrixMultiply(worldTransforms[nodeIndex], instanceTransform);
 
     // 현재 노드에 메시가 있으면 렌더링
     if (node.MeshIndex >= 0 && node.MeshIndex < meshes.size()) {
         const auto& mesh = meshes[node.MeshIndex];
 
+        // 오브젝트별 상수는 노드마다 한 번 (스키닝된 프리미티브는 인스턴스 변환을 쓰므로 바뀔 때만 다시 올림)
+        bool objectUploaded = false;
+        bool uploadedSkinned = false;
+
         for (const auto& primitive : mesh.Primitives) {
             if (!primitive.VertexBuffer || !primitive.IndexBuffer) {
                 continue;
@@ -1346,33 +2004,50 @@ void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& ca
             }
             else {
                 // 기본 재질
-                static PbrMaterial defaultMaterial;
-                defaultMaterial.Name = "default";
                 material = &defaultMaterial;
             }
 
-            // 상수 버퍼 업데이트
-            ConstantBuffer cb;
-            cb.World = XMMatrixTranspose(worldTransform);
-            cb.View = XMMatrixTranspose(camera.GetViewMatrix());
-            cb.Projection = XMMatrixTranspose(camera.GetProjectionMatrix());
-
-            // PBR 재질 정보 설정
-            cb.BaseColorFactor = material->BaseColorFactor;
-            cb.EmissiveFactor = material->EmissiveFactor;
-            cb.MetallicFactor = material->MetallicFactor;
-            cb.RoughnessFactor = material->RoughnessFactor;
-
-            // 텍스처 유무 설정
-            cb.HasBaseColorTexture = (material->BaseColorTexture != nullptr) ? 1.0f : 0.0f;
-            cb.HasMetallicRoughnessTexture = (material->MetallicRoughnessTexture != nullptr) ? 1.0f : 0.0f;
-            cb.HasNormalTexture = (material->NormalTexture != nullptr) ? 1.0f : 0.0f;
-            cb.HasEmissiveTexture = (material->EmissiveTexture != nullptr) ? 1.0f : 0.0f;
-            cb.HasOcclusionTexture = (material->OcclusionTexture != nullptr) ? 1.0f : 0.0f;
+            // CPU에서 변형한 정점은 동적 버퍼에서 읽음
+            // 스키닝된 정점은 이미 모델 공간이므로 노드 변환 없이 인스턴스 변환만 적용
+            ID3D11Buffer* dynamicBuffer = primitive.DynamicBuffers[primitive.DynamicBufferIndex];
+            bool skinned = primitive.SkinIndex >= 0 && dynamicBuffer;
+            ID3D11Buffer* vertexBuffer = dynamicBuffer ? dynamicBuffer : primitive.VertexBuffer;
+
+            // 오브젝트별 상수 업데이트 (인스턴스 재질 덮어쓰기 포함, 공유 재질은 그대로 둠)
+            if (!objectUploaded || uploadedSkinned != skinned) {
+                ObjectConstants objectConstants = ConstantBuffers::MakeObjectConstants(
+                    skinned ? XMMATRIX(instanceTransform) : worldTransform, materialOverride);
+                if (!ConstantBuffers::Update(deviceContext, &constantBuffer, &objectConstants, sizeof(ObjectConstants),
+                    ConstantBuffers::FREQUENCY_OBJECT)) {
+                    return;
+                }
+                objectUploaded = true;
+                uploadedSkinned = skinned;
+            }
 
-            deviceContext->UpdateSubresource(constantBuffer, 0, nullptr, &cb, 0, 0);
-            deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
-            deviceContext->PSSetConstantBuffers(0, 1, &constantBuffer);
+            // PBR 재질 상수는 바뀐 경우만 다시 채워서 올림
+            if (material->ConstantsDirty || !material->ConstantBuffer) {
+                PbrMaterialConstants materialConstants;
+                materialConstants.BaseColorFactor = material->BaseColorFactor;
+                materialConstants.EmissiveFactor = material->EmissiveFactor;
+                materialConstants.MetallicFactor = material->MetallicFactor;
+                materialConstants.RoughnessFactor = material->RoughnessFactor;
+
+                // 텍스처 유무 설정
+                materialConstants.HasBaseColorTexture = (material->BaseColorTexture != nullptr) ? 1.0f : 0.0f;
+                materialConstants.HasMetallicRoughnessTexture = (material->MetallicRoughnessTexture != nullptr) ? 1.0f : 0.0f;
+                materialConstants.HasNormalTexture = (material->NormalTexture != nullptr) ? 1.0f : 0.0f;
+                materialConstants.HasEmissiveTexture = (material->EmissiveTexture != nullptr) ? 1.0f : 0.0f;
+                materialConstants.HasOcclusionTexture = (material->OcclusionTexture != nullptr) ? 1.0f : 0.0f;
+                materialConstants.Padding = XMFLOAT2(0.0f, 0.0f);
+
+                if (!ConstantBuffers::Update(deviceContext, &material->ConstantBuffer, &materialConstants,
+                    sizeof(PbrMaterialConstants), ConstantBuffers::FREQUENCY_MATERIAL)) {
+                    continue;
+                }
+                material->ConstantsDirty = false;
+            }
+            deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_MATERIAL, 1, &material->ConstantBuffer);
 
             // 텍스처 설정
             ID3D11ShaderResourceView* textures[5] = {
@@ -1387,7 +2062,7 @@ void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& ca
             // 버텍스 및 인덱스 버퍼 설정
             UINT stride = sizeof(Vertex);
             UINT offset = 0;
-            deviceContext->IASetVertexBuffers(0, 1, &primitive.VertexBuffer, &stride, &offset);
+            deviceContext->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
             deviceContext->IASetIndexBuffer(primitive.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
             // 래스터라이저 상태 설정
@@ -1395,13 +2070,9 @@ void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& ca
 
             // 그리기
             deviceContext->DrawIndexed(primitive.IndexCount, 0, 0);
+            ConstantBuffers::RecordDraw(sizeof(PbrMaterialConstants));
         }
     }
-
-    // 자식 노드들 재귀적으로 렌더링
-    for (int childIndex : node.Children) {
-        RenderNode(deviceContext, camera, childIndex, worldTransform);
-    }
 }
 
 //void GltfLoader::UpdateAnimation(float deltaTime)
@@ -1488,42 +2159,545 @@ void GltfLoader::RenderNode(ID3D11DeviceContext* deviceContext, const Camera& ca
 //    }
 //}
 
-// GltfLoader.cpp의 CalculateNodeTransform 함수를 수정
 XMMATRIX GltfLoader::CalculateNodeTransform(int nodeIndex)
 {
-    if (nodeIndex < 0 || nodeIndex >= nodes.size()) {
+    if (nodeIndex < 0 || nodeIndex >= worldTransforms.size()) {
         return XMMatrixIdentity();
     }
 
-    const Node& node = nodes[nodeIndex];
-    XMMATRIX localTransform = node.LocalTransform;
+    UpdateWorldTransforms();
+    return worldTransforms[nodeIndex];
+}
+
+void GltfLoader::BuildNodeHierarchy()
+{
+    // 비정상적으로 큰 크기 보정 - 매 프레임 노드마다 분해해서 검사하던 것을 가져올 때 한 번만 수행
+    const float MAX_SCALE = 100.0f;
+    size_t sanitizedNodes = 0;
+    for (auto& node : nodes) {
+        XMVECTOR scale, rotation, translation;
+        if (!XMMatrixDecompose(&scale, &rotation, &translation, node.LocalTransform)) {
+            continue;
+        }
+
+        XMFLOAT3 scaleFloat;
+        XMStoreFloat3(&scaleFloat, scale);
+        if (scaleFloat.x > MAX_SCALE || scaleFloat.y > MAX_SCALE || scaleFloat.z > MAX_SCALE) {
+            scaleFloat.x = min(scaleFloat.x, MAX_SCALE);
+            scaleFloat.y = min(scaleFloat.y, MAX_SCALE);
+            scaleFloat.z = min(scaleFloat.z, MAX_SCALE);
+            node.LocalTransform = XMMatrixAffineTransformation(XMLoadFloat3(&scaleFloat), XMVectorZero(), rotation, translation);
+            sanitizedNodes++;
+        }
+    }
+    if (sanitizedNodes > 0) {
+        OutputDebugStringA(("GLB node scale clamped: " + std::to_string(sanitizedNodes) + " nodes\n").c_str());
+    }
+
+    // 루트부터 깊이 우선으로 방문해서 부모가 자식보다 앞에 오는 순서 생성 (부모 찾기를 위한 전체 탐색 제거)
+    nodeParents.assign(nodes.size(), -1);
+    nodeOrder.clear();
+    nodeOrder.reserve(nodes.size());
+
+    std::vector<uint8_t> visited(nodes.size(), 0);
+    std::vector<int> stack;
+    for (int root : rootNodes) {
+        if (root < 0 || root >= nodes.size() || visited[root]) {
+            continue;
+        }
+
+        visited[root] = 1;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            int nodeIndex = stack.back();
+            stack.pop_back();
+            nodeOrder.push_back(nodeIndex);
+
+            // 자식을 역순으로 넣어서 원래 순서대로 방문 (잘못된 인덱스와 순환 참조는 무시)
+            const auto& children = nodes[nodeIndex].Children;
+            for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                int child = *it;
+                if (child < 0 || child >= nodes.size() || visited[child]) {
+                    continue;
+                }
+                visited[child] = 1;
+                nodeParents[child] = nodeIndex;
+                stack.push_back(child);
+            }
+        }
+    }
+
+    // 처음에는 모든 노드의 월드 행렬 계산
+    worldTransforms.assign(nodes.size(), XMMatrixIdentity());
+    dirtyNodes.assign(nodes.size(), 1);
+    hierarchyDirty = true;
+    UpdateWorldTransforms();
+}
+
+void GltfLoader::MarkNodeDirty(size_t nodeIndex)
+{
+    if (nodeIndex < dirtyNodes.size()) {
+        dirtyNodes[nodeIndex] = 1;
+        hierarchyDirty = true;
+    }
+}
+
+void GltfLoader::UpdateWorldTransforms()
+{
+    if (!hierarchyDirty) {
+        return;
+    }
+
+    // 부모가 먼저 처리되므로 부모의 표시를 자식에게 전파하면서 한 번에 갱신
+    for (int nodeIndex : nodeOrder) {
+        int parent = nodeParents[nodeIndex];
+        if (parent >= 0 && dirtyNodes[parent]) {
+            dirtyNodes[nodeIndex] = 1;
+        }
+
+        if (dirtyNodes[nodeIndex]) {
+            worldTransforms[nodeIndex] = parent >= 0 ?
+                XMMatrixMultiply(nodes[nodeIndex].LocalTransform, worldTransforms[parent]) :
+                nodes[nodeIndex].LocalTransform;
+        }
+    }
+
+    std::fill(dirtyNodes.begin(), dirtyNodes.end(), 0);
+    hierarchyDirty = false;
+    boundsDirty = true;
+
+    // 조인트가 움직였을 수 있으므로 다음 렌더링에서 다시 스키닝
+    if (!skins.empty()) {
+        skinningDirty = true;
+    }
+}
+
+void GltfLoader::UpdateAnimatedBounds()
+{
+    if (!boundsDirty) {
+        return;
+    }
+    boundsDirty = false;
+
+    bool hasMeshes = false;
+    for (int nodeIndex : nodeOrder) {
+        int meshIndex = nodes[nodeIndex].MeshIndex;
+        if (meshIndex < 0 || meshIndex >= meshes.size()) {
+            continue;
+        }
+
+        // 스키닝된 메시는 노드 변환 없이 모델 공간으로 렌더링하므로 마지막 스키닝 결과의 박스를 사용
+        // (아직 스키닝하지 않은 프리미티브는 바인드 포즈 박스)
+        const Mesh& mesh = meshes[meshIndex];
+        bool skinned = !mesh.Primitives.empty() && mesh.Primitives[0].SkinIndex >= 0;
+        BoundingBox meshBounds;
+        if (skinned) {
+            bool hasPrimitives = false;
+            for (const auto& primitive : mesh.Primitives) {
+                if (primitive.Vertices.empty()) {
+                    continue;
+                }
+                const BoundingBox& primitiveBounds = primitive.SkinnedVertices.empty() ? primitive.Bounds : primitive.SkinnedBounds;
+                meshBounds = hasPrimitives ? BoundingVolumes::Merge(meshBounds, primitiveBounds) : primitiveBounds;
+                hasPrimitives = true;
+            }
+            if (!hasPrimitives) {
+                meshBounds = mesh.Bounds;
+            }
+        }
+        else {
+            meshBounds = BoundingVolumes::Transform(mesh.Bounds, worldTransforms[nodeIndex]);
+        }
+        animatedBounds = hasMeshes ? BoundingVolumes::Merge(animatedBounds, meshBounds) : meshBounds;
+        hasMeshes = true;
+    }
+
+    if (!hasMeshes) {
+        animatedBounds = bounds;
+    }
+}
+
+void GltfLoader::AssignDeformedPrimitives()
+{
+    // 메시별 로컬 바운딩 박스 (현재 포즈 바운딩 박스 계산용) - 프리미티브 박스를 합침
+    for (auto& mesh : meshes) {
+        mesh.Bounds = BoundingVolumes::FromMinMax(XMVectorZero(), XMVectorZero());
+        bool hasVertices = false;
+        for (const auto& primitive : mesh.Primitives) {
+            if (primitive.Vertices.empty()) {
+                continue;
+            }
+            mesh.Bounds = hasVertices ? BoundingVolumes::Merge(mesh.Bounds, primitive.Bounds) : primitive.Bounds;
+            hasVertices = true;
+        }
+    }
+    boundsDirty = true;
 
-    // 부모 노드가 있는 경우 부모의 변환을 포함
     for (size_t i = 0; i < nodes.size(); i++) {
-        const Node& potentialParent = nodes[i];
+        Node& node = nodes[i];
+        if (node.MeshIndex < 0 || node.MeshIndex >= meshes.size()) {
+            continue;
+        }
+        Mesh& mesh = meshes[node.MeshIndex];
+
+        if (node.SkinIndex >= 0 && node.SkinIndex < skins.size()) {
+            for (auto& primitive : mesh.Primitives) {
+                if (primitive.SkinIndex < 0) {
+                    primitive.SkinIndex = node.SkinIndex;
+                }
+            }
+        }
+
+        // 모프 타깃 메시는 처음 사용하는 노드의 가중치로 섞음 (노드에 가중치가 없으면 메시 기본값)
+        bool morphed = std::any_of(mesh.Primitives.begin(), mesh.Primitives.end(),
+            [](const MeshPrimitive& primitive) { return !primitive.Morph.IsEmpty(); });
+        if (morphed) {
+            if (node.Weights.empty()) {
+                node.Weights = mesh.Weights;
+            }
+            if (mesh.MorphNode < 0) {
+                mesh.MorphNode = static_cast<int>(i);
+            }
+        }
+    }
+
+    skinningDirty = !skins.empty();
+}
 
-        // 현재 노드가 이 노드의 자식인지 확인
-        auto it = std::find(potentialParent.Children.begin(), potentialParent.Children.end(), nodeIndex);
-        if (it != potentialParent.Children.end()) {
-            // 부모 변환 계산하여 적용
-            XMMATRIX parentTransform = CalculateNodeTransform(i);
-            return XMMatrixMultiply(localTransform, parentTransform);
+void GltfLoader::BuildPickingBvhs()
+{
+    // 피킹 BVH는 캐시에 저장하지 않고 가져올 때마다 프리미티브에서 생성
+    auto buildStart = std::chrono::high_resolution_clock::now();
+    size_t triangleCount = 0;
+    for (auto& mesh : meshes) {
+        for (auto& primitive : mesh.Primitives) {
+            primitive.Picking.Build(primitive.Vertices, primitive.Indices);
+            triangleCount += primitive.Picking.GetTriangleCount();
         }
     }
 
-    // 부모가 없으면 로컬 변환만 반환
-    return localTransform;
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - buildStart).count();
+    OutputDebugStringA(("GLB picking BVH: " + std::to_string(triangleCount) + " triangles in " +
+        std::to_string(buildMs) + " ms\n").c_str());
 }
 
-XMMATRIX GltfLoader::CalculateWorldMatrix()
+bool GltfLoader::Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, const ModelInfo& instance, RayHit& hit) const
 {
-    // 월드 행렬 계산 (모델의 전역 변환)
-    XMMATRIX scale = XMMatrixScaling(modelInfo.Scale.x, modelInfo.Scale.y, modelInfo.Scale.z);
+    XMMATRIX instanceWorld = CalculateWorldMatrix(instance);
+    XMVECTOR worldOrigin = XMLoadFloat3(&origin);
+    XMVECTOR worldDirection = XMLoadFloat3(&direction);
+
+    bool found = false;
+    for (int nodeIndex : nodeOrder) {
+        int meshIndex = nodes[nodeIndex].MeshIndex;
+        if (meshIndex < 0 || meshIndex >= meshes.size()) {
+            continue;
+        }
+
+        // 렌더링과 같은 변환 - 스키닝된 정점은 모델 공간이므로 인스턴스 변환만 적용 (BVH는 스키닝할 때 현재 포즈로 refit)
+        // 레이를 노드 로컬 공간으로 역변환하고 방향은 정규화하지 않으므로 교차 거리는 월드 레이 기준 그대로
+        const Mesh& mesh = meshes[meshIndex];
+        bool skinned = !mesh.Primitives.empty() && mesh.Primitives[0].SkinIndex >= 0;
+        XMMATRIX world = skinned ? instanceWorld : XMMatrixMultiply(worldTransforms[nodeIndex], instanceWorld);
+        XMMATRIX inverseWorld = XMMatrixInverse(nullptr, world);
+
+        XMFLOAT3 localOrigin;
+        XMFLOAT3 localDirection;
+        XMStoreFloat3(&localOrigin, XMVector3TransformCoord(worldOrigin, inverseWorld));
+        XMStoreFloat3(&localDirection, XMVector3TransformNormal(worldDirection, inverseWorld));
+
+        for (size_t i = 0; i < mesh.Primitives.size(); i++) {
+            int triangle = -1;
+            if (mesh.Primitives[i].Picking.Raycast(localOrigin, localDirection, hit.Distance, triangle)) {
+                hit.Node = nodeIndex;
+                hit.Mesh = meshIndex;
+                hit.Primitive = static_cast<int>(i);
+                hit.Triangle = triangle;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+void GltfLoader::UploadDynamicVertices(ID3D11DeviceContext* deviceContext, MeshPrimitive& primitive,
+    const std::vector<Vertex>& vertices)
+{
+    UINT nextIndex = 1 - primitive.DynamicBufferIndex;
+    if (!primitive.DynamicBuffers[nextIndex] || vertices.size() != primitive.Vertices.size()) {
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (SUCCEEDED(deviceContext->Map(primitive.DynamicBuffers[nextIndex], 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+        memcpy(mapped.pData, vertices.data(), vertices.size() * sizeof(Vertex));
+        deviceContext->Unmap(primitive.DynamicBuffers[nextIndex], 0);
+        primitive.DynamicBufferIndex = nextIndex;
+    }
+}
+
+void GltfLoader::UpdateMorphTargets(ID3D11DeviceContext* deviceContext)
+{
+    const auto& weightsDirty = animationState.WeightsDirty;
+    for (auto& mesh : meshes) {
+        if (mesh.MorphNode < 0 || mesh.MorphNode >= weightsDirty.size() || !weightsDirty[mesh.MorphNode]) {
+            continue;
+        }
+
+        // 가중치가 이전 평가와 같으면 표시되지 않으므로 여기까지 오지 않음
+        animationState.WeightsDirty[mesh.MorphNode] = 0;
+        const std::vector<float>& weights = animationState.Current.Weights[mesh.MorphNode];
+
+        for (auto& primitive : mesh.Primitives) {
+            if (primitive.Morph.IsEmpty() || !primitive.DynamicBuffers[0]) {
+                continue;
+            }
+
+            if (primitive.MorphedVertices.size() != primitive.Vertices.size()) {
+                primitive.MorphedVertices = primitive.Vertices;
+            }
+            MorphTargets::Blend(primitive.Morph, weights.data(), weights.size(), primitive.MorphedVertices.data(),
+                sizeof(Vertex), offsetof(Vertex, Position), offsetof(Vertex, Normal), morphScratch);
+
+            // 스키닝하는 프리미티브는 스키닝 결과를 올림
+            if (primitive.SkinIndex >= 0) {
+                skinningDirty = true;
+            }
+            else {
+                UploadDynamicVertices(deviceContext, primitive, primitive.MorphedVertices);
+            }
+        }
+    }
+}
+
+void GltfLoader::UpdateSkinning(ID3D11DeviceContext* deviceContext)
+{
+    if (!skinningDirty) {
+        return;
+    }
+    skinningDirty = false;
+
+    auto skinStart = std::chrono::high_resolution_clock::now();
+
+    // 1. 스킨별 조인트 행렬 팔레트 (역 바인드 행렬 * 조인트의 모델 공간 월드 행렬)
+    for (auto& skin : skins) {
+        skin.Palette.resize(skin.Joints.size());
+        for (size_t j = 0; j < skin.Joints.size(); j++) {
+            int joint = skin.Joints[j];
+            XMMATRIX jointWorld = joint >= 0 && joint < worldTransforms.size() ? worldTransforms[joint] : XMMatrixIdentity();
+            SkinningKernel::MakeJointMatrix(XMLoadFloat4x4(&skin.InverseBindMatrices[j]) * jointWorld, skin.Palette[j]);
+        }
+    }
+
+    // 2. 스키닝할 정점을 묶음 단위 작업으로 나눠 공유 스레드 풀에서 병렬 처리
+    struct SkinBatch
+    {
+        MeshPrimitive* Primitive;
+        size_t Begin;
+        size_t End;
+    };
+    const size_t batchSize = 4096;
+    std::vector<SkinBatch> batches;
+    size_t vertexCount = 0;
+    for (auto& mesh : meshes) {
+        for (auto& primitive : mesh.Primitives) {
+            if (primitive.SkinIndex < 0 || !primitive.DynamicBuffers[0] || primitive.Vertices.empty()) {
+                continue;
+            }
+
+            primitive.SkinnedVertices.resize(primitive.Vertices.size());
+            for (size_t begin = 0; begin < primitive.Vertices.size(); begin += batchSize) {
+                batches.push_back({ &primitive, begin, (std::min)(begin + batchSize, primitive.Vertices.size()) });
+            }
+            vertexCount += primitive.Vertices.size();
+        }
+    }
+
+    if (batches.empty()) {
+        return;
+    }
+
+    SkinningKernel::Layout layout;
+    layout.Stride = sizeof(Vertex);
+    layout.Position = offsetof(Vertex, Position);
+    layout.Normal = offsetof(Vertex, Normal);
+    layout.Tangent = offsetof(Vertex, Tangent);
+    layout.Weights = offsetof(Vertex, Weights);
+    layout.Joints = offsetof(Vertex, Joints);
+
+    // 모프 타깃이 있으면 섞은 정점을 스키닝
+    ThreadPool::GetShared().ParallelFor(batches.size(), [this, &batches, &layout](size_t i) {
+        const SkinBatch& batch = batches[i];
+        const Skin& skin = skins[batch.Primitive->SkinIndex];
+        const std::vector<Vertex>& source = batch.Primitive->MorphedVertices.empty() ?
+            batch.Primitive->Vertices : batch.Primitive->MorphedVertices;
+        SkinningKernel::Skin(skin.Palette.data(), static_cast<uint32_t>(skin.Palette.size()), layout,
+            source.data(), batch.Primitive->SkinnedVertices.data(), batch.Begin, batch.End);
+    });
+
+    // 3. 스키닝된 프리미티브의 바운딩 박스(SIMD min/max)와 피킹 BVH를 현재 포즈로 갱신
+    auto refitStart = std::chrono::high_resolution_clock::now();
+    std::vector<MeshPrimitive*> skinnedPrimitives;
+    for (const SkinBatch& batch : batches) {
+        if (batch.Begin == 0) {
+            skinnedPrimitives.push_back(batch.Primitive);
+        }
+    }
+    ThreadPool::GetShared().ParallelFor(skinnedPrimitives.size(), [&skinnedPrimitives](size_t i) {
+        MeshPrimitive& primitive = *skinnedPrimitives[i];
+        primitive.SkinnedBounds = BoundingVolumes::FromVertices(primitive.SkinnedVertices);
+        primitive.Picking.Refit(primitive.SkinnedVertices, primitive.Indices);
+    });
+    boundsDirty = true;
+
+    auto uploadStart = std::chrono::high_resolution_clock::now();
+
+    // 4. GPU가 이전 프레임에 읽던 버퍼 대신 다른 동적 버퍼에 업로드
+    for (auto& mesh : meshes) {
+        for (auto& primitive : mesh.Primitives) {
+            if (primitive.SkinIndex < 0 || primitive.SkinnedVertices.empty()) {
+                continue;
+            }
+
+            UploadDynamicVertices(deviceContext, primitive, primitive.SkinnedVertices);
+        }
+    }
+
+    // 처리량 기록 (스키닝 커널 기준, 일정 횟수마다 출력)
+    auto uploadEnd = std::chrono::high_resolution_clock::now();
+    skinnedVertexTotal += vertexCount;
+    skinningMilliseconds += std::chrono::duration<double, std::milli>(refitStart - skinStart).count();
+    skinningPasses++;
+    if (skinningPasses % 300 == 1 && skinningMilliseconds > 0.0) {
+        OutputDebugStringA(("GLB skinning: " + modelInfo.Name + ", " + std::to_string(vertexCount) + " vertices, " +
+            std::to_string(static_cast<uint64_t>(skinnedVertexTotal / skinningMilliseconds)) + " vertices/ms (" +
+            SkinningKernel::GetInstructionSetName() + ", " + std::to_string(ThreadPool::GetShared().GetThreadCount() + 1) +
+            " threads), bounds + BVH refit " + std::to_string(std::chrono::duration<double, std::milli>(uploadStart - refitStart).count()) +
+            " ms, upload " + std::to_string(std::chrono::duration<double, std::milli>(uploadEnd - uploadStart).count()) +
+            " ms\n").c_str());
+    }
+}
+
+namespace {
+    // 기존 렌더링 방식의 변환 계산 (재귀, 노드마다 행렬 곱 두 번과 분해) - 성능 비교용
+    void AccumulateLegacyTransforms(const std::vector<GltfLoader::Node>& nodes, int nodeIndex, FXMMATRIX parentTransform,
+        XMFLOAT4X4& sink)
+    {
+        const GltfLoader::Node& node = nodes[nodeIndex];
+        XMMATRIX worldTransform = XMMatrixMultiply(node.LocalTransform, parentTransform);
+        XMMATRIX nodeTransform = XMMatrixMultiply(node.LocalTransform, parentTransform);
+
+        XMVECTOR scale, rotation, translation;
+        XMMatrixDecompose(&scale, &rotation, &translation, nodeTransform);
+        XMStoreFloat4x4(&sink, worldTransform);
+
+        for (int child : node.Children) {
+            AccumulateLegacyTransforms(nodes, child, worldTransform, sink);
+        }
+    }
+}
+
+void GltfLoader::BenchmarkNodeHierarchy(size_t nodeCount, size_t frameCount)
+{
+    if (nodeCount == 0 || frameCount == 0) {
+        return;
+    }
+
+    // 합성 계층 - 노드마다 자식 4개인 트리 (5,000개면 깊이 7)
+    GltfLoader loader;
+    loader.nodes.resize(nodeCount);
+    for (size_t i = 0; i < nodeCount; i++) {
+        loader.nodes[i].LocalTransform = XMMatrixRotationRollPitchYaw(0.0f, 0.01f * (i % 7), 0.0f) *
+            XMMatrixTranslation(0.1f, 0.0f, 0.05f);
+        if (i > 0) {
+            loader.nodes[(i - 1) / 4].Children.push_back(static_cast<int>(i));
+        }
+    }
+    loader.rootNodes.push_back(0);
+    loader.BuildNodeHierarchy();
+
+    // 프레임마다 움직이는 노드 수 (애니메이션되는 관절 정도의 비율)
+    const size_t animatedNodes = (std::max)(nodeCount / 100, static_cast<size_t>(1));
+    XMFLOAT4X4 sink;
+
+    auto legacyStart = std::chrono::high_resolution_clock::now();
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        AccumulateLegacyTransforms(loader.nodes, 0, XMMatrixIdentity(), sink);
+    }
+
+    auto fullStart = std::chrono::high_resolution_clock::now();
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        for (size_t i = 0; i < nodeCount; i++) {
+            loader.MarkNodeDirty(i);
+        }
+        loader.UpdateWorldTransforms();
+    }
+
+    auto dirtyStart = std::chrono::high_resolution_clock::now();
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        for (size_t k = 0; k < animatedNodes; k++) {
+            size_t nodeIndex = (frame * 97 + k * 131) % nodeCount;
+            loader.nodes[nodeIndex].LocalTransform = XMMatrixRotationRollPitchYaw(0.0f, 0.01f * frame, 0.0f) *
+                XMMatrixTranslation(0.1f, 0.0f, 0.05f);
+            loader.MarkNodeDirty(nodeIndex);
+        }
+        loader.UpdateWorldTransforms();
+    }
+    auto dirtyEnd = std::chrono::high_resolution_clock::now();
+
+    auto frameMilliseconds = [frameCount](std::chrono::high_resolution_clock::time_point start,
+        std::chrono::high_resolution_clock::time_point end) {
+        return std::chrono::duration<double, std::milli>(end - start).count() / frameCount;
+    };
+
+    OutputDebugStringA(("Node hierarchy benchmark: " + std::to_string(nodeCount) + " nodes x " +
+        std::to_string(frameCount) + " frames\n  recursive (old) " + std::to_string(frameMilliseconds(legacyStart, fullStart)) +
+        " ms/frame, flat full " + std::to_string(frameMilliseconds(fullStart, dirtyStart)) +
+        " ms/frame, dirty " + std::to_string(animatedNodes) + " nodes " + std::to_string(frameMilliseconds(dirtyStart, dirtyEnd)) +
+        " ms/frame\n").c_str());
+}
+
+uint64_t GltfLoader::GetMemoryUsage() const
+{
+    // 메시 데이터 (CPU 사본 + GPU 버퍼), 애니메이션, 인코딩된 이미지 원본, 업로드된 텍스처
+    uint64_t bytes = textureBytes;
+    for (const auto& mesh : meshes) {
+        for (const auto& primitive : mesh.Primitives) {
+            bytes += (primitive.Vertices.size() * sizeof(Vertex) + primitive.Indices.size() * sizeof(uint32_t)) * 2;
+            bytes += primitive.Picking.GetMemoryUsage();
+
+            // 스키닝/모프 출력 (CPU 사본 + 동적 버퍼 두 개)
+            if (primitive.SkinIndex >= 0) {
+                bytes += primitive.Vertices.size() * sizeof(Vertex) * 3;
+            }
+            if (!primitive.Morph.IsEmpty()) {
+                const MorphTargets::Set& morph = primitive.Morph;
+                bytes += primitive.Vertices.size() * sizeof(Vertex) * (primitive.SkinIndex >= 0 ? 1 : 3);
+                bytes += morph.Vertices.size() * sizeof(uint32_t) + (morph.BasePositions.size() + morph.BaseNormals.size() +
+                    morph.PositionDeltas.size() + morph.NormalDeltas.size()) * sizeof(float);
+            }
+        }
+    }
+    for (const auto& animation : animations) {
+        for (const auto& channel : animation.Channels) {
+            bytes += channel.Times.size() * sizeof(float) + channel.Values.size() * sizeof(XMFLOAT4);
+        }
+    }
+    for (const auto& image : textureImages) {
+        bytes += image.Encoded.size();
+    }
+    return bytes;
+}
+
+XMMATRIX GltfLoader::CalculateWorldMatrix(const ModelInfo& instance) const
+{
+    // 월드 행렬 계산 (인스턴스의 전역 변환)
+    XMMATRIX scale = XMMatrixScaling(instance.Scale.x, instance.Scale.y, instance.Scale.z);
     XMMATRIX rotation = XMMatrixRotationRollPitchYaw(
-        XMConvertToRadians(modelInfo.Rotation.x),
-        XMConvertToRadians(modelInfo.Rotation.y),
-        XMConvertToRadians(modelInfo.Rotation.z));
-    XMMATRIX translation = XMMatrixTranslation(modelInfo.Position.x, modelInfo.Position.y, modelInfo.Position.z);
+        XMConvertToRadians(instance.Rotation.x),
+        XMConvertToRadians(instance.Rotation.y),
+        XMConvertToRadians(instance.Rotation.z));
+    XMMATRIX translation = XMMatrixTranslation(instance.Position.x, instance.Position.y, instance.Position.z);
 
     // SRT 순서대로 변환 적용 (크기 -> 회전 -> 이동)
     return scale * rotation * translation;
@@ -1531,11 +2705,17 @@ XMMATRIX GltfLoader::CalculateWorldMatrix()
 
 void GltfLoader::Release()
 {
+    // 단계별 가져오기 중이던 파일 매핑 해제
+    importState.reset();
+
     // 메시 프리미티브 버퍼 해제
     for (auto& mesh : meshes) {
         for (auto& primitive : mesh.Primitives) {
             if (primitive.VertexBuffer) { primitive.VertexBuffer->Release(); primitive.VertexBuffer = nullptr; }
             if (primitive.IndexBuffer) { primitive.IndexBuffer->Release(); primitive.IndexBuffer = nullptr; }
+            for (auto& dynamicBuffer : primitive.DynamicBuffers) {
+                if (dynamicBuffer) { dynamicBuffer->Release(); dynamicBuffer = nullptr; }
+            }
         }
     }
 
@@ -1546,6 +2726,14 @@ void GltfLoader::Release()
         if (material.second.NormalTexture) { material.second.NormalTexture->Release(); material.second.NormalTexture = nullptr; }
         if (material.second.EmissiveTexture) { material.second.EmissiveTexture->Release(); material.second.EmissiveTexture = nullptr; }
         if (material.second.OcclusionTexture) { material.second.OcclusionTexture->Release(); material.second.OcclusionTexture = nullptr; }
+        if (material.second.ConstantBuffer) { material.second.ConstantBuffer->Release(); material.second.ConstantBuffer = nullptr; }
+    }
+    if (defaultMaterial.ConstantBuffer) { defaultMaterial.ConstantBuffer->Release(); defaultMaterial.ConstantBuffer = nullptr; }
+    defaultMaterial.ConstantsDirty = true;
+
+    // 이미지별 리소스 뷰 해제 (재질은 AddRef한 참조를 위에서 해제)
+    for (auto& textureView : textureViews) {
+        if (textureView) { textureView->Release(); textureView = nullptr; }
     }
 
     // 셰이더 및 관련 리소스 해제
@@ -1563,6 +2751,18 @@ void GltfLoader::Release()
     materials.clear();
     animations.clear();
     rootNodes.clear();
+    textureImages.clear();
+    textureViews.clear();
+    restTransforms.clear();
+    skins.clear();
+    skinningDirty = false;
+    nodeOrder.clear();
+    nodeParents.clear();
+    worldTransforms.clear();
+    dirtyNodes.clear();
+    hierarchyDirty = false;
+    restPose = AnimationEngine::Pose();
+    animationState = AnimationEngine::State();
 }
 // GltfLoader.cpp에 추가할 애니메이션 관련 함수들
 
@@ -1590,6 +2790,9 @@ void GltfLoader::SetCurrentAnimation(int index)
     if (index >= 0 && index < animations.size()) {
         currentAnimationIndex = index;
         currentAnimationTime = animations[index].StartTime;
+
+        // 이전 애니메이션이 움직인 노드를 되돌리고 커서 초기화
+        ResetAnimationPose();
     }
 }
 
@@ -1639,116 +2842,92 @@ void GltfLoader::UpdateAnimation(float deltaTime)
     // 애니메이션 시간 업데이트
     currentAnimationTime += deltaTime;
 
-    // 애니메이션 순환
+    // 애니메이션 순환 (길이가 0인 애니메이션은 시작 시간에 고정)
+    float duration = animation.EndTime - animation.StartTime;
     if (currentAnimationTime > animation.EndTime) {
-        currentAnimationTime = fmodf(currentAnimationTime - animation.StartTime, animation.EndTime - animation.StartTime) + animation.StartTime;
+        currentAnimationTime = duration > 0.0f ?
+            fmodf(currentAnimationTime - animation.StartTime, duration) + animation.StartTime : animation.StartTime;
     }
 
-    // 각 채널에 대해 현재 시간에 맞는 애니메이션 적용
-    for (const auto& channel : animation.Channels) {
-        if (channel.NodeIndex < 0 || channel.NodeIndex >= nodes.size() || channel.Times.empty()) {
-            continue;
-        }
-
-        // 시간값에 따른 인덱스 찾기
-        size_t nextKeyframe = 0;
-        while (nextKeyframe < channel.Times.size() && channel.Times[nextKeyframe] <= currentAnimationTime) {
-            nextKeyframe++;
-        }
+    // 채널별 커서로 키프레임을 찾아 현재 포즈(TRS)에 기록
+    AnimationEngine::Evaluate(animation, currentAnimationTime, animationState);
 
-        size_t prevKeyframe = nextKeyframe > 0 ? nextKeyframe - 1 : 0;
-        if (nextKeyframe >= channel.Times.size()) {
-            nextKeyframe = prevKeyframe;
+    // 이번 프레임에 바뀐 노드만 로컬 변환 행렬을 한 번씩 다시 구성
+    for (size_t i = 0; i < animationState.Dirty.size(); i++) {
+        if (animationState.Dirty[i]) {
+            nodes[i].LocalTransform = AnimationEngine::Compose(animationState.Current, i);
+            animationState.Dirty[i] = 0;
+            MarkNodeDirty(i);
         }
+    }
+}
 
-        // 두 키프레임 사이의 보간 계수 계산
-        float t = 0.0f;
-        if (nextKeyframe > prevKeyframe) {
-            t = (currentAnimationTime - channel.Times[prevKeyframe]) / (channel.Times[nextKeyframe] - channel.Times[prevKeyframe]);
-        }
+void GltfLoader::InitializeAnimationPose()
+{
+    // 애니메이션이 없는 노드는 가져온 행렬을 그대로 쓰므로 분해 결과는 애니메이션 채널에서만 사용됨
+    restTransforms.resize(nodes.size());
+    restPose.Resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        XMStoreFloat4x4(&restTransforms[i], nodes[i].LocalTransform);
+        AnimationEngine::Decompose(nodes[i].LocalTransform, restPose, i);
+        restPose.Weights[i] = nodes[i].Weights;
+    }
 
-        // 애니메이션 타입에 따른 적용
-        Node& node = nodes[channel.NodeIndex];
+    ResetAnimationPose();
+}
 
-        switch (channel.Path) {
-        case AnimationChannel::TRANSLATION: {
-            XMVECTOR prevT = XMLoadFloat4(&channel.Values[prevKeyframe]);
-            XMVECTOR nextT = XMLoadFloat4(&channel.Values[nextKeyframe]);
-            XMVECTOR translation = XMVectorLerp(prevT, nextT, t);
+void GltfLoader::ResetAnimationPose()
+{
+    for (size_t i = 0; i < nodes.size() && i < restTransforms.size(); i++) {
+        nodes[i].LocalTransform = XMLoadFloat4x4(&restTransforms[i]);
+        MarkNodeDirty(i);
+    }
 
-            XMFLOAT3 pos;
-            XMStoreFloat3(&pos, translation);
+    const Animation* animation = nullptr;
+    if (currentAnimationIndex >= 0 && currentAnimationIndex < animations.size()) {
+        animation = &animations[currentAnimationIndex];
+    }
+    animationState.Reset(restPose, animation);
+}
 
-            // 노드의 로컬 변환 행렬을 업데이트
-            // (간략화됨 - 실제 구현에서는 기존 스케일과 회전을 유지해야 함)
-            node.LocalTransform = XMMatrixTranslation(pos.x, pos.y, pos.z);
-            break;
-        }
-        case AnimationChannel::ROTATION: {
-            XMVECTOR prevR = XMLoadFloat4(&channel.Values[prevKeyframe]);
-            XMVECTOR nextR = XMLoadFloat4(&channel.Values[nextKeyframe]);
-            XMVECTOR rotation = XMQuaternionSlerp(prevR, nextR, t);
+double GltfLoader::BenchmarkAnimation(size_t instanceCount, size_t frameCount) const
+{
+    if (currentAnimationIndex < 0 || currentAnimationIndex >= animations.size()) {
+        return 0.0;
+    }
 
-            // 노드의 로컬 변환 행렬을 업데이트
-            node.LocalTransform = XMMatrixRotationQuaternion(rotation);
-            break;
-        }
-        case AnimationChannel::SCALE: {
-            XMVECTOR prevS = XMLoadFloat4(&channel.Values[prevKeyframe]);
-            XMVECTOR nextS = XMLoadFloat4(&channel.Values[nextKeyframe]);
-            XMVECTOR scale = XMVectorLerp(prevS, nextS, t);
+    const Animation& animation = animations[currentAnimationIndex];
+    double frameMilliseconds = AnimationEngine::Benchmark(animation, restPose, instanceCount, frameCount);
 
-            XMFLOAT3 s;
-            XMStoreFloat3(&s, scale);
+    OutputDebugStringA(("Animation benchmark: " + modelInfo.Name + " '" + animation.Name + "', " +
+        std::to_string(animation.Channels.size()) + " channels, " + std::to_string(nodes.size()) + " nodes, " +
+        std::to_string(instanceCount) + " instances x " + std::to_string(frameCount) + " frames\n  " +
+        std::to_string(frameMilliseconds) + " ms/frame, " +
+        std::to_string(instanceCount > 0 ? frameMilliseconds * 1000.0 / instanceCount : 0.0) + " us/instance\n").c_str());
 
-            // 노드의 로컬 변환 행렬을 업데이트
-            node.LocalTransform = XMMatrixScaling(s.x, s.y, s.z);
-            break;
-        }
-                                    // 'WEIGHTS' 타입은 모프 타깃 애니메이션에 사용되지만, 여기서는 구현 생략
-        }
-    }
+    return frameMilliseconds;
 }
+
 // GltfLoader.cpp에 추가
 BoundingBox GltfLoader::CalculateBoundingBox() const
 {
-    BoundingBox box = { XMFLOAT3(FLT_MAX, FLT_MAX, FLT_MAX), XMFLOAT3(-FLT_MAX, -FLT_MAX, -FLT_MAX) };
+    // 가져올 때 계산한 프리미티브 박스만 합침 (정점은 다시 훑지 않음)
+    BoundingBox box = {};
     bool hasVertices = false;
-
-    // 모든 메시의 모든 버텍스를 검사하여 바운딩 박스 계산
     for (const auto& mesh : meshes) {
         for (const auto& primitive : mesh.Primitives) {
-            for (const auto& vertex : primitive.Vertices) {
-                // 최소/최대 경계 갱신
-                box.min.x = min(box.min.x, vertex.Position.x);
-                box.min.y = min(box.min.y, vertex.Position.y);
-                box.min.z = min(box.min.z, vertex.Position.z);
-
-                box.max.x = max(box.max.x, vertex.Position.x);
-                box.max.y = max(box.max.y, vertex.Position.y);
-                box.max.z = max(box.max.z, vertex.Position.z);
-
-                hasVertices = true;
+            if (primitive.Vertices.empty()) {
+                continue;
             }
+            box = hasVertices ? BoundingVolumes::Merge(box, primitive.Bounds) : primitive.Bounds;
+            hasVertices = true;
         }
     }
 
     // 버텍스가 없는 경우 기본 박스 반환
     if (!hasVertices) {
-        box.min = XMFLOAT3(-1.0f, -1.0f, -1.0f);
-        box.max = XMFLOAT3(1.0f, 1.0f, 1.0f);
+        box = BoundingVolumes::FromMinMax(XMVectorReplicate(-1.0f), XMVectorReplicate(1.0f));
     }
-
-    // 중심과 반지름 계산
-    box.center.x = (box.min.x + box.max.x) * 0.5f;
-    box.center.y = (box.min.y + box.max.y) * 0.5f;
-    box.center.z = (box.min.z + box.max.z) * 0.5f;
-
-    float dx = box.max.x - box.min.x;
-    float dy = box.max.y - box.min.y;
-    float dz = box.max.z - box.min.z;
-    box.radius = sqrt(dx * dx + dy * dy + dz * dz) * 0.5f;
-
     return box;
 }
 
@@ -8,6 +8,17 @@
 #include "Camera.h"
 #include "Model.h"
 #include "Common.h"
+#include "MeshCache.h"
+#include "SkinningKernel.h"
+#include "MorphTargets.h"
+#include "AnimationEngine.h"
+#include "GltfAccessor.h"
+#include "TextureProcessor.h"
+#include "ImportPipeline.h"
+#include "ImportProgress.h"
+#include "PickingBvh.h"
+#include "BoundingVolumes.h"
+#include "ConstantBuffers.h"
 // 구현 매크로 없이 tinygltf를 포함 
 #include "tiny_gltf.h"
 
@@ -45,12 +56,23 @@ public:
         std::string EmissiveTexturePath;
         std::string OcclusionTexturePath;
 
+        // 텍스처 이미지 인덱스 (-1은 텍스처 없음)
+        int BaseColorImage = -1;
+        int MetallicRoughnessImage = -1;
+        int NormalImage = -1;
+        int EmissiveImage = -1;
+        int OcclusionImage = -1;
+
         // 텍스처 리소스 뷰
         ID3D11ShaderResourceView* BaseColorTexture = nullptr;
         ID3D11ShaderResourceView* MetallicRoughnessTexture = nullptr;
         ID3D11ShaderResourceView* NormalTexture = nullptr;
         ID3D11ShaderResourceView* EmissiveTexture = nullptr;
         ID3D11ShaderResourceView* OcclusionTexture = nullptr;
+
+        // 재질 상수 버퍼 (b3) - 처음 그릴 때 만들고 값이 바뀌어 ConstantsDirty가 켜진 경우만 다시 올림
+        ID3D11Buffer* ConstantBuffer = nullptr;
+        bool ConstantsDirty = true;
     };
 
     // 메시 프리미티브 구조체
@@ -62,6 +84,41 @@ public:
         ID3D11Buffer* VertexBuffer = nullptr;
         ID3D11Buffer* IndexBuffer = nullptr;
         UINT IndexCount = 0;
+
+        // 스키닝 (메시를 쓰는 첫 번째 스킨 노드 기준, -1은 스키닝하지 않음)
+        int SkinIndex = -1;
+        std::vector<Vertex> SkinnedVertices;
+
+        // 모프 타깃 (움직이는 정점만 보관) - 섞은 결과는 MorphedVertices, 스키닝이 있으면 스키닝 입력으로 사용
+        MorphTargets::Set Morph;
+        std::vector<Vertex> MorphedVertices;
+
+        // CPU에서 변형한 정점(스키닝/모프)을 동적 버퍼 두 개에 번갈아 올려서 GPU가 읽는 버퍼를 덮어쓰지 않음
+        ID3D11Buffer* DynamicBuffers[2] = { nullptr, nullptr };
+        UINT DynamicBufferIndex = 0;
+
+        // 피킹용 삼각형 BVH (가져올 때 바인드 포즈로 생성, 스키닝하는 프리미티브는 스키닝할 때마다 현재 포즈로 refit)
+        TriangleBvh Picking;
+
+        // 프리미티브 로컬 공간 바운딩 박스 (바인드 포즈, 정점을 디코딩하거나 캐시에서 읽을 때 한 번 계산)
+        BoundingBox Bounds = {};
+
+        // 스키닝된 정점의 모델 공간 바운딩 박스 (SkinnedVertices와 함께 갱신)
+        BoundingBox SkinnedBounds = {};
+    };
+
+    // 텍스처 이미지 - 인코딩된 원본(PNG/JPEG)을 보관하고 디코딩 단계에서 밉 + BC 압축 데이터로 변환
+    struct TextureImage
+    {
+        std::string Name;
+        std::string MimeType;
+        std::vector<uint8_t> Encoded;
+
+        // 재질에서 쓰는 용도 (디코딩 단계에서 결정)
+        TextureProcessor::Role Role = TextureProcessor::Role::Unused;
+
+        // 처리 결과 (GPU 업로드 후 해제)
+        TextureProcessor::Result Processed;
     };
 
     // 노드 구조체 (계층 구조 지원)
@@ -71,6 +128,17 @@ public:
         XMMATRIX LocalTransform;
         std::vector<int> Children;
         int MeshIndex = -1; // -1은 메시가 없음을 의미
+        int SkinIndex = -1; // -1은 스킨이 없음을 의미
+        std::vector<float> Weights; // 모프 타깃 기본 가중치 (노드에 없으면 메시의 기본 가중치)
+    };
+
+    // 스킨 - 조인트 노드와 역 바인드 행렬, 매 프레임 계산하는 조인트 행렬 팔레트
+    struct Skin
+    {
+        std::string Name;
+        std::vector<int> Joints;
+        std::vector<XMFLOAT4X4> InverseBindMatrices;
+        std::vector<SkinningKernel::JointMatrix> Palette;
     };
 
     // 메시 구조체
@@ -84,25 +152,19 @@ public:
         ID3D11Buffer* IndexBuffer = nullptr;
         UINT IndexCount = 0;
         std::string MaterialName;
-    };
 
-    // 애니메이션 관련 구조체
-    struct AnimationChannel
-    {
-        int NodeIndex;
-        enum TargetPath { TRANSLATION, ROTATION, SCALE, WEIGHTS } Path;
-        std::vector<float> Times;
-        std::vector<XMFLOAT4> Values; // XMFLOAT4는 모든 애니메이션 데이터 타입을 저장할 수 있음
-    };
+        // 모프 타깃 기본 가중치와 가중치를 가져올 노드 (메시를 쓰는 첫 번째 노드, -1은 모프 타깃 없음)
+        std::vector<float> Weights;
+        int MorphNode = -1;
 
-    struct Animation
-    {
-        std::string Name;
-        std::vector<AnimationChannel> Channels;
-        float StartTime = 0.0f;
-        float EndTime = 0.0f;
+        // 메시 로컬 공간 바운딩 박스 (프리미티브 박스를 합친 바인드 포즈 박스)
+        BoundingBox Bounds = {};
     };
 
+    // 애니메이션 관련 구조체 (평가는 AnimationEngine에서 처리)
+    using AnimationChannel = AnimationEngine::Channel;
+    using Animation = AnimationEngine::Clip;
+
     // 모델 정보 구조체
     struct ModelInfo
     {
@@ -112,6 +174,7 @@ public:
         XMFLOAT3 Position = { 0.0f, 0.0f, 0.0f };
         XMFLOAT3 Rotation = { 0.0f, 0.0f, 0.0f };
         XMFLOAT3 Scale = { 1.0f, 1.0f, 1.0f };
+        MaterialOverride Override; // 그릴 때만 적용하는 재질 덮어쓰기
     };
 
 
@@ -120,8 +183,49 @@ public:
     ~GltfLoader();
 
    
-    // GLB 모델 로드 함수
-    bool LoadGlbModel(const std::string& filename, ID3D11Device* device);
+    // GLB 모델 로드 함수 (meshCache가 있으면 처리 결과를 캐시에서 읽거나 저장)
+    // textureCache가 있으면 처리된 텍스처(밉 + BC 압축)를 캐시에서 읽거나 저장
+    // sourceKey는 AssetRegistry가 만든 원본 식별 정보 (읽기 단계에서 내용 해시만 채움, 없으면 새로 계산)
+    bool LoadGlbModel(const std::string& filename, ID3D11Device* device, MeshCache* meshCache = nullptr,
+        MeshCache* textureCache = nullptr, const MeshCache::SourceKey* sourceKey = nullptr);
+
+    // 로드 단계를 나눠서 실행할 때 사용 (여러 모델의 텍스처를 한 번에 디코딩)
+    // 1. GLTF/GLB 파싱과 메시 처리 (CPU만 사용, 디바이스 불필요)
+    bool ImportGlbModel(const std::string& filename, MeshCache* meshCache = nullptr,
+        const MeshCache::SourceKey* sourceKey = nullptr);
+
+    // 2. 모든 모델의 텍스처 이미지를 공유 스레드 풀에서 병렬 처리 (디코딩, 밉 생성, BC 압축)하고 이미지별 시간 기록
+    static void DecodeTextureImages(const std::vector<GltfLoader*>& loaders, MeshCache* textureCache = nullptr);
+
+    // 3. 텍스처, 버퍼, 셰이더 등 GPU 리소스 생성 (디코딩되지 않은 이미지는 여기서 디코딩)
+    bool CreateDeviceResources(ID3D11Device* device);
+
+    // ImportPipeline에서 가져오기를 단계별로 실행할 때 사용 (ImportGlbModel = Read -> Parse -> Process)
+    // 읽기: 메시 캐시 조회, 없으면 GLB 파일 매핑 / 파싱: GLTF JSON 파싱 / 처리: 메시, 재질, 애니메이션 처리와 캐시 저장
+    bool ReadImportStage(const std::string& filename, MeshCache* meshCache = nullptr,
+        const MeshCache::SourceKey* sourceKey = nullptr);
+    bool ParseImportStage();
+    bool ProcessImportStage();
+
+    // GPU 업로드 항목 종류 - 이미지 하나의 텍스처, 프리미티브 하나의 버퍼, 마지막에 재질 연결과 셰이더/상태 생성
+    enum UploadKind : uint32_t
+    {
+        UploadTexture = 0,
+        UploadPrimitive,
+        UploadFinalize
+    };
+
+    // 업로드 항목 목록 작성 (텍스처 디코딩이 끝난 뒤 호출, 디바이스 불필요)
+    void PrepareUploads(std::vector<ImportPipeline::UploadItem>& items);
+
+    // 항목 하나 업로드 - 텍스처나 버퍼 생성 실패는 해당 리소스만 빠지고, 셰이더나 상태 생성에 실패하면 false
+    bool UploadResource(ID3D11Device* device, const ImportPipeline::UploadItem& item);
+
+    // 가져오는 동안 단계별 작업량을 보고하고 취소를 확인할 진행 상태 (없으면 보고하지 않음)
+    void SetImportProgress(std::shared_ptr<ImportProgress> progress) { importProgress = std::move(progress); }
+
+    // 셰이더 바이트코드 컴파일 - 모든 GLB 모델이 같은 셰이더를 쓰므로 프로세스에서 한 번만 컴파일 (작업자 스레드에서 호출 가능)
+    static bool CompileShaders();
 
     // 조명 지원 렌더링 함수 추가
     void Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager);
@@ -130,6 +234,11 @@ public:
     // 모델 렌더링 함수
     void Render(ID3D11DeviceContext* deviceContext, const Camera& camera);
 
+    // 인스턴스 렌더링 함수 - 공유 에셋을 인스턴스의 변환과 표시 여부로 렌더링
+    void Render(ID3D11DeviceContext* deviceContext, const Camera& camera, const ModelInfo& instance);
+    void Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager,
+        const ModelInfo& instance);
+
     // 애니메이션 업데이트 함수
     void UpdateAnimation(float deltaTime);
 
@@ -139,6 +248,27 @@ public:
     // 재질 정보 getter
     const std::map<std::string, PbrMaterial>& GetMaterials() const { return materials; }
 
+    // 로컬 바운딩 박스 getter
+    const BoundingBox& GetBoundingBox() const { return bounds; }
+
+    // 현재 포즈의 모델 공간 바운딩 박스 (UpdateAnimatedBounds로 갱신)
+    const BoundingBox& GetAnimatedBounds() const { return animatedBounds; }
+
+    // 월드 레이와 인스턴스 메시 삼각형의 가장 가까운 교차 (hit.Distance보다 가까우면 hit을 갱신하고 true)
+    // 노드 변환은 현재 포즈를 따르고 스키닝/모프 정점은 바인드 포즈로 검사
+    bool Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, const ModelInfo& instance, RayHit& hit) const;
+
+    // 프레임 갱신 단계 - 에셋끼리 공유하는 상태가 없으므로 서로 다른 에셋은 작업자 스레드에서 동시에 호출 가능
+    // 같은 에셋은 UpdateAnimation -> UpdateWorldTransforms -> UpdateAnimatedBounds 순서로 호출 (렌더링에서도 필요하면 호출)
+    // 표시된 노드와 그 하위 트리의 월드 행렬만 다시 계산
+    void UpdateWorldTransforms();
+
+    // 월드 행렬이 바뀌었으면 메시 노드의 바운딩 박스를 현재 포즈로 다시 합침
+    void UpdateAnimatedBounds();
+
+    // 에셋이 차지하는 메모리 (메시 CPU/GPU 사본, 애니메이션, 텍스처) - 공유 에셋 통계용
+    uint64_t GetMemoryUsage() const;
+
     // 애니메이션 관련 함수들
     int GetCurrentAnimationIndex() const;
     float GetCurrentAnimationTime() const;
@@ -150,6 +280,12 @@ public:
     void SetAnimationSpeed(float speed);
     float GetAnimationSpeed() const;
 
+    // 현재 애니메이션을 instanceCount개 인스턴스로 CPU에서 평가하는 성능 측정 (결과는 디버그 출력)
+    double BenchmarkAnimation(size_t instanceCount, size_t frameCount = 300) const;
+
+    // 합성 노드 계층으로 월드 행렬 갱신 성능 측정 (전체 갱신과 변경된 하위 트리만 갱신하는 경우 비교, 결과는 디버그 출력)
+    static void BenchmarkNodeHierarchy(size_t nodeCount = 5000, size_t frameCount = 300);
+
     // 리소스 해제
     void Release();
 
@@ -157,50 +293,137 @@ private:
     void AutoResizeModel();
     BoundingBox CalculateBoundingBox() const;
 
-    // 노드 렌더링 함수
+    // 재질 참조로 텍스처 이미지 용도 결정 (압축 포맷 선택용)
+    void AssignTextureRoles();
+
+    // 노드 렌더링 함수 (노드의 메시만 그림, 자식은 호출 측이 평탄화된 순서로 처리)
     void RenderNode(ID3D11DeviceContext* deviceContext, const Camera& camera,
-        int nodeIndex, XMMATRIX parentTransform);
+        int nodeIndex, FXMMATRIX instanceTransform, const MaterialOverride& materialOverride);
 
-    // GLB 모델 처리 함수
-    bool ProcessGltfModel(const tinygltf::Model& model, ID3D11Device* device);
+    // GLB 모델 처리 함수 (CPU 작업만 수행, 인코딩된 이미지는 model에서 가져옴)
+    // 버퍼 데이터는 accessors를 통해 읽음 (매핑된 GLB의 BIN 청크 포함)
+    bool ProcessGltfModel(tinygltf::Model& model, const GltfAccessor& accessors);
+
+    // 메시 캐시 직렬화
+    void WriteCache(MeshCache::Writer& writer) const;
+    bool ReadCache(MeshCache::Reader& reader);
 
     // 텍스처 로드 함수
     bool LoadTexture(const std::string& texturePath, ID3D11Device* device, ID3D11ShaderResourceView** textureView);
-    bool LoadTextureFromBuffer(const tinygltf::Image& image, ID3D11Device* device, ID3D11ShaderResourceView** textureView);
+    bool LoadTextureFromBuffer(const TextureImage& image, ID3D11Device* device, ID3D11ShaderResourceView** textureView);
 
     // 버퍼 생성 함수
     bool CreateBuffers(ID3D11Device* device, MeshPrimitive& primitive);
 
-    // 셰이더 생성 함수
+    // 셰이더 생성 함수 (컴파일된 바이트코드로 셰이더, 입력 레이아웃, 상수 버퍼 생성)
     bool CreateShaders(ID3D11Device* device);
 
-    // 노드 변환 행렬 계산
+    // 재질에 텍스처를 연결하고 셰이더와 렌더링 상태 생성 (마지막 업로드 항목)
+    bool FinalizeDeviceResources(ID3D11Device* device);
+
+    // 노드 변환 행렬 계산 (캐시된 모델 공간 월드 행렬)
     XMMATRIX CalculateNodeTransform(int nodeIndex);
 
+    // 루트 노드부터 부모가 자식보다 앞에 오도록 노드 계층을 평탄화하고 비정상적인 크기를 보정 (가져오기가 끝난 뒤 호출)
+    void BuildNodeHierarchy();
+
+    // 로컬 변환이 바뀐 노드 표시 (하위 트리는 갱신할 때 함께 처리)
+    void MarkNodeDirty(size_t nodeIndex);
+
+    // 스킨 노드가 쓰는 메시 프리미티브에 스킨 지정하고 모프 타깃 메시의 가중치 노드 지정 (가져오기가 끝난 뒤 호출)
+    void AssignDeformedPrimitives();
+
+    // 프리미티브별 피킹 BVH 생성 (가져오기가 끝난 뒤 호출)
+    void BuildPickingBvhs();
+
+    // 모프 가중치가 바뀐 메시만 움직이는 정점을 다시 섞음 (스키닝하는 프리미티브는 스키닝 단계에서 업로드)
+    void UpdateMorphTargets(ID3D11DeviceContext* deviceContext);
+
+    // 변형한 정점을 GPU가 읽고 있지 않은 동적 버퍼에 올리고 버퍼 교체
+    void UploadDynamicVertices(ID3D11DeviceContext* deviceContext, MeshPrimitive& primitive, const std::vector<Vertex>& vertices);
+
+    // 조인트가 움직였으면 조인트 행렬을 다시 만들고 공유 스레드 풀에서 CPU 스키닝 후 다음 동적 버퍼에 업로드
+    void UpdateSkinning(ID3D11DeviceContext* deviceContext);
+
+    // 노드의 기본 포즈 기록 (가져오기가 끝난 뒤 호출)
+    void InitializeAnimationPose();
+
+    // 모든 노드를 기본 포즈로 되돌리고 현재 애니메이션의 재생 상태 초기화
+    void ResetAnimationPose();
+
     // 월드 변환 행렬 계산
-    XMMATRIX CalculateWorldMatrix();
+    XMMATRIX CalculateWorldMatrix(const ModelInfo& instance) const;
 
 private:
+    // 단계별 가져오기 중인 상태 (매핑된 파일, 파싱한 GLTF 모델) - 처리 단계가 끝나면 해제
+    struct ImportState;
+    std::unique_ptr<ImportState> importState;
+
+    // 가져오기 진행 상태 - 취소되면 메시/텍스처 단위로 작업을 멈춤
+    std::shared_ptr<ImportProgress> importProgress;
+    bool IsImportCancelled() const { return importProgress && importProgress->IsCancelled(); }
+
     // 모델 데이터
     std::vector<Mesh> meshes;
     std::vector<Node> nodes;
     std::map<std::string, PbrMaterial> materials;
+
+    // 재질이 없는 프리미티브용 기본 재질
+    PbrMaterial defaultMaterial;
     std::vector<Animation> animations;
 
+    // 텍스처 이미지와 이미지별 리소스 뷰 (여러 재질이 같은 이미지를 공유)
+    std::vector<TextureImage> textureImages;
+    std::vector<ID3D11ShaderResourceView*> textureViews;
+
+    // 로컬 바운딩 박스
+    BoundingBox bounds = {};
+    BoundingBox animatedBounds = {};
+    bool boundsDirty = false;
+
+    // 업로드된 텍스처 크기 (밉 포함)
+    uint64_t textureBytes = 0;
+
     // 루트 노드 인덱스
     std::vector<int> rootNodes;
 
+    // 평탄화된 노드 계층 - 부모가 항상 자식보다 앞에 오는 순서와 노드별 부모 인덱스 (-1은 루트)
+    std::vector<int> nodeOrder;
+    std::vector<int> nodeParents;
+
+    // 모델 공간 월드 행렬 캐시와 갱신이 필요한 노드
+    std::vector<XMMATRIX> worldTransforms;
+    std::vector<uint8_t> dirtyNodes;
+    bool hierarchyDirty = false;
+
+    // 스킨과 스키닝 처리량 통계 (스키닝한 정점 수와 커널 시간)
+    std::vector<Skin> skins;
+    bool skinningDirty = false;
+    uint64_t skinnedVertexTotal = 0;
+    double skinningMilliseconds = 0.0;
+    uint32_t skinningPasses = 0;
+
+    // 모프 타깃 블렌딩 작업 버퍼
+    std::vector<float> morphScratch;
+
     // 현재 애니메이션 상태
     int currentAnimationIndex = -1;
     float currentAnimationTime = 0.0f;
     bool animationPlaying = false;  // 애니메이션 재생 상태
     float animationSpeed = 1.0f;    // 애니메이션 재생 속도
 
+    // 노드 기본 포즈 (가져온 로컬 변환 행렬과 이를 분해한 TRS)
+    std::vector<XMFLOAT4X4> restTransforms;
+    AnimationEngine::Pose restPose;
+
+    // 현재 포즈와 채널별 키프레임 커서
+    AnimationEngine::State animationState;
+
     // 셰이더와 관련 리소스
     ID3D11VertexShader* vertexShader = nullptr;
     ID3D11PixelShader* pixelShader = nullptr;
     ID3D11InputLayout* inputLayout = nullptr;
-    ID3D11Buffer* constantBuffer = nullptr;
+    ID3D11Buffer* constantBuffer = nullptr; // 오브젝트별 상수 (b0)
     ID3D11SamplerState* samplerState = nullptr;
     ID3D11RasterizerState* rasterizerState = nullptr;
     ID3D11BlendState *blendState = nullptr;
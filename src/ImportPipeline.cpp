@@ -0,0 +1,293 @@
+#include "ImportPipeline.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    double ElapsedMilliseconds(std::chrono::high_resolution_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+}
+
+const char* ImportPipeline::GetStageName(Stage stage)
+{
+    switch (stage)
+    {
+    case Stage::Queued: return "대기";
+    case Stage::Read: return "읽기";
+    case Stage::Parse: return "파싱";
+    case Stage::Process: return "메시 처리";
+    case Stage::DecodeTextures: return "텍스처 디코딩";
+    case Stage::Upload: return "GPU 업로드";
+    case Stage::Done: return "완료";
+    case Stage::Failed: return "실패";
+    case Stage::Cancelled: return "취소";
+    default: return "";
+    }
+}
+
+bool ImportPipeline::RecordingUploadSink::Upload(Job& job, const UploadItem& item)
+{
+    items.push_back(item);
+    if (itemMilliseconds > 0.0)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        while (ElapsedMilliseconds(start) < itemMilliseconds)
+        {
+        }
+    }
+    return true;
+}
+
+size_t ImportPipeline::RecordingUploadSink::GetItemCount(uint32_t kind) const
+{
+    size_t count = 0;
+    for (const UploadItem& item : items)
+    {
+        count += item.Kind == kind ? 1 : 0;
+    }
+    return count;
+}
+
+uint64_t ImportPipeline::RecordingUploadSink::GetBytes() const
+{
+    uint64_t bytes = 0;
+    for (const UploadItem& item : items)
+    {
+        bytes += item.Bytes;
+    }
+    return bytes;
+}
+
+bool ImportPipeline::Entry::IsFinished() const
+{
+    Stage current = stage;
+    return current == Stage::Done || current == Stage::Failed || current == Stage::Cancelled;
+}
+
+double ImportPipeline::Entry::GetStageMilliseconds(Stage stage) const
+{
+    size_t index = static_cast<size_t>(stage);
+    return index < static_cast<size_t>(Stage::Count) ? stageMilliseconds[index].load() : 0.0;
+}
+
+void ImportPipeline::Entry::Cancel()
+{
+    cancel.Cancel();
+    job->Cancel();
+}
+
+ImportPipeline::ImportPipeline(ThreadPool& pool)
+    : pool(pool)
+{
+}
+
+ImportPipeline::~ImportPipeline()
+{
+    Shutdown();
+}
+
+std::shared_ptr<ImportPipeline::Entry> ImportPipeline::Submit(std::shared_ptr<Job> job, ThreadPool::Priority priority)
+{
+    auto entry = std::make_shared<Entry>();
+    entry->job = std::move(job);
+    entry->priority = priority;
+    entry->cancel = ThreadPool::CancellationToken::Create();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        active.push_back(entry);
+        cpuInFlight++;
+    }
+
+    SubmitStage(entry, Stage::Read);
+    return entry;
+}
+
+void ImportPipeline::SubmitStage(const std::shared_ptr<Entry>& entry, Stage stage)
+{
+    // 취소 토큰은 풀에 넘기지 않음 - 버려진 작업은 업로드 대기열에 도착하지 않으므로 단계 안에서 직접 확인
+    pool.Submit([this, entry, stage]() { RunStage(entry, stage); }, entry->priority);
+}
+
+void ImportPipeline::RunStage(const std::shared_ptr<Entry>& entry, Stage stage)
+{
+    if (entry->cancel.IsCancelled())
+    {
+        FinishCpuStages(entry, Stage::Cancelled);
+        return;
+    }
+
+    entry->stage = stage;
+    auto stageStart = std::chrono::high_resolution_clock::now();
+    bool succeeded = false;
+    try
+    {
+        succeeded = entry->job->RunStage(stage);
+    }
+    catch (...)
+    {
+        succeeded = false;
+    }
+    entry->stageMilliseconds[static_cast<size_t>(stage)] = ElapsedMilliseconds(stageStart);
+
+    if (!succeeded)
+    {
+        // 취소 요청으로 중간에 멈춘 단계는 실패가 아닌 취소로 처리
+        FinishCpuStages(entry, entry->cancel.IsCancelled() ? Stage::Cancelled : Stage::Failed);
+        return;
+    }
+
+    if (stage != Stage::DecodeTextures)
+    {
+        // 단계마다 따로 제출해서 여러 모델의 단계가 작업자 사이에서 섞여 실행되도록 함
+        SubmitStage(entry, static_cast<Stage>(static_cast<uint32_t>(stage) + 1));
+        return;
+    }
+
+    if (entry->cancel.IsCancelled())
+    {
+        FinishCpuStages(entry, Stage::Cancelled);
+        return;
+    }
+
+    entry->job->CollectUploads(entry->uploads);
+    entry->uploadCount = entry->uploads.size();
+    FinishCpuStages(entry, Stage::Upload);
+}
+
+void ImportPipeline::FinishCpuStages(const std::shared_ptr<Entry>& entry, Stage stage)
+{
+    entry->stage = stage;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    uploadQueue.push_back(entry);
+    cpuInFlight--;
+    idleCondition.notify_all();
+}
+
+size_t ImportPipeline::PumpUploads(UploadSink& sink, double budgetMilliseconds, std::vector<std::shared_ptr<Entry>>& finished)
+{
+    auto pumpStart = std::chrono::high_resolution_clock::now();
+    size_t uploaded = 0;
+    uint64_t bytes = 0;
+
+    auto finish = [this, &finished](const std::shared_ptr<Entry>& entry, Stage stage)
+    {
+        entry->stage = stage;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            uploadQueue.pop_front();
+            active.erase(std::remove(active.begin(), active.end(), entry), active.end());
+        }
+        finished.push_back(entry);
+    };
+
+    // 대기열 앞의 작업부터 끝까지 업로드 (작업자는 뒤에 추가만 하므로 앞쪽 작업은 잠금 밖에서 사용해도 됨)
+    for (;;)
+    {
+        std::shared_ptr<Entry> entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (uploadQueue.empty())
+            {
+                break;
+            }
+            entry = uploadQueue.front();
+        }
+
+        Stage stage = entry->stage;
+        if (stage != Stage::Upload)
+        {
+            finish(entry, stage);
+            continue;
+        }
+
+        if (entry->cancel.IsCancelled())
+        {
+            finish(entry, Stage::Cancelled);
+            continue;
+        }
+
+        size_t next = entry->uploadedCount;
+        if (next >= entry->uploads.size())
+        {
+            finish(entry, Stage::Done);
+            continue;
+        }
+
+        if (uploaded > 0 && ElapsedMilliseconds(pumpStart) >= budgetMilliseconds)
+        {
+            break;
+        }
+
+        const UploadItem& item = entry->uploads[next];
+        auto itemStart = std::chrono::high_resolution_clock::now();
+        bool succeeded = false;
+        try
+        {
+            succeeded = sink.Upload(*entry->job, item);
+        }
+        catch (...)
+        {
+            succeeded = false;
+        }
+
+        size_t uploadIndex = static_cast<size_t>(Stage::Upload);
+        entry->stageMilliseconds[uploadIndex] = entry->stageMilliseconds[uploadIndex] + ElapsedMilliseconds(itemStart);
+        entry->uploadedCount = next + 1;
+        uploaded++;
+        bytes += item.Bytes;
+
+        if (!succeeded)
+        {
+            finish(entry, Stage::Failed);
+        }
+    }
+
+    double pumpMilliseconds = ElapsedMilliseconds(pumpStart);
+    std::lock_guard<std::mutex> lock(mutex);
+    uploadedItems += uploaded;
+    uploadedBytes += bytes;
+    lastPumpItems = static_cast<uint32_t>(uploaded);
+    lastPumpMilliseconds = pumpMilliseconds;
+    if (uploaded > 0)
+    {
+        maxPumpMilliseconds = (std::max)(maxPumpMilliseconds, pumpMilliseconds);
+    }
+    return uploaded;
+}
+
+void ImportPipeline::Shutdown()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto& entry : active)
+    {
+        entry->Cancel();
+    }
+
+    // 취소된 작업은 다음 단계에서 바로 업로드 대기열로 넘어오므로 실행 중인 단계만 기다리면 됨
+    idleCondition.wait(lock, [this]() { return cpuInFlight == 0; });
+
+    for (auto& entry : uploadQueue)
+    {
+        entry->stage = Stage::Cancelled;
+    }
+    uploadQueue.clear();
+    active.clear();
+}
+
+ImportPipeline::Stats ImportPipeline::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats stats;
+    stats.Active = active.size();
+    stats.WaitingUploads = uploadQueue.size();
+    stats.UploadedItems = uploadedItems;
+    stats.UploadedBytes = uploadedBytes;
+    stats.LastPumpItems = lastPumpItems;
+    stats.LastPumpMilliseconds = lastPumpMilliseconds;
+    stats.MaxPumpMilliseconds = maxPumpMilliseconds;
+    return stats;
+}
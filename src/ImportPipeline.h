@@ -0,0 +1,192 @@
+#pragma once
+#include "ThreadPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct ID3D11Device;
+
+// 단계별 비동기 모델 가져오기 파이프라인
+// 읽기 -> 파싱 -> 처리 -> 텍스처 디코딩은 단계마다 공유 스레드 풀의 작업 하나로 실행하고,
+// CPU 단계가 끝난 모델의 GPU 업로드는 메인 스레드가 매 프레임 정해진 시간 안에서 항목 단위로 나눠 처리한다
+// 디바이스는 업로드 싱크를 통해서만 사용하므로 기록만 하는 싱크로 디바이스 없이 단계 로직을 확인할 수 있다
+class ImportPipeline
+{
+public:
+    // 가져오기 단계 (Read ~ DecodeTextures는 작업자 스레드, Upload는 메인 스레드)
+    enum class Stage : uint32_t
+    {
+        Queued = 0,
+        Read,
+        Parse,
+        Process,
+        DecodeTextures,
+        Upload,
+        Done,
+        Failed,
+        Cancelled,
+        Count
+    };
+
+    static const char* GetStageName(Stage stage);
+
+    // GPU 업로드 항목 하나 (Kind와 인덱스의 의미는 작업이 정함 - 텍스처 하나, 프리미티브 버퍼 하나 등)
+    struct UploadItem
+    {
+        uint32_t Kind = 0;
+        uint32_t Index = 0;
+        uint32_t SubIndex = 0;
+        uint64_t Bytes = 0;
+    };
+
+    // 가져오기 작업 - CPU 단계와 CollectUploads는 작업자 스레드에서, Upload는 메인 스레드에서 호출
+    class Job
+    {
+    public:
+        virtual ~Job() = default;
+
+        // Read, Parse, Process, DecodeTextures 단계 실행 (false면 가져오기 실패)
+        virtual bool RunStage(Stage stage) = 0;
+
+        // CPU 단계가 모두 끝난 뒤 업로드할 항목 목록 작성
+        virtual void CollectUploads(std::vector<UploadItem>& items) = 0;
+
+        // 항목 하나를 디바이스에 업로드 (false면 가져오기 실패)
+        virtual bool Upload(ID3D11Device* device, const UploadItem& item) = 0;
+
+        // 실행 중인 단계를 중간에 멈추도록 알림 (아무 스레드에서나 호출, 멈춘 단계는 false 반환)
+        virtual void Cancel() {}
+    };
+
+    // 업로드 대상 - DeviceUploadSink는 디바이스로 업로드하고, 테스트에서는 항목을 기록만 하는 싱크로 바꿔 끼움
+    class UploadSink
+    {
+    public:
+        virtual ~UploadSink() = default;
+        virtual bool Upload(Job& job, const UploadItem& item) = 0;
+    };
+
+    class DeviceUploadSink : public UploadSink
+    {
+    public:
+        explicit DeviceUploadSink(ID3D11Device* device) : device(device) {}
+
+        bool Upload(Job& job, const UploadItem& item) override { return job.Upload(device, item); }
+
+    private:
+        ID3D11Device* device = nullptr;
+    };
+
+    // 디바이스 없이 업로드 항목을 받은 순서대로 기록만 하는 싱크 (작업의 Upload는 호출하지 않음)
+    // itemMilliseconds만큼 바쁜 대기로 항목 하나의 업로드 비용을 흉내 내서 프레임 예산 동작을 확인할 수 있다
+    class RecordingUploadSink : public UploadSink
+    {
+    public:
+        explicit RecordingUploadSink(double itemMilliseconds = 0.0) : itemMilliseconds(itemMilliseconds) {}
+
+        bool Upload(Job& job, const UploadItem& item) override;
+
+        // 받은 항목 (순서 그대로)
+        const std::vector<UploadItem>& GetItems() const { return items; }
+        size_t GetItemCount(uint32_t kind) const;
+        uint64_t GetBytes() const;
+
+        void Clear() { items.clear(); }
+
+    private:
+        double itemMilliseconds = 0.0;
+        std::vector<UploadItem> items;
+    };
+
+    // 파이프라인에 들어간 작업 하나 - 단계와 단계별 시간은 다른 스레드에서 읽어도 됨
+    class Entry
+    {
+    public:
+        Stage GetStage() const { return stage; }
+        bool IsFinished() const;
+
+        // 단계에서 보낸 시간 (ms, Upload는 여러 프레임에 걸친 합)
+        double GetStageMilliseconds(Stage stage) const;
+
+        // 업로드한 항목 수 / 전체 항목 수 (Upload 단계 전에는 0)
+        size_t GetUploadedCount() const { return uploadedCount; }
+        size_t GetUploadCount() const { return uploadCount; }
+
+        // 다음 단계부터 실행하지 않고 실행 중인 단계에도 알림 (작업이 확인 지점에서 멈춤)
+        void Cancel();
+
+        Job& GetJob() { return *job; }
+
+    private:
+        friend class ImportPipeline;
+
+        std::shared_ptr<Job> job;
+        ThreadPool::Priority priority = ThreadPool::Priority::Normal;
+        ThreadPool::CancellationToken cancel;
+        std::atomic<Stage> stage{ Stage::Queued };
+        std::atomic<double> stageMilliseconds[static_cast<size_t>(Stage::Count)] = {};
+
+        // 업로드 목록 (작업자가 CPU 단계 끝에 채우고 그 뒤로는 메인 스레드만 사용)
+        std::vector<UploadItem> uploads;
+        std::atomic<size_t> uploadedCount{ 0 };
+        std::atomic<size_t> uploadCount{ 0 };
+    };
+
+    // 진단 정보
+    struct Stats
+    {
+        size_t Active = 0;               // 끝나지 않은 작업 수
+        size_t WaitingUploads = 0;       // 업로드 대기 중인 작업 수
+        uint64_t UploadedItems = 0;      // 업로드한 항목 수 (누적)
+        uint64_t UploadedBytes = 0;      // 업로드한 크기 (누적)
+        uint32_t LastPumpItems = 0;      // 마지막 PumpUploads에서 업로드한 항목 수
+        double LastPumpMilliseconds = 0.0;
+        double MaxPumpMilliseconds = 0.0;
+    };
+
+    explicit ImportPipeline(ThreadPool& pool = ThreadPool::GetShared());
+    ~ImportPipeline();
+
+    ImportPipeline(const ImportPipeline&) = delete;
+    ImportPipeline& operator=(const ImportPipeline&) = delete;
+
+    // 작업 추가 - 첫 단계를 바로 스레드 풀에 제출
+    std::shared_ptr<Entry> Submit(std::shared_ptr<Job> job, ThreadPool::Priority priority = ThreadPool::Priority::Normal);
+
+    // 메인 스레드에서 매 프레임 호출 - 업로드 대기 작업의 항목을 budgetMilliseconds 안에서 차례로 업로드
+    // 예산이 아주 작아도 진행되도록 호출마다 항목 하나는 업로드하고, 끝난 작업(완료/실패/취소)은 finished에 추가
+    // 반환값은 이번 호출에서 업로드한 항목 수
+    size_t PumpUploads(UploadSink& sink, double budgetMilliseconds, std::vector<std::shared_ptr<Entry>>& finished);
+
+    // 모든 작업을 취소하고 작업자 스레드에서 실행 중인 단계가 끝날 때까지 대기 (업로드 대기 작업은 버림)
+    void Shutdown();
+
+    Stats GetStats() const;
+
+private:
+    // 작업의 현재 단계 하나를 실행하고 다음 단계를 제출하거나 업로드 대기열로 넘김
+    void RunStage(const std::shared_ptr<Entry>& entry, Stage stage);
+    void SubmitStage(const std::shared_ptr<Entry>& entry, Stage stage);
+
+    // CPU 단계를 끝낸 작업을 업로드 대기열로 넘김 (실패/취소한 작업도 PumpUploads가 돌려주도록 대기열로)
+    void FinishCpuStages(const std::shared_ptr<Entry>& entry, Stage stage);
+
+    ThreadPool& pool;
+
+    mutable std::mutex mutex;
+    std::condition_variable idleCondition;
+    size_t cpuInFlight = 0;                           // CPU 단계를 실행 중이거나 기다리는 작업 수
+    std::vector<std::shared_ptr<Entry>> active;       // 끝나지 않은 작업 (Shutdown에서 취소)
+    std::deque<std::shared_ptr<Entry>> uploadQueue;   // CPU 단계가 끝난 작업
+
+    // 업로드 통계 (메인 스레드가 갱신)
+    uint64_t uploadedItems = 0;
+    uint64_t uploadedBytes = 0;
+    uint32_t lastPumpItems = 0;
+    double lastPumpMilliseconds = 0.0;
+    double maxPumpMilliseconds = 0.0;
+};
@@ -0,0 +1,137 @@
+#include "ImportProgress.h"
+#include <algorithm>
+
+namespace
+{
+    // 전체 진행률에서 단계별 비중 (텍스처 디코딩과 메시 처리가 대부분의 시간을 차지)
+    const float phaseWeights[] = { 0.1f, 0.1f, 0.25f, 0.35f, 0.2f };
+}
+
+ImportProgress::ImportProgress(const std::string& filename)
+    : filename(filename)
+{
+}
+
+const char* ImportProgress::GetPhaseName(Phase phase)
+{
+    switch (phase)
+    {
+    case Phase::Read: return "읽기";
+    case Phase::Parse: return "파싱";
+    case Phase::Process: return "메시 처리";
+    case Phase::DecodeTextures: return "텍스처 디코딩";
+    case Phase::Upload: return "GPU 업로드";
+    default: return "";
+    }
+}
+
+void ImportProgress::BeginPhase(Phase newPhase, uint64_t total)
+{
+    Counter& counter = counters[static_cast<size_t>(newPhase)];
+    counter.Total = total;
+    counter.Done = 0;
+
+    // 여러 모델을 한 번에 디코딩할 때처럼 늦게 호출되어도 단계가 뒤로 가지 않도록 함
+    uint32_t value = static_cast<uint32_t>(newPhase);
+    uint32_t current = phase;
+    while (current < value && !phase.compare_exchange_weak(current, value))
+    {
+    }
+}
+
+void ImportProgress::AddTotal(Phase target, uint64_t amount)
+{
+    counters[static_cast<size_t>(target)].Total += amount;
+}
+
+void ImportProgress::Advance(Phase target, uint64_t amount)
+{
+    counters[static_cast<size_t>(target)].Done += amount;
+}
+
+uint64_t ImportProgress::GetDone(Phase target) const
+{
+    return counters[static_cast<size_t>(target)].Done;
+}
+
+uint64_t ImportProgress::GetTotal(Phase target) const
+{
+    return counters[static_cast<size_t>(target)].Total;
+}
+
+float ImportProgress::GetFraction() const
+{
+    if (GetState() == State::Complete)
+    {
+        return 1.0f;
+    }
+
+    // 현재 단계 전은 모두 끝난 것으로, 현재 단계는 작업량 비율로 계산
+    size_t current = phase;
+    float fraction = 0.0f;
+    for (size_t i = 0; i < current && i < static_cast<size_t>(Phase::Count); i++)
+    {
+        fraction += phaseWeights[i];
+    }
+
+    if (current < static_cast<size_t>(Phase::Count))
+    {
+        uint64_t total = counters[current].Total;
+        uint64_t done = counters[current].Done;
+        if (total > 0)
+        {
+            fraction += phaseWeights[current] * (std::min)(1.0f, static_cast<float>(done) / static_cast<float>(total));
+        }
+    }
+
+    return (std::min)(fraction, 1.0f);
+}
+
+void ImportProgress::Complete()
+{
+    Finish(State::Complete);
+}
+
+void ImportProgress::Fail(const std::string& message)
+{
+    std::lock_guard<std::mutex> lock(messageMutex);
+    if (Finish(State::Failed))
+    {
+        errorMessage = message;
+    }
+}
+
+void ImportProgress::Cancel()
+{
+    Finish(State::Cancelled);
+}
+
+bool ImportProgress::Finish(State finalState)
+{
+    State expected = State::Loading;
+    if (!state.compare_exchange_strong(expected, finalState))
+    {
+        return false;
+    }
+
+    finishedTicks = std::chrono::steady_clock::now().time_since_epoch().count();
+    return true;
+}
+
+std::string ImportProgress::GetErrorMessage() const
+{
+    std::lock_guard<std::mutex> lock(messageMutex);
+    return errorMessage;
+}
+
+double ImportProgress::GetMillisecondsSinceFinished() const
+{
+    int64_t ticks = finishedTicks;
+    if (!IsFinished() || ticks == 0)
+    {
+        return 0.0;
+    }
+
+    std::chrono::steady_clock::time_point finished{ std::chrono::steady_clock::duration(ticks) };
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - finished).count();
+}
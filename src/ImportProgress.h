@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// 모델 가져오기 진행 상태
+// 작업자 스레드가 단계별 작업량(읽은 바이트, 처리한 프리미티브, 디코딩한 텍스처, 업로드한 항목)을 갱신하고 UI 스레드가 읽는다
+// 카운터와 상태는 원자적으로 갱신하고 오류 메시지만 잠금으로 보호한다
+// Cancel하면 가져오기 코드가 다음 확인 지점(메시, 텍스처, 단계마다)에서 작업을 멈추고 만든 데이터를 해제한다
+class ImportProgress
+{
+public:
+    // 진행 단계 (앞 단계는 끝난 것으로 보고 전체 진행률을 계산)
+    enum class Phase : uint32_t
+    {
+        Read = 0,       // 읽은 바이트
+        Parse,
+        Process,        // 처리한 프리미티브 (OBJ는 재질 그룹)
+        DecodeTextures, // 디코딩한 텍스처
+        Upload,         // 업로드한 GPU 리소스
+        Count
+    };
+
+    enum class State : uint32_t
+    {
+        Loading = 0,
+        Complete,
+        Failed,
+        Cancelled
+    };
+
+    explicit ImportProgress(const std::string& filename);
+
+    static const char* GetPhaseName(Phase phase);
+
+    const std::string& GetFilename() const { return filename; }
+
+    // 단계 시작 - 현재 단계를 바꾸고 전체 작업량 설정 (다른 스레드의 Advance와 동시에 호출 가능)
+    void BeginPhase(Phase phase, uint64_t total = 0);
+
+    // 진행 중에 알게 된 작업량 추가
+    void AddTotal(Phase phase, uint64_t amount);
+
+    void Advance(Phase phase, uint64_t amount = 1);
+
+    Phase GetPhase() const { return static_cast<Phase>(phase.load()); }
+    uint64_t GetDone(Phase phase) const;
+    uint64_t GetTotal(Phase phase) const;
+
+    // 단계별 가중치로 합친 전체 진행률 (0 ~ 1)
+    float GetFraction() const;
+
+    // 가져오기 종료 - 처음 호출한 것만 적용하고 끝난 시각을 기록
+    void Complete();
+    void Fail(const std::string& message);
+    void Cancel();
+
+    State GetState() const { return state; }
+    bool IsFinished() const { return GetState() != State::Loading; }
+    bool IsCancelled() const { return GetState() == State::Cancelled; }
+
+    std::string GetErrorMessage() const;
+
+    // 끝난 뒤 지난 시간 (ms, 끝나지 않았으면 0)
+    double GetMillisecondsSinceFinished() const;
+
+private:
+    bool Finish(State finalState);
+
+    struct Counter
+    {
+        std::atomic<uint64_t> Done{ 0 };
+        std::atomic<uint64_t> Total{ 0 };
+    };
+
+    const std::string filename;
+    std::atomic<State> state{ State::Loading };
+    std::atomic<uint32_t> phase{ static_cast<uint32_t>(Phase::Read) };
+    Counter counters[static_cast<size_t>(Phase::Count)];
+
+    // 끝난 시각 (steady_clock 틱)
+    std::atomic<int64_t> finishedTicks{ 0 };
+
+    mutable std::mutex messageMutex;
+    std::string errorMessage;
+};
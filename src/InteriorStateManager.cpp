@@ -1,9 +1,14 @@
 #include "InteriorStateManager.h"
+#include "InteriorStateReader.h"
+#include "LayoutFile.h"
 #include "tiny_gltf.h" // JSON  ̹ Ե ̺귯 
+#include <algorithm>
+#include <cfloat>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <map>
 #include <sstream>
 
 #define _CRT_SECURE_NO_WARNINGS
@@ -11,6 +16,90 @@
 // tiny_gltf ϴ JSON 
 using json = nlohmann::json;
 
+namespace
+{
+    //   ġ  -  δ   ϰ ġ  ȣ ȯ 
+    struct PlacementList
+    {
+        std::vector<std::string> paths;
+        std::vector<ModelType> types;
+        std::map<std::string, uint32_t> pathIndices;
+        std::vector<uint32_t> placementPaths;
+        std::vector<ModelManager::InstancePlacement> placements;
+
+        void Add(const InteriorDesign::SavedModelInfo &model)
+        {
+            if (model.type != "OBJ" && model.type != "GLB")
+            {
+                return;
+            }
+
+            auto found = pathIndices.find(model.filePath);
+            if (found == pathIndices.end())
+            {
+                found = pathIndices.emplace(model.filePath, static_cast<uint32_t>(paths.size())).first;
+                paths.push_back(model.filePath);
+                types.push_back(model.type == "GLB" ? MODEL_GLB : MODEL_OBJ);
+            }
+
+            ModelManager::InstancePlacement placement;
+            placement.Position = model.position;
+            placement.Rotation = model.rotation;
+            placement.Scale = model.scale;
+            placement.Visible = model.visible;
+            placementPaths.push_back(found->second);
+            placements.push_back(placement);
+        }
+    };
+
+    //    ġ  ϸ   񵿱 εϰ, ε尡  ġ νϽ 
+    // ī޶   ġ ִ Ϻ  ( Ǯ   ε带 )
+    // ȯ   
+    size_t QueueModelGroups(const PlacementList &list, ModelManager *modelManager, const XMFLOAT3 &cameraPosition)
+    {
+        struct ModelGroup
+        {
+            uint32_t path = 0;
+            std::vector<ModelManager::InstancePlacement> placements;
+            float nearestDistanceSquared = FLT_MAX;
+        };
+
+        std::vector<ModelGroup> groups(list.paths.size());
+        for (size_t i = 0; i < groups.size(); i++)
+        {
+            groups[i].path = static_cast<uint32_t>(i);
+        }
+
+        for (size_t i = 0; i < list.placements.size(); i++)
+        {
+            const ModelManager::InstancePlacement &placement = list.placements[i];
+            ModelGroup &group = groups[list.placementPaths[i]];
+            group.placements.push_back(placement);
+
+            float dx = placement.Position.x - cameraPosition.x;
+            float dy = placement.Position.y - cameraPosition.y;
+            float dz = placement.Position.z - cameraPosition.z;
+            group.nearestDistanceSquared = (std::min)(group.nearestDistanceSquared, dx * dx + dy * dy + dz * dz);
+        }
+
+        std::stable_sort(groups.begin(), groups.end(),
+                         [](const ModelGroup &a, const ModelGroup &b) { return a.nearestDistanceSquared < b.nearestDistanceSquared; });
+
+        for (const auto &group : groups)
+        {
+            if (list.types[group.path] == MODEL_OBJ)
+            {
+                modelManager->AddObjModelAsync(list.paths[group.path], group.placements);
+            }
+            else
+            {
+                modelManager->AddGlbModelAsync(list.paths[group.path], group.placements);
+            }
+        }
+        return groups.size();
+    }
+}
+
 InteriorStateManager::InteriorStateManager()
 {
 }
@@ -38,19 +127,12 @@ bool InteriorStateManager::SaveStateToFile(const std::string &filename,
         state.description = description;
         state.createdAt = GetCurrentTimeString();
 
-        // JSON ȯ
-        std::string jsonString = StateToJson(state);
-
-        // Ͽ 
-        std::ofstream file(filename);
-        if (!file.is_open())
+        // Ȯڿ ´  
+        if (!WriteStateFile(filename, state))
         {
             return false;
         }
 
-        file << jsonString;
-        file.close();
-
         // ֱ  Ͽ ߰
         AddRecentFile(filename);
 
@@ -83,22 +165,18 @@ bool InteriorStateManager::LoadStateFromFile(const std::string &filename,
             return false;
         }
 
-        //  б
-        std::ifstream file(filename);
-        if (!file.is_open())
+        // JSON д ߿  ε带 ϰ, ̳ʸ ġ  ؼ   
+        bool success = false;
+        if (LayoutFile::IsLayoutFile(filename))
         {
-            return false;
+            InteriorDesign::InteriorState state;
+            success = ReadStateFile(filename, state) &&
+                      RestoreState(state, modelManager, roomModel, camera, lightManager, device);
+        }
+        else
+        {
+            success = StreamStateFromFile(filename, modelManager, roomModel, camera, lightManager);
         }
-
-        std::string jsonString((std::istreambuf_iterator<char>(file)),
-                               std::istreambuf_iterator<char>());
-        file.close();
-
-        // JSON  
-        auto state = JsonToState(jsonString);
-
-        //  
-        bool success = RestoreState(state, modelManager, roomModel, camera, lightManager, device);
 
         if (success)
         {
@@ -194,83 +272,334 @@ bool InteriorStateManager::RestoreState(const InteriorDesign::InteriorState &sta
 {
     try
     {
-        //   
-        roomModel->SetRoomWidth(state.room.width);
-        roomModel->SetRoomHeight(state.room.height);
-        roomModel->SetRoomDepth(state.room.depth);
-        roomModel->SetFloorColor(state.room.floorColor);
-        roomModel->SetCeilingColor(state.room.ceilingColor);
-        roomModel->SetWallColor(state.room.wallColor);
-        roomModel->SetWindowColor(state.room.windowColor);
-        roomModel->SetHasWindow(state.room.hasWindow);
-
-        // ī޶  
-        camera->SetPosition(state.camera.position.x, state.camera.position.y, state.camera.position.z);
-        camera->SetRotation(state.camera.rotation.x, state.camera.rotation.y, state.camera.rotation.z);
-        camera->SetFieldOfView(state.camera.fieldOfView);
-        camera->SetNearPlane(state.camera.nearPlane);
-        camera->SetFarPlane(state.camera.farPlane);
-        camera->SetCameraMode(static_cast<CameraMode>(state.camera.mode));
+        // /ī޶   (ī޶ ġ  ε  )
+        RestoreRoomAndCamera(state, roomModel, camera);
 
         //  𵨵 
         modelManager->ClearModels();
 
         // 𵨵 
-        // for (const auto &modelInfo : state.models)
-        for (size_t i = 0; i < state.models.size(); ++i)
+        // ε ۾  Ӻ ε ǹǷ  ߿ UI  
+        PlacementList placements;
+        for (const auto &modelInfo : state.models)
         {
-            //  ε  ġ/ȸ/ 
-            //  κ ModelManager   ޶ϴ
-            if (state.models[i].type == "OBJ")
-            {
-                modelManager->AddObjModel(state.models[i].filePath, device);
-            }
-            else if (state.models[i].type == "GLB")
-            {
-                modelManager->AddGlbModel(state.models[i].filePath, device);
-            }
+            placements.Add(modelInfo);
+        }
+        size_t groupCount = QueueModelGroups(placements, modelManager, camera->GetPosition());
+
+        OutputDebugStringA(("Layout restore: " + std::to_string(state.models.size()) + " models, " +
+                            std::to_string(groupCount) + " unique assets queued\n")
+                               .c_str());
+
+        //  
+        RestoreLights(state, lightManager);
+
+        return true;
+    }
+    catch (const std::exception &e)
+    {
+        OutputDebugStringA(("  : " + std::string(e.what()) + "\n").c_str());
+        return false;
+    }
+}
 
-            // ε  Ӽ Ͽ ׸  
-            //  κе ModelManager API   ʿ
-            modelManager->SetModels(static_cast<int>(i),
-                                    state.models[i].position,
-                                    state.models[i].rotation,
-                                    state.models[i].scale,
-                                    state.models[i].visible);
+bool InteriorStateManager::StreamStateFromFile(const std::string &filename,
+                                               ModelManager *modelManager,
+                                               std::shared_ptr<RoomModel> roomModel,
+                                               Camera *camera,
+                                               LightManager *lightManager)
+{
+    //  ׸ д  񵿱 ε带  (   ġ   ε忡 پ   ε)
+    // д   ε ϳ û  ΰ,   б⿡  ڿ  (ϸ  )
+    //     ʰ ֱ ׸   â Ƿ  д   ޸𸮴    
+    static const size_t windowSize = 64;
+    uint32_t batch = modelManager->BeginLoadBatch();
+    std::vector<InteriorDesign::SavedModelInfo> window;
+    window.reserve(windowSize);
+    InteriorDesign::InteriorState state;
+
+    // â ȿ ī޶  ġ  (  Ű  ī޶ 𵨺 տ ־ ̹  )
+    auto flushWindow = [&window, &state, modelManager, batch]()
+    {
+        XMFLOAT3 cameraPosition = state.camera.position;
+        auto distanceSquared = [&cameraPosition](const InteriorDesign::SavedModelInfo &model)
+        {
+            float dx = model.position.x - cameraPosition.x;
+            float dy = model.position.y - cameraPosition.y;
+            float dz = model.position.z - cameraPosition.z;
+            return dx * dx + dy * dy + dz * dz;
+        };
+        std::stable_sort(window.begin(), window.end(),
+                         [&distanceSquared](const InteriorDesign::SavedModelInfo &a, const InteriorDesign::SavedModelInfo &b)
+                         { return distanceSquared(a) < distanceSquared(b); });
+
+        for (const auto &model : window)
+        {
+            ModelManager::InstancePlacement placement;
+            placement.Position = model.position;
+            placement.Rotation = model.rotation;
+            placement.Scale = model.scale;
+            placement.Visible = model.visible;
+            modelManager->AddModelInstanceAsync(model.filePath, model.type == "GLB" ? MODEL_GLB : MODEL_OBJ, placement, batch);
         }
+        window.clear();
+    };
 
-        //   (LightManager ClearLights(), AddLight()  ޼尡 ʿ)
-        for (auto &lightInfo : state.lights)
+    auto result = InteriorStateReader::ReadFile(filename, state, [&window, &flushWindow](const InteriorDesign::SavedModelInfo &model)
+    {
+        if (model.type == "OBJ" || model.type == "GLB")
         {
-            //  ߰  
-            int lightIndex = lightManager->AddLight(static_cast<LightType>(lightInfo.type));
-            Light *light = lightManager->GetLight(lightIndex);
-            if (light)
+            window.push_back(model);
+            if (window.size() >= windowSize)
             {
-                light->SetPosition(lightInfo.position.x, lightInfo.position.y, lightInfo.position.z);
-                light->SetDirection(lightInfo.direction.x, lightInfo.direction.y, lightInfo.direction.z);
-                light->SetColor(lightInfo.color.x, lightInfo.color.y, lightInfo.color.z);
-                light->SetIntensity(lightInfo.intensity);
-                light->SetRange(lightInfo.range);
-                light->SetAttenuation(lightInfo.attenuation);
-                // ƮƮ    
-                //if (lightInfo.type == LIGHT_SPOT)
-                //{
-                //    LightData lightData = light->GetLightData();
-                //    lightData.Factors.z = lightInfo.innerCone;
-                //    lightData.Factors.w = lightInfo.outerCone;
-                //    light->SetLightData(lightData);
-                //}
+                flushWindow();
             }
         }
+        return true;
+    });
+
+    if (!result.Succeeded)
+    {
+        // ߸ ̸ д   ε常  (   ε ״)
+        modelManager->CancelLoadBatch(batch);
+        OutputDebugStringA(("׸  б  (" + std::to_string(result.BytesRead) + "): " +
+                            result.ErrorMessage + "\n")
+                               .c_str());
+        return false;
+    }
+    flushWindow();
+
+    // νϽ   UpdateLoadingStatus Ƿ  ϴ 𵨿  ġ   
+    modelManager->ClearModels(batch);
+
+    // /ī޶/     
+    RestoreRoomAndCamera(state, roomModel, camera);
+    RestoreLights(state, lightManager);
 
+    OutputDebugStringA(("Layout restore (streamed): " + std::to_string(result.ModelCount) + " models queued\n").c_str());
+    return true;
+}
+
+void InteriorStateManager::RestoreRoomAndCamera(const InteriorDesign::InteriorState &state,
+                                                std::shared_ptr<RoomModel> roomModel,
+                                                Camera *camera)
+{
+    //   
+    roomModel->SetRoomWidth(state.room.width);
+    roomModel->SetRoomHeight(state.room.height);
+    roomModel->SetRoomDepth(state.room.depth);
+    roomModel->SetFloorColor(state.room.floorColor);
+    roomModel->SetCeilingColor(state.room.ceilingColor);
+    roomModel->SetWallColor(state.room.wallColor);
+    roomModel->SetWindowColor(state.room.windowColor);
+    roomModel->SetHasWindow(state.room.hasWindow);
+
+    // ī޶  
+    camera->SetPosition(state.camera.position.x, state.camera.position.y, state.camera.position.z);
+    camera->SetRotation(state.camera.rotation.x, state.camera.rotation.y, state.camera.rotation.z);
+    camera->SetFieldOfView(state.camera.fieldOfView);
+    camera->SetNearPlane(state.camera.nearPlane);
+    camera->SetFarPlane(state.camera.farPlane);
+    camera->SetCameraMode(static_cast<CameraMode>(state.camera.mode));
+}
+
+void InteriorStateManager::RestoreLights(const InteriorDesign::InteriorState &state, LightManager *lightManager)
+{
+    //   (LightManager ClearLights(), AddLight()  ޼尡 ʿ)
+    for (auto &lightInfo : state.lights)
+    {
+        //  ߰  
+        int lightIndex = lightManager->AddLight(static_cast<LightType>(lightInfo.type));
+        Light *light = lightManager->GetLight(lightIndex);
+        if (light)
+        {
+            light->SetPosition(lightInfo.position.x, lightInfo.position.y, lightInfo.position.z);
+            light->SetDirection(lightInfo.direction.x, lightInfo.direction.y, lightInfo.direction.z);
+            light->SetColor(lightInfo.color.x, lightInfo.color.y, lightInfo.color.z);
+            light->SetIntensity(lightInfo.intensity);
+            light->SetRange(lightInfo.range);
+            light->SetAttenuation(lightInfo.attenuation);
+            // ƮƮ    
+            //if (lightInfo.type == LIGHT_SPOT)
+            //{
+            //    LightData lightData = light->GetLightData();
+            //    lightData.Factors.z = lightInfo.innerCone;
+            //    lightData.Factors.w = lightInfo.outerCone;
+            //    light->SetLightData(lightData);
+            //}
+        }
+    }
+}
+
+bool InteriorStateManager::ConvertStateFile(const std::string &sourcePath, const std::string &targetPath)
+{
+    try
+    {
+        InteriorDesign::InteriorState state;
+        if (!ReadStateFile(sourcePath, state) || !WriteStateFile(targetPath, state))
+        {
+            return false;
+        }
+
+        OutputDebugStringA(("ġ  ȯ: " + sourcePath + " -> " + targetPath + "\n").c_str());
         return true;
     }
     catch (const std::exception &e)
     {
-        OutputDebugStringA(("  : " + std::string(e.what()) + "\n").c_str());
+        OutputDebugStringA(("ġ  ȯ : " + std::string(e.what()) + "\n").c_str());
+        return false;
+    }
+}
+
+void InteriorStateManager::BenchmarkStateFormats(size_t modelCount)
+{
+    // ռ ġ -  200 ڿ ݺ ġϰ  8
+    InteriorDesign::InteriorState state;
+    state.createdAt = GetCurrentTimeString();
+    state.description = "Layout format benchmark";
+    state.room = {20.0f, 10.0f, 20.0f, {0.8f, 0.8f, 0.8f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f},
+                  {0.9f, 0.9f, 0.85f, 1.0f}, {0.6f, 0.8f, 1.0f, 0.5f}, true};
+    state.camera = {{0.0f, 1.7f, -20.0f}, {0.0f, 0.0f, 0.0f}, XM_PIDIV4, 0.1f, 1000.0f, 0};
+
+    state.models.resize(modelCount);
+    for (size_t i = 0; i < modelCount; i++)
+    {
+        InteriorDesign::SavedModelInfo &model = state.models[i];
+        size_t kind = i % 200;
+        model.name = "Furniture_" + std::to_string(kind);
+        model.filePath = "C:\\Assets\\Furniture\\furniture_" + std::to_string(kind) + (kind % 4 == 0 ? ".obj" : ".glb");
+        model.type = kind % 4 == 0 ? "OBJ" : "GLB";
+        model.position = {static_cast<float>(i % 316) * 1.5f, 0.0f, static_cast<float>(i / 316) * 1.5f};
+        model.rotation = {0.0f, static_cast<float>(i % 8) * XM_PIDIV4, 0.0f};
+        model.scale = {1.0f, 1.0f, 1.0f};
+        model.visible = (i % 16) != 0;
+    }
+
+    state.lights.resize(8);
+    for (size_t i = 0; i < state.lights.size(); i++)
+    {
+        state.lights[i] = {static_cast<int>(i % 3), {static_cast<float>(i) * 4.0f, 3.0f, 0.0f}, {0.0f, -1.0f, 0.0f},
+                           {1.0f, 0.95f, 0.9f}, 1.0f, 50.0f, 0.1f, XM_PIDIV4, XM_PIDIV2};
+    }
+
+    std::error_code error;
+    std::filesystem::path directory = std::filesystem::temp_directory_path(error);
+    std::string jsonPath = (directory / "layout_benchmark.interior").string();
+    std::string binaryPath = (directory / ("layout_benchmark" + std::string(LayoutFile::Extension))).string();
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto milliseconds = [](Clock::time_point start, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    InteriorDesign::InteriorState jsonState;
+    InteriorDesign::InteriorState binaryState;
+
+    auto jsonSaveStart = Clock::now();
+    bool succeeded = WriteStateFile(jsonPath, state);
+    auto jsonLoadStart = Clock::now();
+    succeeded = succeeded && ReadStateFile(jsonPath, jsonState);
+    auto jsonDomStart = Clock::now();
+
+    // 񱳿 -  ü ڿ а DOM   
+    {
+        std::ifstream file(jsonPath);
+        std::string jsonString((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        InteriorDesign::InteriorState domState = JsonToState(jsonString);
+    }
+    auto binarySaveStart = Clock::now();
+    succeeded = succeeded && WriteStateFile(binaryPath, state);
+    auto binaryOpenStart = Clock::now();
+
+    // ΰ ˻縸 (迭 ε ޸𸮸 ״ )
+    LayoutFile layout;
+    succeeded = succeeded && layout.Open(binaryPath);
+    auto binaryOpenEnd = Clock::now();
+    layout.Close();
+
+    auto binaryLoadStart = Clock::now();
+    succeeded = succeeded && ReadStateFile(binaryPath, binaryState);
+    auto binaryLoadEnd = Clock::now();
+
+    //  Ŀ  °   JSON Ǵ ս  ȯ Ȯ
+    std::string expected = StateToJson(state);
+    bool lossless = succeeded && StateToJson(jsonState) == expected && StateToJson(binaryState) == expected;
+
+    uint64_t jsonBytes = std::filesystem::file_size(jsonPath, error);
+    uint64_t binaryBytes = std::filesystem::file_size(binaryPath, error);
+    std::filesystem::remove(jsonPath, error);
+    std::filesystem::remove(binaryPath, error);
+
+    OutputDebugStringA(("Layout format benchmark: " + std::to_string(modelCount) + " models" +
+                        (succeeded ? "" : " (failed)") +
+                        "\n  json   save " + std::to_string(milliseconds(jsonSaveStart, jsonLoadStart)) +
+                        " ms, load " + std::to_string(milliseconds(jsonLoadStart, jsonDomStart)) +
+                        " ms (dom " + std::to_string(milliseconds(jsonDomStart, binarySaveStart)) +
+                        " ms), " + std::to_string(jsonBytes / 1024) + " KB" +
+                        "\n  binary save " + std::to_string(milliseconds(binarySaveStart, binaryOpenStart)) +
+                        " ms, map " + std::to_string(milliseconds(binaryOpenStart, binaryOpenEnd)) +
+                        " ms, load " + std::to_string(milliseconds(binaryLoadStart, binaryLoadEnd)) +
+                        " ms, " + std::to_string(binaryBytes / 1024) + " KB" +
+                        "\n  round trip " + (lossless ? "lossless" : "MISMATCH") + "\n")
+                           .c_str());
+}
+
+bool InteriorStateManager::ReadStateFile(const std::string &filename, InteriorDesign::InteriorState &state)
+{
+    // ̳ʸ ġ  ؼ 迭 ٷ 
+    if (LayoutFile::IsLayoutFile(filename))
+    {
+        LayoutFile layout;
+        if (!layout.Open(filename))
+        {
+            return false;
+        }
+        layout.ToState(state);
+        return true;
+    }
+
+    // JSON DOM  ʰ Ʈ 
+    auto result = InteriorStateReader::ReadFile(filename, state, [&state](const InteriorDesign::SavedModelInfo &model)
+    {
+        state.models.push_back(model);
+        return true;
+    });
+
+    if (!result.Succeeded)
+    {
+        OutputDebugStringA(("׸  б  (" + std::to_string(result.BytesRead) + "): " +
+                            result.ErrorMessage + "\n")
+                               .c_str());
+    }
+    return result.Succeeded;
+}
+
+bool InteriorStateManager::WriteStateFile(const std::string &filename, const InteriorDesign::InteriorState &state)
+{
+    if (IsBinaryStatePath(filename))
+    {
+        return LayoutFile::Save(state, filename);
+    }
+
+    std::string jsonString = StateToJson(state);
+
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
         return false;
     }
+
+    file << jsonString;
+    file.close();
+    return file.good();
+}
+
+bool InteriorStateManager::IsBinaryStatePath(const std::string &filename)
+{
+    std::string extension = std::filesystem::path(filename).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == LayoutFile::Extension;
 }
 
 std::string InteriorStateManager::StateToJson(const InteriorDesign::InteriorState &state)
@@ -44,6 +44,12 @@ public:
                       LightManager *lightManager,
                       ID3D11Device *device);
 
+    // ġ   ȯ ( ,  Ȯڷ   - .interiorb ̳ʸ,  JSON)
+    bool ConvertStateFile(const std::string &sourcePath, const std::string &targetPath);
+
+    // ռ ġ JSON/̳ʸ   ε ð  (  )
+    void BenchmarkStateFormats(size_t modelCount);
+
     // ֱ    
     void AddRecentFile(const std::string &filename);
     std::vector<std::string> GetRecentFiles() const;
@@ -67,6 +73,24 @@ private:
     nlohmann::json LightInfoToJson(const InteriorDesign::SavedLightInfo &light);
     InteriorDesign::SavedLightInfo JsonToLightInfo(const nlohmann::json &json);
 
+    // JSON  Ʈ 鼭  ε带 ϰ,      /ī޶/ 
+    bool StreamStateFromFile(const std::string &filename,
+                             ModelManager *modelManager,
+                             std::shared_ptr<RoomModel> roomModel,
+                             Camera *camera,
+                             LightManager *lightManager);
+
+    //   /ī޶,  κ 
+    void RestoreRoomAndCamera(const InteriorDesign::InteriorState &state,
+                              std::shared_ptr<RoomModel> roomModel,
+                              Camera *camera);
+    void RestoreLights(const InteriorDesign::InteriorState &state, LightManager *lightManager);
+
+    // Ŀ °   б/
+    bool ReadStateFile(const std::string &filename, InteriorDesign::InteriorState &state);
+    bool WriteStateFile(const std::string &filename, const InteriorDesign::InteriorState &state);
+    static bool IsBinaryStatePath(const std::string &filename);
+
     //  Լ
     std::string GetCurrentTimeString();
     bool FileExists(const std::string &filename);
@@ -0,0 +1,369 @@
+#include "InteriorStateReader.h"
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+namespace
+{
+    using json = nlohmann::json;
+
+    // 읽는 중인 컨테이너 종류
+    enum class Container
+    {
+        Root,
+        Room,
+        Camera,
+        Models,
+        Model,
+        Lights,
+        Light,
+        Vector,  // 위치/색상 같은 숫자 배열
+        Skipped  // 모르는 키의 값 (안쪽은 모두 무시)
+    };
+
+    // 빠진 필드 기본값 (JsonToState와 같은 값, 벡터는 0 / 크기는 1)
+    InteriorDesign::SavedModelInfo MakeDefaultModel()
+    {
+        InteriorDesign::SavedModelInfo model;
+        model.type = "OBJ";
+        model.position = {0.0f, 0.0f, 0.0f};
+        model.rotation = {0.0f, 0.0f, 0.0f};
+        model.scale = {1.0f, 1.0f, 1.0f};
+        model.visible = true;
+        return model;
+    }
+
+    InteriorDesign::SavedLightInfo MakeDefaultLight()
+    {
+        InteriorDesign::SavedLightInfo light = {};
+        light.type = 1; // 기본값: Point Light
+        light.intensity = 1.0f;
+        light.range = 50.0f;
+        light.attenuation = 0.1f;
+        light.innerCone = XM_PIDIV4;
+        light.outerCone = XM_PIDIV2;
+        return light;
+    }
+
+    class StateSaxHandler : public json::json_sax_t
+    {
+    public:
+        StateSaxHandler(InteriorDesign::InteriorState &state, const InteriorStateReader::ModelCallback &onModel)
+            : state(state), onModel(onModel), model(MakeDefaultModel()), light(MakeDefaultLight())
+        {
+            state.version = "1.0";
+            state.room = {};
+            state.room.width = 20.0f;
+            state.room.height = 10.0f;
+            state.room.depth = 20.0f;
+            state.camera = {};
+            state.camera.fieldOfView = XM_PIDIV4;
+            state.camera.nearPlane = 0.1f;
+            state.camera.farPlane = 1000.0f;
+            state.models.clear();
+            state.lights.clear();
+            containers.reserve(8);
+        }
+
+        uint64_t GetModelCount() const { return modelCount; }
+        const std::string &GetErrorMessage() const { return errorMessage; }
+
+        bool null() override { return true; }
+        bool boolean(bool value) override
+        {
+            if (Value())
+            {
+                Boolean(value);
+            }
+            return true;
+        }
+        bool number_integer(number_integer_t value) override { return Number(static_cast<double>(value)); }
+        bool number_unsigned(number_unsigned_t value) override { return Number(static_cast<double>(value)); }
+        bool number_float(number_float_t value, const string_t &) override { return Number(value); }
+        bool string(string_t &value) override
+        {
+            if (Value())
+            {
+                String(value);
+            }
+            return true;
+        }
+        bool binary(binary_t &) override { return true; }
+
+        bool key(string_t &value) override
+        {
+            currentKey = value;
+            return true;
+        }
+
+        bool start_object(std::size_t) override
+        {
+            Container parent = containers.empty() ? Container::Skipped : containers.back();
+            Container next = Container::Skipped;
+            if (containers.empty())
+            {
+                next = Container::Root;
+            }
+            else if (parent == Container::Root && currentKey == "room")
+            {
+                next = Container::Room;
+            }
+            else if (parent == Container::Root && currentKey == "camera")
+            {
+                next = Container::Camera;
+            }
+            else if (parent == Container::Models)
+            {
+                next = Container::Model;
+                model = MakeDefaultModel();
+            }
+            else if (parent == Container::Lights)
+            {
+                next = Container::Light;
+                light = MakeDefaultLight();
+            }
+            containers.push_back(next);
+            return true;
+        }
+
+        bool end_object() override
+        {
+            Container finished = containers.back();
+            containers.pop_back();
+
+            if (finished == Container::Model)
+            {
+                // 다 읽은 모델을 바로 넘기고 다음 항목에 재사용
+                modelCount++;
+                if (onModel && !onModel(model))
+                {
+                    errorMessage = "Model callback stopped reading";
+                    return false;
+                }
+            }
+            else if (finished == Container::Light)
+            {
+                state.lights.push_back(light);
+            }
+            return true;
+        }
+
+        bool start_array(std::size_t) override
+        {
+            Container parent = containers.empty() ? Container::Skipped : containers.back();
+            Container next = Container::Skipped;
+            if (parent == Container::Root && currentKey == "models")
+            {
+                next = Container::Models;
+            }
+            else if (parent == Container::Root && currentKey == "lights")
+            {
+                next = Container::Lights;
+            }
+            else if (parent == Container::Room || parent == Container::Camera ||
+                     parent == Container::Model || parent == Container::Light)
+            {
+                next = Container::Vector;
+                vectorKey = currentKey;
+                vectorCount = 0;
+            }
+            containers.push_back(next);
+            return true;
+        }
+
+        bool end_array() override
+        {
+            Container finished = containers.back();
+            containers.pop_back();
+
+            if (finished == Container::Vector)
+            {
+                ApplyVector(containers.back());
+            }
+            return true;
+        }
+
+        bool parse_error(std::size_t position, const std::string &, const nlohmann::detail::exception &error) override
+        {
+            errorMessage = error.what();
+            errorPosition = position;
+            return false;
+        }
+
+        std::size_t GetErrorPosition() const { return errorPosition; }
+
+    private:
+        // 지금 읽은 값을 현재 키의 필드에 적용할지 (숫자 배열 요소와 모르는 키의 값은 제외)
+        bool Value()
+        {
+            return !containers.empty() && containers.back() != Container::Vector && containers.back() != Container::Skipped;
+        }
+
+        bool Number(double value)
+        {
+            Container current = containers.empty() ? Container::Skipped : containers.back();
+            if (current == Container::Vector)
+            {
+                if (vectorCount < 4)
+                {
+                    vectorValues[vectorCount] = static_cast<float>(value);
+                }
+                vectorCount++;
+                return true;
+            }
+
+            float number = static_cast<float>(value);
+            switch (current)
+            {
+            case Container::Room:
+                if (currentKey == "width") state.room.width = number;
+                else if (currentKey == "height") state.room.height = number;
+                else if (currentKey == "depth") state.room.depth = number;
+                break;
+            case Container::Camera:
+                if (currentKey == "fieldOfView") state.camera.fieldOfView = number;
+                else if (currentKey == "nearPlane") state.camera.nearPlane = number;
+                else if (currentKey == "farPlane") state.camera.farPlane = number;
+                else if (currentKey == "mode") state.camera.mode = static_cast<int>(value);
+                break;
+            case Container::Light:
+                if (currentKey == "type") light.type = static_cast<int>(value);
+                else if (currentKey == "intensity") light.intensity = number;
+                else if (currentKey == "range") light.range = number;
+                else if (currentKey == "attenuation") light.attenuation = number;
+                else if (currentKey == "innerCone") light.innerCone = number;
+                else if (currentKey == "outerCone") light.outerCone = number;
+                break;
+            default:
+                break;
+            }
+            return true;
+        }
+
+        void Boolean(bool value)
+        {
+            Container current = containers.back();
+            if (current == Container::Room && currentKey == "hasWindow")
+            {
+                state.room.hasWindow = value;
+            }
+            else if (current == Container::Model && currentKey == "visible")
+            {
+                model.visible = value;
+            }
+        }
+
+        void String(std::string &value)
+        {
+            Container current = containers.back();
+            if (current == Container::Root)
+            {
+                if (currentKey == "version") state.version.swap(value);
+                else if (currentKey == "createdAt") state.createdAt.swap(value);
+                else if (currentKey == "description") state.description.swap(value);
+            }
+            else if (current == Container::Model)
+            {
+                // 항목마다 같은 문자열 버퍼를 다시 사용
+                if (currentKey == "name") model.name.assign(value);
+                else if (currentKey == "filePath") model.filePath.assign(value);
+                else if (currentKey == "type") model.type.assign(value);
+            }
+        }
+
+        // 숫자 배열을 다 읽으면 필드에 적용 (JsonToState처럼 요소가 부족하면 무시)
+        void ApplyVector(Container owner)
+        {
+            if (vectorCount >= 3)
+            {
+                XMFLOAT3 vector3(vectorValues[0], vectorValues[1], vectorValues[2]);
+                switch (owner)
+                {
+                case Container::Camera:
+                    if (vectorKey == "position") state.camera.position = vector3;
+                    else if (vectorKey == "rotation") state.camera.rotation = vector3;
+                    break;
+                case Container::Model:
+                    if (vectorKey == "position") model.position = vector3;
+                    else if (vectorKey == "rotation") model.rotation = vector3;
+                    else if (vectorKey == "scale") model.scale = vector3;
+                    break;
+                case Container::Light:
+                    if (vectorKey == "position") light.position = vector3;
+                    else if (vectorKey == "direction") light.direction = vector3;
+                    else if (vectorKey == "color") light.color = vector3;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            if (vectorCount >= 4 && owner == Container::Room)
+            {
+                XMFLOAT4 color(vectorValues[0], vectorValues[1], vectorValues[2], vectorValues[3]);
+                if (vectorKey == "floorColor") state.room.floorColor = color;
+                else if (vectorKey == "ceilingColor") state.room.ceilingColor = color;
+                else if (vectorKey == "wallColor") state.room.wallColor = color;
+                else if (vectorKey == "windowColor") state.room.windowColor = color;
+            }
+        }
+
+        InteriorDesign::InteriorState &state;
+        const InteriorStateReader::ModelCallback &onModel;
+
+        std::vector<Container> containers;
+        std::string currentKey;
+        std::string vectorKey;
+        float vectorValues[4] = {};
+        size_t vectorCount = 0;
+
+        // 읽는 중인 항목 (모델은 콜백으로 넘긴 뒤 재사용)
+        InteriorDesign::SavedModelInfo model;
+        InteriorDesign::SavedLightInfo light;
+        uint64_t modelCount = 0;
+
+        std::string errorMessage;
+        std::size_t errorPosition = 0;
+    };
+}
+
+InteriorStateReader::Result InteriorStateReader::Read(std::istream &input, InteriorDesign::InteriorState &state, const ModelCallback &onModel)
+{
+    Result result;
+    StateSaxHandler handler(state, onModel);
+
+    try
+    {
+        result.Succeeded = json::sax_parse(input, &handler);
+    }
+    catch (const std::exception &e)
+    {
+        result.Succeeded = false;
+        result.ErrorMessage = e.what();
+    }
+
+    result.ModelCount = handler.GetModelCount();
+    if (!result.Succeeded && result.ErrorMessage.empty())
+    {
+        result.ErrorMessage = handler.GetErrorMessage();
+        result.BytesRead = handler.GetErrorPosition();
+    }
+    return result;
+}
+
+InteriorStateReader::Result InteriorStateReader::ReadFile(const std::string &filename, InteriorDesign::InteriorState &state, const ModelCallback &onModel)
+{
+    // 파일 크기와 상관없이 고정 크기 버퍼로 조금씩 읽음
+    std::vector<char> buffer(64 * 1024);
+    std::ifstream file;
+    file.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    file.open(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        Result result;
+        result.ErrorMessage = "Failed to open " + filename;
+        return result;
+    }
+
+    return Read(file, state, onModel);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "InteriorState.h"
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+
+// .interior JSON 파일을 DOM 없이 읽는 스트리밍 리더
+// nlohmann::json의 SAX 인터페이스로 토큰을 받아서 모델 항목 하나를 다 읽을 때마다 바로 콜백으로 넘긴다
+// 모델은 누적하지 않고 항목 하나만 재사용하므로 모델 수와 상관없이 사용하는 메모리가 일정하다
+// 빠진 필드는 JsonToState와 같은 기본값을 사용한다
+class InteriorStateReader
+{
+public:
+    // 모델 항목 하나를 다 읽었을 때 호출 (false를 반환하면 읽기 중단)
+    using ModelCallback = std::function<bool(const InteriorDesign::SavedModelInfo &model)>;
+
+    // 읽기 결과
+    struct Result
+    {
+        bool Succeeded = false;
+        uint64_t ModelCount = 0;    // 콜백으로 넘긴 모델 수
+        uint64_t BytesRead = 0;     // 오류가 나면 오류 위치
+        std::string ErrorMessage;
+    };
+
+    // state에는 모델을 제외한 항목(메타데이터, 방, 카메라, 조명)을 채우고 모델은 onModel로 넘김
+    static Result Read(std::istream &input, InteriorDesign::InteriorState &state, const ModelCallback &onModel);
+    static Result ReadFile(const std::string &filename, InteriorDesign::InteriorState &state, const ModelCallback &onModel);
+};
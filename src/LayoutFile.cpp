@@ -0,0 +1,416 @@
+#include "LayoutFile.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace
+{
+    const uint32_t layoutMagic = 0x42594C49; // "ILYB"
+
+    // 섹션 시작 위치 정렬 (매핑 시작 주소는 페이지 단위이므로 파일 안의 위치만 맞추면 됨)
+    const uint64_t sectionAlignment = 16;
+
+    static_assert(sizeof(LayoutFile::RoomRecord) == 80, "RoomRecord layout is part of the file format");
+    static_assert(sizeof(LayoutFile::CameraRecord) == 40, "CameraRecord layout is part of the file format");
+    static_assert(sizeof(LayoutFile::LightRecord) == 60, "LightRecord layout is part of the file format");
+    static_assert(sizeof(XMFLOAT3) == 12, "XMFLOAT3 layout is part of the file format");
+
+    // 같은 문자열을 한 번만 저장하는 문자열 표 (키는 직렬화하는 상태의 문자열을 가리킴)
+    class StringTable
+    {
+    public:
+        uint32_t Intern(const std::string& value)
+        {
+            auto found = indices.find(value);
+            if (found != indices.end())
+            {
+                return found->second;
+            }
+
+            uint32_t index = static_cast<uint32_t>(offsets.size());
+            indices.emplace(std::string_view(value), index);
+            offsets.push_back(static_cast<uint32_t>(data.size()));
+            data.insert(data.end(), value.begin(), value.end());
+            return index;
+        }
+
+        uint32_t GetCount() const { return static_cast<uint32_t>(offsets.size()); }
+
+        // 끝 위치를 붙인 시작 위치 목록
+        std::vector<uint32_t> GetOffsets() const
+        {
+            std::vector<uint32_t> result = offsets;
+            result.push_back(static_cast<uint32_t>(data.size()));
+            return result;
+        }
+
+        const std::vector<char>& GetData() const { return data; }
+
+    private:
+        std::unordered_map<std::string_view, uint32_t> indices;
+        std::vector<uint32_t> offsets;
+        std::vector<char> data;
+    };
+}
+
+const char* LayoutFile::Extension = ".interiorb";
+
+LayoutFile::LayoutFile()
+{
+}
+
+bool LayoutFile::IsLayoutFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    uint32_t magic = 0;
+    return in.read(reinterpret_cast<char*>(&magic), sizeof(magic)) && magic == layoutMagic;
+}
+
+bool LayoutFile::Serialize(const InteriorDesign::InteriorState& state, std::vector<char>& bytes)
+{
+    const size_t modelCount = state.models.size();
+    const size_t lightCount = state.lights.size();
+
+    // 모델 변환은 항목별 구조체 대신 필드별 배열로 모음
+    std::vector<XMFLOAT3> positions(modelCount);
+    std::vector<XMFLOAT3> rotations(modelCount);
+    std::vector<XMFLOAT3> scales(modelCount);
+    std::vector<uint8_t> flags(modelCount);
+    std::vector<uint32_t> names(modelCount);
+    std::vector<uint32_t> paths(modelCount);
+    std::vector<uint32_t> types(modelCount);
+
+    StringTable strings;
+    uint32_t versionString = strings.Intern(state.version);
+    uint32_t createdAtString = strings.Intern(state.createdAt);
+    uint32_t descriptionString = strings.Intern(state.description);
+
+    for (size_t i = 0; i < modelCount; i++)
+    {
+        const InteriorDesign::SavedModelInfo& model = state.models[i];
+        positions[i] = model.position;
+        rotations[i] = model.rotation;
+        scales[i] = model.scale;
+        flags[i] = model.visible ? FlagVisible : 0;
+        names[i] = strings.Intern(model.name);
+        paths[i] = strings.Intern(model.filePath);
+        types[i] = strings.Intern(model.type);
+    }
+
+    // 문자열 위치는 32비트로 저장
+    if (strings.GetData().size() > UINT32_MAX || modelCount > UINT32_MAX || lightCount > UINT32_MAX)
+    {
+        OutputDebugStringA("Layout is too large for the binary format\n");
+        return false;
+    }
+
+    RoomRecord room;
+    room.Width = state.room.width;
+    room.Height = state.room.height;
+    room.Depth = state.room.depth;
+    room.FloorColor = state.room.floorColor;
+    room.CeilingColor = state.room.ceilingColor;
+    room.WallColor = state.room.wallColor;
+    room.WindowColor = state.room.windowColor;
+    room.HasWindow = state.room.hasWindow ? 1 : 0;
+
+    CameraRecord camera;
+    camera.Position = state.camera.position;
+    camera.Rotation = state.camera.rotation;
+    camera.FieldOfView = state.camera.fieldOfView;
+    camera.NearPlane = state.camera.nearPlane;
+    camera.FarPlane = state.camera.farPlane;
+    camera.Mode = state.camera.mode;
+
+    std::vector<LightRecord> lights(lightCount);
+    for (size_t i = 0; i < lightCount; i++)
+    {
+        const InteriorDesign::SavedLightInfo& light = state.lights[i];
+        lights[i].Type = light.type;
+        lights[i].Position = light.position;
+        lights[i].Direction = light.direction;
+        lights[i].Color = light.color;
+        lights[i].Intensity = light.intensity;
+        lights[i].Range = light.range;
+        lights[i].Attenuation = light.attenuation;
+        lights[i].InnerCone = light.innerCone;
+        lights[i].OuterCone = light.outerCone;
+    }
+
+    std::vector<uint32_t> stringOffsets = strings.GetOffsets();
+
+    FileHeader fileHeader = {};
+    fileHeader.Magic = layoutMagic;
+    fileHeader.Version = FormatVersion;
+    fileHeader.HeaderSize = sizeof(FileHeader);
+    fileHeader.ModelCount = static_cast<uint32_t>(modelCount);
+    fileHeader.LightCount = static_cast<uint32_t>(lightCount);
+    fileHeader.StringCount = strings.GetCount();
+    fileHeader.VersionString = versionString;
+    fileHeader.CreatedAtString = createdAtString;
+    fileHeader.DescriptionString = descriptionString;
+
+    // 섹션 내용을 섹션 표 순서대로 나열
+    const void* sectionData[SectionCount] = {
+        &room, &camera, lights.data(),
+        positions.data(), rotations.data(), scales.data(), flags.data(),
+        names.data(), paths.data(), types.data(),
+        stringOffsets.data(), strings.GetData().data() };
+    const uint64_t sectionSizes[SectionCount] = {
+        sizeof(RoomRecord), sizeof(CameraRecord), lightCount * sizeof(LightRecord),
+        modelCount * sizeof(XMFLOAT3), modelCount * sizeof(XMFLOAT3), modelCount * sizeof(XMFLOAT3), modelCount,
+        modelCount * sizeof(uint32_t), modelCount * sizeof(uint32_t), modelCount * sizeof(uint32_t),
+        stringOffsets.size() * sizeof(uint32_t), strings.GetData().size() };
+
+    uint64_t offset = sizeof(FileHeader);
+    for (uint32_t section = 0; section < SectionCount; section++)
+    {
+        offset = (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+        fileHeader.Sections[section].Offset = offset;
+        fileHeader.Sections[section].Size = sectionSizes[section];
+        offset += sectionSizes[section];
+    }
+    fileHeader.FileSize = offset;
+
+    bytes.assign(static_cast<size_t>(offset), 0);
+    memcpy(bytes.data(), &fileHeader, sizeof(FileHeader));
+    for (uint32_t section = 0; section < SectionCount; section++)
+    {
+        if (sectionSizes[section] > 0)
+        {
+            memcpy(bytes.data() + fileHeader.Sections[section].Offset, sectionData[section], static_cast<size_t>(sectionSizes[section]));
+        }
+    }
+    return true;
+}
+
+bool LayoutFile::Save(const InteriorDesign::InteriorState& state, const std::string& path)
+{
+    std::vector<char> bytes;
+    if (!Serialize(state, bytes))
+    {
+        return false;
+    }
+
+    // 임시 파일에 쓴 뒤 교체 (쓰기 도중 종료되어도 이전 파일이 남도록)
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+        out.write(bytes.data(), bytes.size());
+        if (!out.good())
+        {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        OutputDebugStringA(("Failed to replace layout file: " + path + "\n").c_str());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+bool LayoutFile::Open(const std::string& path)
+{
+    Close();
+
+    if (!file.Open(path) || file.GetSize() < sizeof(FileHeader))
+    {
+        file.Close();
+        return false;
+    }
+
+    header = reinterpret_cast<const FileHeader*>(file.GetData());
+    if (!Validate())
+    {
+        OutputDebugStringA(("Invalid layout file: " + path + "\n").c_str());
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void LayoutFile::Close()
+{
+    header = nullptr;
+    file.Close();
+}
+
+bool LayoutFile::Validate() const
+{
+    if (header->Magic != layoutMagic || header->Version != FormatVersion ||
+        header->HeaderSize != sizeof(FileHeader) || header->FileSize != file.GetSize())
+    {
+        return false;
+    }
+
+    // 섹션마다 정렬, 파일 범위, 항목 수에 맞는 크기 확인
+    const uint64_t modelCount = header->ModelCount;
+    const uint64_t expectedSizes[SectionCount] = {
+        sizeof(RoomRecord), sizeof(CameraRecord), header->LightCount * sizeof(LightRecord),
+        modelCount * sizeof(XMFLOAT3), modelCount * sizeof(XMFLOAT3), modelCount * sizeof(XMFLOAT3), modelCount,
+        modelCount * sizeof(uint32_t), modelCount * sizeof(uint32_t), modelCount * sizeof(uint32_t),
+        (static_cast<uint64_t>(header->StringCount) + 1) * sizeof(uint32_t), header->Sections[SectionStringData].Size };
+
+    for (uint32_t section = 0; section < SectionCount; section++)
+    {
+        const SectionEntry& entry = header->Sections[section];
+        if (entry.Offset % sectionAlignment != 0 || entry.Offset < sizeof(FileHeader) ||
+            entry.Offset > header->FileSize || entry.Size > header->FileSize - entry.Offset ||
+            entry.Size != expectedSizes[section])
+        {
+            return false;
+        }
+    }
+
+    // 문자열 위치는 늘어나기만 하고 마지막 위치가 문자열 데이터 끝
+    const uint32_t* offsets = GetSection<uint32_t>(SectionStringOffsets);
+    const uint32_t stringCount = header->StringCount;
+    if (offsets[0] != 0 || offsets[stringCount] != header->Sections[SectionStringData].Size)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < stringCount; i++)
+    {
+        if (offsets[i] > offsets[i + 1])
+        {
+            return false;
+        }
+    }
+
+    // 모든 문자열 번호가 문자열 표 안에 있는지 확인 (읽을 때는 다시 검사하지 않음)
+    if (header->VersionString >= stringCount || header->CreatedAtString >= stringCount ||
+        header->DescriptionString >= stringCount)
+    {
+        return false;
+    }
+
+    const uint32_t* indexSections[] = { GetNameIndices(), GetPathIndices(), GetTypeIndices() };
+    for (const uint32_t* indices : indexSections)
+    {
+        for (uint32_t i = 0; i < header->ModelCount; i++)
+        {
+            if (indices[i] >= stringCount)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+uint32_t LayoutFile::GetModelCount() const
+{
+    return header ? header->ModelCount : 0;
+}
+
+uint32_t LayoutFile::GetLightCount() const
+{
+    return header ? header->LightCount : 0;
+}
+
+uint32_t LayoutFile::GetStringCount() const
+{
+    return header ? header->StringCount : 0;
+}
+
+const LayoutFile::RoomRecord& LayoutFile::GetRoom() const
+{
+    return *GetSection<RoomRecord>(SectionRoom);
+}
+
+const LayoutFile::CameraRecord& LayoutFile::GetCamera() const
+{
+    return *GetSection<CameraRecord>(SectionCamera);
+}
+
+std::string_view LayoutFile::GetString(uint32_t index) const
+{
+    if (!header || index >= header->StringCount)
+    {
+        return std::string_view();
+    }
+
+    const uint32_t* offsets = GetSection<uint32_t>(SectionStringOffsets);
+    const char* data = GetSection<char>(SectionStringData);
+    return std::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+void LayoutFile::ToState(InteriorDesign::InteriorState& state) const
+{
+    if (!header)
+    {
+        return;
+    }
+
+    state.version = std::string(GetString(header->VersionString));
+    state.createdAt = std::string(GetString(header->CreatedAtString));
+    state.description = std::string(GetString(header->DescriptionString));
+
+    const RoomRecord& room = GetRoom();
+    state.room.width = room.Width;
+    state.room.height = room.Height;
+    state.room.depth = room.Depth;
+    state.room.floorColor = room.FloorColor;
+    state.room.ceilingColor = room.CeilingColor;
+    state.room.wallColor = room.WallColor;
+    state.room.windowColor = room.WindowColor;
+    state.room.hasWindow = room.HasWindow != 0;
+
+    const CameraRecord& camera = GetCamera();
+    state.camera.position = camera.Position;
+    state.camera.rotation = camera.Rotation;
+    state.camera.fieldOfView = camera.FieldOfView;
+    state.camera.nearPlane = camera.NearPlane;
+    state.camera.farPlane = camera.FarPlane;
+    state.camera.mode = camera.Mode;
+
+    const LightRecord* lights = GetLights();
+    state.lights.resize(header->LightCount);
+    for (uint32_t i = 0; i < header->LightCount; i++)
+    {
+        InteriorDesign::SavedLightInfo& light = state.lights[i];
+        light.type = lights[i].Type;
+        light.position = lights[i].Position;
+        light.direction = lights[i].Direction;
+        light.color = lights[i].Color;
+        light.intensity = lights[i].Intensity;
+        light.range = lights[i].Range;
+        light.attenuation = lights[i].Attenuation;
+        light.innerCone = lights[i].InnerCone;
+        light.outerCone = lights[i].OuterCone;
+    }
+
+    const XMFLOAT3* positions = GetPositions();
+    const XMFLOAT3* rotations = GetRotations();
+    const XMFLOAT3* scales = GetScales();
+    const uint8_t* flags = GetFlags();
+    const uint32_t* names = GetNameIndices();
+    const uint32_t* paths = GetPathIndices();
+    const uint32_t* types = GetTypeIndices();
+
+    state.models.resize(header->ModelCount);
+    for (uint32_t i = 0; i < header->ModelCount; i++)
+    {
+        InteriorDesign::SavedModelInfo& model = state.models[i];
+        model.name.assign(GetString(names[i]));
+        model.filePath.assign(GetString(paths[i]));
+        model.type.assign(GetString(types[i]));
+        model.position = positions[i];
+        model.rotation = rotations[i];
+        model.scale = scales[i];
+        model.visible = (flags[i] & FlagVisible) != 0;
+    }
+}
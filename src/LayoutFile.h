@@ -0,0 +1,153 @@
+#pragma once
+#include "InteriorState.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 메모리 매핑으로 읽는 바이너리 인테리어 배치 파일 (.interiorb)
+// 헤더와 섹션 표 뒤에 방/카메라/조명 블록, 모델 변환 SoA 배열, 경로와 이름을 한 번씩만 저장하는 문자열 표가 이어진다
+// 열 때는 파일을 매핑하고 범위만 검사하므로 항목마다 할당하지 않고 배열을 그대로 읽을 수 있다
+// JSON .interior 파일과 같은 내용을 담으므로 InteriorState를 거쳐 손실 없이 서로 변환된다
+class LayoutFile
+{
+public:
+    // 파일 포맷 버전 - 레코드나 섹션 구성이 바뀌면 올림
+    static const uint32_t FormatVersion = 1;
+
+    // 바이너리 배치 파일 확장자
+    static const char* Extension;
+
+    // 섹션 종류 (섹션 표의 순서)
+    enum Section : uint32_t
+    {
+        SectionRoom = 0,
+        SectionCamera,
+        SectionLights,
+        SectionPositions,     // 모델마다 XMFLOAT3
+        SectionRotations,     // 모델마다 XMFLOAT3
+        SectionScales,        // 모델마다 XMFLOAT3
+        SectionFlags,         // 모델마다 uint8_t (FlagVisible)
+        SectionNames,         // 모델마다 문자열 번호
+        SectionPaths,         // 모델마다 문자열 번호
+        SectionTypes,         // 모델마다 문자열 번호 ("OBJ", "GLB")
+        SectionStringOffsets, // 문자열마다 시작 위치 + 끝 위치 하나 (uint32_t)
+        SectionStringData,
+        SectionCount
+    };
+
+    static const uint8_t FlagVisible = 0x01;
+
+    // 파일에 그대로 저장하는 고정 크기 레코드 (4바이트 단위 필드만 사용)
+    struct RoomRecord
+    {
+        float Width;
+        float Height;
+        float Depth;
+        XMFLOAT4 FloorColor;
+        XMFLOAT4 CeilingColor;
+        XMFLOAT4 WallColor;
+        XMFLOAT4 WindowColor;
+        uint32_t HasWindow;
+    };
+
+    struct CameraRecord
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Rotation;
+        float FieldOfView;
+        float NearPlane;
+        float FarPlane;
+        int32_t Mode;
+    };
+
+    struct LightRecord
+    {
+        int32_t Type;
+        XMFLOAT3 Position;
+        XMFLOAT3 Direction;
+        XMFLOAT3 Color;
+        float Intensity;
+        float Range;
+        float Attenuation;
+        float InnerCone;
+        float OuterCone;
+    };
+
+    LayoutFile();
+
+    LayoutFile(const LayoutFile&) = delete;
+    LayoutFile& operator=(const LayoutFile&) = delete;
+
+    // 파일 앞부분의 식별자로 바이너리 배치 파일인지 확인
+    static bool IsLayoutFile(const std::string& path);
+
+    // 상태를 파일 내용으로 직렬화 (같은 문자열은 문자열 표에 한 번만 저장)
+    static bool Serialize(const InteriorDesign::InteriorState& state, std::vector<char>& bytes);
+
+    // 상태를 파일로 저장 (임시 파일에 쓴 뒤 교체)
+    static bool Save(const InteriorDesign::InteriorState& state, const std::string& path);
+
+    // 파일을 매핑하고 헤더, 섹션 범위, 문자열 번호를 검사 (실패하면 닫힌 상태)
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return header != nullptr; }
+
+    // 매핑된 데이터 직접 접근 (Open이 성공한 동안만 유효)
+    uint32_t GetModelCount() const;
+    uint32_t GetLightCount() const;
+    uint32_t GetStringCount() const;
+
+    const RoomRecord& GetRoom() const;
+    const CameraRecord& GetCamera() const;
+    const LightRecord* GetLights() const { return GetSection<LightRecord>(SectionLights); }
+
+    const XMFLOAT3* GetPositions() const { return GetSection<XMFLOAT3>(SectionPositions); }
+    const XMFLOAT3* GetRotations() const { return GetSection<XMFLOAT3>(SectionRotations); }
+    const XMFLOAT3* GetScales() const { return GetSection<XMFLOAT3>(SectionScales); }
+    const uint8_t* GetFlags() const { return GetSection<uint8_t>(SectionFlags); }
+    const uint32_t* GetNameIndices() const { return GetSection<uint32_t>(SectionNames); }
+    const uint32_t* GetPathIndices() const { return GetSection<uint32_t>(SectionPaths); }
+    const uint32_t* GetTypeIndices() const { return GetSection<uint32_t>(SectionTypes); }
+
+    // 문자열 표의 문자열 (매핑된 메모리를 가리킴)
+    std::string_view GetString(uint32_t index) const;
+
+    // 상태 구조체로 변환 (JSON 저장과 RestoreState에 사용)
+    void ToState(InteriorDesign::InteriorState& state) const;
+
+private:
+    struct SectionEntry
+    {
+        uint64_t Offset;
+        uint64_t Size;
+    };
+
+    struct FileHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t HeaderSize;
+        uint32_t ModelCount;
+        uint32_t LightCount;
+        uint32_t StringCount;
+        uint32_t VersionString;
+        uint32_t CreatedAtString;
+        uint32_t DescriptionString;
+        uint32_t Reserved;
+        uint64_t FileSize;
+        SectionEntry Sections[SectionCount];
+    };
+
+    bool Validate() const;
+
+    template <typename T>
+    const T* GetSection(Section section) const
+    {
+        return reinterpret_cast<const T*>(file.GetData() + header->Sections[section].Offset);
+    }
+
+    MappedFile file;
+    const FileHeader* header = nullptr;
+};
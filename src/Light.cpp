@@ -36,6 +36,7 @@ Light::Light(LightType type)
 void Light::SetPosition(float x, float y, float z)
 {
     position = XMFLOAT3(x, y, z);
+    version++;
 }
 
 void Light::SetDirection(float x, float y, float z)
@@ -43,32 +44,38 @@ void Light::SetDirection(float x, float y, float z)
     // 정규화된 방향 벡터 저장
     XMVECTOR dir = XMVector3Normalize(XMVectorSet(x, y, z, 0.0f));
     XMStoreFloat3(&direction, dir);
+    version++;
 }
 
 void Light::SetColor(float r, float g, float b)
 {
     color = XMFLOAT3(r, g, b);
+    version++;
 }
 
 void Light::SetIntensity(float value)
 {
     intensity = value;
+    version++;
 }
 
 void Light::SetRange(float value)
 {
     range = value;
+    version++;
 }
 
 void Light::SetAttenuation(float value)
 {
     attenuation = value;
+    version++;
 }
 
 void Light::SetSpotAngles(float innerAngle, float outerAngle)
 {
     spotInnerAngle = innerAngle;
     spotOuterAngle = outerAngle;
+    version++;
 }
 
 // 게터 함수들
@@ -144,10 +151,12 @@ void Light::RenderUI(int lightIndex)
     // 조명 타입 선택
     const char *lightTypeNames[] = {"방향성 조명", "점 조명", "스포트라이트"};
     int currentType = static_cast<int>(type);
+    bool changed = false;
 
     if (ImGui::Combo(("조명 유형" + id).c_str(), &currentType, lightTypeNames, IM_ARRAYSIZE(lightTypeNames)))
     {
         type = static_cast<LightType>(currentType);
+        changed = true;
     }
 
     // 색상 및 강도
@@ -155,9 +164,10 @@ void Light::RenderUI(int lightIndex)
     if (ImGui::ColorEdit3(("색상" + id).c_str(), colorArray))
     {
         color = XMFLOAT3(colorArray[0], colorArray[1], colorArray[2]);
+        changed = true;
     }
 
-    ImGui::SliderFloat(("강도" + id).c_str(), &intensity, 0.0f, 5.0f, "%.2f");
+    changed |= ImGui::SliderFloat(("강도" + id).c_str(), &intensity, 0.0f, 5.0f, "%.2f");
 
     // 조명 타입별 속성
     if (type != LIGHT_DIRECTIONAL)
@@ -167,11 +177,12 @@ void Light::RenderUI(int lightIndex)
         if (ImGui::DragFloat3(("위치" + id).c_str(), pos, 0.1f))
         {
             position = XMFLOAT3(pos[0], pos[1], pos[2]);
+            changed = true;
         }
 
         // 점 조명 및 스포트라이트의 범위
-        ImGui::SliderFloat(("범위" + id).c_str(), &range, 1.0f, 50.0f, "%.1f");
-        ImGui::SliderFloat(("감쇠" + id).c_str(), &attenuation, 0.0f, 2.0f, "%.2f");
+        changed |= ImGui::SliderFloat(("범위" + id).c_str(), &range, 1.0f, 50.0f, "%.1f");
+        changed |= ImGui::SliderFloat(("감쇠" + id).c_str(), &attenuation, 0.0f, 2.0f, "%.2f");
     }
 
     if (type == LIGHT_DIRECTIONAL || type == LIGHT_SPOT)
@@ -200,6 +211,7 @@ void Light::RenderUI(int lightIndex)
                 spotOuterAngle = spotInnerAngle;
                 outerAngleDegrees = innerAngleDegrees;
             }
+            changed = true;
         }
 
         if (ImGui::SliderFloat(("외각(도)" + id).c_str(), &outerAngleDegrees, 1.0f, 90.0f, "%.1f°"))
@@ -210,8 +222,15 @@ void Light::RenderUI(int lightIndex)
             {
                 spotInnerAngle = spotOuterAngle;
             }
+            changed = true;
         }
     }
 
+    // UI에서 직접 바꾼 값도 상수 버퍼에 반영되도록 버전 증가
+    if (changed)
+    {
+        version++;
+    }
+
     ImGui::PopID();
 }
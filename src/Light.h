@@ -1,6 +1,7 @@
 #pragma once
 #include <directxmath.h>
 #include <d3d11.h>
+#include <cstdint>
 
 using namespace DirectX;
 
@@ -46,6 +47,9 @@ public:
     // 조명 데이터 얻기
     LightData GetLightData() const;
 
+    // 속성이 바뀔 때마다 증가 (조명 상수 버퍼를 다시 올릴지 판단용)
+    uint64_t GetVersion() const { return version; }
+
     // UI 렌더링
     void RenderUI(int lightIndex);
 
@@ -59,4 +63,5 @@ private:
     float attenuation;
     float spotInnerAngle;
     float spotOuterAngle;
+    uint64_t version = 0;
 };
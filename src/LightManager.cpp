@@ -23,7 +23,11 @@ void LightManager::Release() {
         lightConstantBuffer = nullptr;
     }
 
+    for (const auto& light : lights) {
+        listVersion += light->GetVersion() + 1;
+    }
     lights.clear();
+    uploadedVersion = 0;
 }
 
 int LightManager::AddLight(LightType type) {
@@ -34,12 +38,14 @@ int LightManager::AddLight(LightType type) {
 
     auto light = std::make_shared<Light>(type);
     lights.push_back(light);
+    listVersion++;
 
     return static_cast<int>(lights.size() - 1);
 }
 
 void LightManager::RemoveLight(int index) {
     if (index >= 0 && index < lights.size()) {
+        listVersion += lights[index]->GetVersion() + 1;
         lights.erase(lights.begin() + index);
     }
 }
@@ -55,6 +61,14 @@ int LightManager::GetLightCount() const {
     return static_cast<int>(lights.size());
 }
 
+uint64_t LightManager::GetVersion() const {
+    uint64_t version = listVersion;
+    for (const auto& light : lights) {
+        version += light->GetVersion();
+    }
+    return version;
+}
+
 bool LightManager::CreateLightBuffer(ID3D11Device* device) {
     // 상수 버퍼 설명 설정
     D3D11_BUFFER_DESC bufferDesc;
@@ -74,6 +88,13 @@ bool LightManager::CreateLightBuffer(ID3D11Device* device) {
 }
 
 void LightManager::UpdateLightBuffer(ID3D11DeviceContext* deviceContext) {
+    // 마지막으로 올린 뒤 바뀐 조명이 없으면 그대로 사용
+    uint64_t version = GetVersion();
+    if (!lightConstantBuffer || version == uploadedVersion) {
+        skippedUploadCount++;
+        return;
+    }
+
     // 조명 데이터 준비
     LightBufferType lightBuffer;
     ZeroMemory(&lightBuffer, sizeof(LightBufferType));
@@ -91,6 +112,8 @@ void LightManager::UpdateLightBuffer(ID3D11DeviceContext* deviceContext) {
         // 데이터 복사
         memcpy(mappedResource.pData, &lightBuffer, sizeof(LightBufferType));
         deviceContext->Unmap(lightConstantBuffer, 0);
+        uploadedVersion = version;
+        uploadCount++;
     }
 }
 
@@ -28,10 +28,18 @@ public:
     Light* GetLight(int index);
     int GetLightCount() const;
 
-    // 조명 상수 버퍼 업데이트 및 설정
+    // 조명 상수 버퍼 업데이트 및 설정 - 프레임마다 한 번 호출
+    // 마지막으로 올린 뒤 조명이 바뀐 경우(버전이 다른 경우)만 다시 채워서 올림
     void UpdateLightBuffer(ID3D11DeviceContext* deviceContext);
     void SetLightBuffer(ID3D11DeviceContext* deviceContext);
 
+    // 조명 목록과 조명 속성의 버전 (조명을 추가/제거하거나 속성을 바꾸면 커짐)
+    uint64_t GetVersion() const;
+
+    // 상수 버퍼를 실제로 올린 횟수와 바뀐 게 없어 건너뛴 횟수 (통계 표시용)
+    uint64_t GetUploadCount() const { return uploadCount; }
+    uint64_t GetSkippedUploadCount() const { return skippedUploadCount; }
+
     // UI 렌더링
     void RenderUI();
 
@@ -39,6 +47,13 @@ private:
     std::vector<std::shared_ptr<Light>> lights;
     ID3D11Buffer* lightConstantBuffer;
 
+    // 조명 버전은 늘어나기만 하므로 조명 버전의 합 + listVersion은 바뀔 때마다 커짐
+    // 제거한 조명의 버전은 listVersion에 더해 두어 합이 줄지 않게 함
+    uint64_t listVersion = 1;
+    uint64_t uploadedVersion = 0; // 0은 아직 올리지 않음
+    uint64_t uploadCount = 0;
+    uint64_t skippedUploadCount = 0;
+
     // 상수 버퍼 생성
     bool CreateLightBuffer(ID3D11Device* device);
 };
@@ -0,0 +1,86 @@
+#include "MappedFile.h"
+
+MappedFile::MappedFile()
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string& filePath)
+{
+    Close();
+
+    fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        OutputDebugStringA(("Failed to open file for mapping: " + filePath + "\n").c_str());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        Close();
+        return false;
+    }
+
+    FILETIME writeTime;
+    if (GetFileTime(fileHandle, nullptr, nullptr, &writeTime))
+    {
+        lastWriteTime = (static_cast<unsigned long long>(writeTime.dwHighDateTime) << 32) | writeTime.dwLowDateTime;
+    }
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+
+    // 크기가 0인 파일은 매핑할 수 없으므로 빈 데이터로 처리
+    if (size == 0)
+    {
+        return true;
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        OutputDebugStringA(("Failed to create file mapping: " + filePath + "\n").c_str());
+        Close();
+        return false;
+    }
+
+    data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!data)
+    {
+        OutputDebugStringA(("Failed to map view of file: " + filePath + "\n").c_str());
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data)
+    {
+        UnmapViewOfFile(data);
+        data = nullptr;
+    }
+
+    if (mappingHandle)
+    {
+        CloseHandle(mappingHandle);
+        mappingHandle = nullptr;
+    }
+
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(fileHandle);
+        fileHandle = INVALID_HANDLE_VALUE;
+    }
+
+    size = 0;
+    lastWriteTime = 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <windows.h>
+#include <string>
+
+// 읽기 전용 메모리 매핑 파일
+// 파일 내용을 복사하지 않고 주소 공간에 직접 매핑해서 사용
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 파일 열기 및 매핑 (빈 파일은 성공, 크기 0)
+    bool Open(const std::string& filePath);
+
+    // 매핑 해제 및 핸들 닫기
+    void Close();
+
+    // 매핑된 데이터 접근
+    const char* GetData() const { return data; }
+    size_t GetSize() const { return size; }
+    bool IsOpen() const { return fileHandle != INVALID_HANDLE_VALUE; }
+
+    // 파일 마지막 수정 시간 (FILETIME 64비트 값)
+    unsigned long long GetLastWriteTime() const { return lastWriteTime; }
+
+private:
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+    const char* data = nullptr;
+    size_t size = 0;
+    unsigned long long lastWriteTime = 0;
+};
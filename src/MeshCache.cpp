@@ -0,0 +1,434 @@
+#include "MeshCache.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    // 캐시 파일 헤더
+    struct EntryHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t AssetType;
+        uint32_t PathLength;
+        uint64_t SourceSize;
+        uint64_t SourceWriteTime;
+        uint64_t ContentHash;
+        uint64_t PayloadSize;
+    };
+
+    const uint32_t entryMagic = 0x4548434D; // "MCHE"
+    const char* entryExtension = ".mcache";
+
+    // xxHash64 상수
+    const uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    const uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    const uint64_t prime3 = 0x165667B19E3779F9ull;
+    const uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+    const uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+    inline uint64_t RotateLeft(uint64_t value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    inline uint64_t Load64(const unsigned char* p)
+    {
+        uint64_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t Load32(const unsigned char* p)
+    {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t Round(uint64_t accumulator, uint64_t input)
+    {
+        accumulator += input * prime2;
+        accumulator = RotateLeft(accumulator, 31);
+        return accumulator * prime1;
+    }
+
+    inline uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+    {
+        accumulator ^= Round(0, value);
+        return accumulator * prime1 + prime4;
+    }
+
+    // 경로 대소문자 및 구분자 정규화 (Windows 경로는 대소문자 구분 없음)
+    std::string CanonicalizePath(const std::string& path)
+    {
+        std::error_code error;
+        std::filesystem::path canonical = std::filesystem::weakly_canonical(std::filesystem::path(path), error);
+        std::string result = error ? path : canonical.string();
+        std::replace(result.begin(), result.end(), '/', '\\');
+        std::transform(result.begin(), result.end(), result.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return result;
+    }
+}
+
+MeshCache::MeshCache()
+{
+}
+
+void MeshCache::Initialize(const std::string& cacheDirectory, uint64_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(fileMutex);
+
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+    if (error)
+    {
+        OutputDebugStringA(("Failed to create mesh cache directory: " + cacheDirectory + "\n").c_str());
+        directory.clear();
+        return;
+    }
+
+    directory = cacheDirectory;
+    if (!directory.empty() && directory.back() != '\\' && directory.back() != '/')
+    {
+        directory += '\\';
+    }
+    this->maxBytes = maxBytes;
+
+    // 기존 캐시 크기 확인 및 용량 정리
+    EvictIfNeeded();
+}
+
+bool MeshCache::MakeKey(const std::string& sourcePath, SourceKey& key)
+{
+    key = SourceKey();
+    return CompleteKey(sourcePath, key);
+}
+
+bool MeshCache::MakeStampKey(const std::string& sourcePath, SourceKey& key)
+{
+    key = SourceKey();
+    if (!GetFileStamp(sourcePath, key.Size, key.WriteTime))
+    {
+        return false;
+    }
+
+    key.CanonicalPath = CanonicalizePath(sourcePath);
+    return true;
+}
+
+bool MeshCache::CompleteKey(const std::string& sourcePath, SourceKey& key)
+{
+    MappedFile file;
+    if (!file.Open(sourcePath))
+    {
+        return false;
+    }
+
+    if (key.CanonicalPath.empty())
+    {
+        key.CanonicalPath = CanonicalizePath(sourcePath);
+    }
+    else if (key.Size != file.GetSize() || key.WriteTime != file.GetLastWriteTime())
+    {
+        // 에셋을 등록한 뒤 파일이 바뀜 - 캐시는 지금 읽는 내용 기준으로 조회
+        OutputDebugStringA(("Source changed since it was registered: " + sourcePath + "\n").c_str());
+    }
+
+    key.Size = file.GetSize();
+    key.WriteTime = file.GetLastWriteTime();
+    key.ContentHash = HashBytes(file.GetData(), file.GetSize());
+    return true;
+}
+
+bool MeshCache::Lookup(const SourceKey& key, uint32_t assetType, MappedFile& file, Reader& payload)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    std::string entryPath = GetEntryPath(key, assetType);
+
+    std::error_code error;
+    if (!std::filesystem::exists(entryPath, error))
+    {
+        return false;
+    }
+
+    // LRU 정리를 위해 사용 시각 갱신
+    std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), error);
+
+    if (!file.Open(entryPath) || file.GetSize() < sizeof(EntryHeader))
+    {
+        file.Close();
+        return false;
+    }
+
+    EntryHeader header;
+    memcpy(&header, file.GetData(), sizeof(header));
+
+    // 헤더 검증 - 버전, 원본 크기/수정 시간/내용 해시가 모두 일치해야 유효
+    bool valid = header.Magic == entryMagic &&
+        header.Version == FormatVersion &&
+        header.AssetType == assetType &&
+        header.SourceSize == key.Size &&
+        header.SourceWriteTime == key.WriteTime &&
+        header.ContentHash == key.ContentHash &&
+        header.PathLength == key.CanonicalPath.size() &&
+        sizeof(EntryHeader) + header.PathLength + header.PayloadSize == file.GetSize();
+
+    if (valid)
+    {
+        // 해시 충돌 방지를 위해 경로도 비교
+        valid = memcmp(file.GetData() + sizeof(EntryHeader), key.CanonicalPath.data(), header.PathLength) == 0;
+    }
+
+    if (!valid)
+    {
+        file.Close();
+        return false;
+    }
+
+    payload = Reader(file.GetData() + sizeof(EntryHeader) + header.PathLength, static_cast<size_t>(header.PayloadSize));
+    return true;
+}
+
+bool MeshCache::Store(const SourceKey& key, uint32_t assetType, const Writer& payload)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+
+    std::string entryPath = GetEntryPath(key, assetType);
+    std::string tempPath = entryPath + ".tmp";
+
+    EntryHeader header;
+    header.Magic = entryMagic;
+    header.Version = FormatVersion;
+    header.AssetType = assetType;
+    header.PathLength = static_cast<uint32_t>(key.CanonicalPath.size());
+    header.SourceSize = key.Size;
+    header.SourceWriteTime = key.WriteTime;
+    header.ContentHash = key.ContentHash;
+    header.PayloadSize = payload.GetBuffer().size();
+
+    // 임시 파일에 쓴 뒤 교체 (쓰기 도중 종료되어도 손상된 항목이 남지 않도록)
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(key.CanonicalPath.data(), key.CanonicalPath.size());
+        out.write(payload.GetBuffer().data(), payload.GetBuffer().size());
+        if (!out.good())
+        {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, entryPath, error);
+    if (error)
+    {
+        // 다른 스레드가 같은 항목을 읽는 중이면 교체 실패 - 다음 저장 때 다시 시도
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    writes++;
+    EvictIfNeeded();
+    return true;
+}
+
+void MeshCache::Remove(const SourceKey& key)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+
+    std::error_code error;
+    std::filesystem::remove(GetEntryPath(key, MeshCache::AssetObj), error);
+    std::filesystem::remove(GetEntryPath(key, MeshCache::AssetGlb), error);
+}
+
+MeshCache::Stats MeshCache::GetStats() const
+{
+    Stats stats;
+    stats.Hits = hits;
+    stats.Misses = misses;
+    stats.Writes = writes;
+    stats.Evictions = evictions;
+    stats.BytesOnDisk = bytesOnDisk;
+    stats.MaxBytes = maxBytes;
+    return stats;
+}
+
+bool MeshCache::GetFileStamp(const std::string& path, uint64_t& size, uint64_t& writeTime)
+{
+    size = 0;
+    writeTime = 0;
+
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+    {
+        return false;
+    }
+
+    size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    writeTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
+std::string MeshCache::GetEntryPath(const SourceKey& key, uint32_t assetType) const
+{
+    // 경로 해시와 에셋 종류로 파일 이름 결정 (원본 하나당 항목 하나)
+    uint64_t pathHash = HashBytes(key.CanonicalPath.data(), key.CanonicalPath.size(), assetType);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(pathHash));
+    return directory + name + entryExtension;
+}
+
+void MeshCache::EvictIfNeeded()
+{
+    struct EntryInfo
+    {
+        std::filesystem::path Path;
+        std::filesystem::file_time_type LastUsed;
+        uint64_t Size;
+    };
+
+    std::vector<EntryInfo> entries;
+    uint64_t totalBytes = 0;
+
+    std::error_code error;
+    for (std::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+    {
+        if (it->path().extension() != entryExtension)
+        {
+            continue;
+        }
+
+        EntryInfo info;
+        info.Path = it->path();
+        info.LastUsed = std::filesystem::last_write_time(info.Path, error);
+        info.Size = std::filesystem::file_size(info.Path, error);
+        if (error)
+        {
+            error.clear();
+            continue;
+        }
+
+        totalBytes += info.Size;
+        entries.push_back(info);
+    }
+
+    // 가장 오래 사용하지 않은 항목부터 제거
+    if (maxBytes > 0 && totalBytes > maxBytes)
+    {
+        std::sort(entries.begin(), entries.end(),
+            [](const EntryInfo& a, const EntryInfo& b) { return a.LastUsed < b.LastUsed; });
+
+        for (const auto& entry : entries)
+        {
+            if (totalBytes <= maxBytes)
+            {
+                break;
+            }
+
+            // 다른 스레드가 매핑 중인 항목은 제거에 실패하므로 건너뜀
+            if (std::filesystem::remove(entry.Path, error))
+            {
+                totalBytes -= entry.Size;
+                evictions++;
+            }
+            error.clear();
+        }
+    }
+
+    bytesOnDisk = totalBytes;
+}
+
+uint64_t MeshCache::HashBytes(const void* data, size_t size, uint64_t seed)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + size;
+    uint64_t hash;
+
+    if (size >= 32)
+    {
+        // 32바이트 블록을 4개의 누산기로 처리
+        const unsigned char* limit = end - 32;
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+
+        do
+        {
+            v1 = Round(v1, Load64(p)); p += 8;
+            v2 = Round(v2, Load64(p)); p += 8;
+            v3 = Round(v3, Load64(p)); p += 8;
+            v4 = Round(v4, Load64(p)); p += 8;
+        } while (p <= limit);
+
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + prime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    // 남은 바이트 처리
+    while (p + 8 <= end)
+    {
+        hash ^= Round(0, Load64(p));
+        hash = RotateLeft(hash, 27) * prime1 + prime4;
+        p += 8;
+    }
+
+    if (p + 4 <= end)
+    {
+        hash ^= static_cast<uint64_t>(Load32(p)) * prime1;
+        hash = RotateLeft(hash, 23) * prime2 + prime3;
+        p += 4;
+    }
+
+    while (p < end)
+    {
+        hash ^= static_cast<uint64_t>(*p) * prime5;
+        hash = RotateLeft(hash, 11) * prime1;
+        p++;
+    }
+
+    // 최종 혼합
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
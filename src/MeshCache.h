@@ -0,0 +1,186 @@
+#pragma once
+#include "MappedFile.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// 가져온 모델의 CPU 처리 결과를 디스크에 저장하는 바이너리 캐시
+// 원본 경로 + 크기 + 수정 시간 + 내용 해시로 식별하며, 읽을 때는 메모리 매핑을 사용한다
+class MeshCache
+{
+public:
+    // 캐시 포맷 버전 - 저장 레이아웃이 바뀌면 올려서 이전 캐시를 무효화
+    static const uint32_t FormatVersion = 5;
+
+    // 에셋 종류 태그
+    static const uint32_t AssetObj = 0x204A424F; // "OBJ "
+    static const uint32_t AssetGlb = 0x20424C47; // "GLB "
+
+    // 원본 파일 식별 정보
+    struct SourceKey
+    {
+        std::string CanonicalPath;
+        uint64_t Size = 0;
+        uint64_t WriteTime = 0;
+        uint64_t ContentHash = 0;
+    };
+
+    // 캐시 통계
+    struct Stats
+    {
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;
+        uint64_t Writes = 0;
+        uint64_t Evictions = 0;
+        uint64_t BytesOnDisk = 0;
+        uint64_t MaxBytes = 0;
+    };
+
+    // 캐시 데이터 직렬화 도우미
+    class Writer
+    {
+    public:
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Write requires a trivially copyable type");
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        void WriteVector(const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "WriteVector requires a trivially copyable type");
+            Write(static_cast<uint64_t>(values.size()));
+            const char* bytes = reinterpret_cast<const char*>(values.data());
+            buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(T));
+        }
+
+        void WriteString(const std::string& value)
+        {
+            Write(static_cast<uint64_t>(value.size()));
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        const std::vector<char>& GetBuffer() const { return buffer; }
+
+    private:
+        std::vector<char> buffer;
+    };
+
+    // 캐시 데이터 역직렬화 도우미 - 범위를 벗어나면 false 반환
+    class Reader
+    {
+    public:
+        Reader() = default;
+        Reader(const char* data, size_t size) : cursor(data), end(data + size) {}
+
+        template <typename T>
+        bool Read(T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Read requires a trivially copyable type");
+            if (static_cast<size_t>(end - cursor) < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+
+        template <typename T>
+        bool ReadVector(std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "ReadVector requires a trivially copyable type");
+            uint64_t count = 0;
+            if (!Read(count) || count > static_cast<uint64_t>(end - cursor) / sizeof(T))
+            {
+                return false;
+            }
+            values.resize(static_cast<size_t>(count));
+            memcpy(values.data(), cursor, static_cast<size_t>(count) * sizeof(T));
+            cursor += static_cast<size_t>(count) * sizeof(T);
+            return true;
+        }
+
+        // 요소 개수 읽기 - 남은 데이터보다 많으면 손상된 것으로 판단
+        bool ReadCount(uint64_t& count)
+        {
+            return Read(count) && count <= static_cast<uint64_t>(end - cursor);
+        }
+
+        bool ReadString(std::string& value)
+        {
+            uint64_t length = 0;
+            if (!Read(length) || length > static_cast<uint64_t>(end - cursor))
+            {
+                return false;
+            }
+            value.assign(cursor, static_cast<size_t>(length));
+            cursor += static_cast<size_t>(length);
+            return true;
+        }
+
+    private:
+        const char* cursor = nullptr;
+        const char* end = nullptr;
+    };
+
+    MeshCache();
+
+    // 캐시 디렉토리와 최대 용량 설정
+    void Initialize(const std::string& cacheDirectory, uint64_t maxBytes);
+
+    // 원본 파일의 캐시 키 계산 (파일을 매핑해서 내용 해시 계산)
+    static bool MakeKey(const std::string& sourcePath, SourceKey& key);
+
+    // 파일을 읽지 않고 정규화된 경로 + 크기 + 수정 시간만으로 키 계산 (내용 해시는 0, UI 스레드의 에셋 식별용)
+    static bool MakeStampKey(const std::string& sourcePath, SourceKey& key);
+
+    // MakeStampKey로 만든 키에 내용 해시를 채움 (작업자 스레드에서 호출, 파일은 한 번만 매핑해서 해시)
+    // 그 사이에 파일이 바뀌었으면 크기와 수정 시간도 지금 읽은 파일 기준으로 갱신하고, 경로가 비어 있으면 새로 계산
+    static bool CompleteKey(const std::string& sourcePath, SourceKey& key);
+
+    // 캐시 항목 조회 - 성공하면 file이 매핑 상태로 유지되고 payload가 그 내용을 가리킴
+    bool Lookup(const SourceKey& key, uint32_t assetType, MappedFile& file, Reader& payload);
+
+    // 캐시 항목 저장 후 용량 초과 시 오래된 항목 제거
+    bool Store(const SourceKey& key, uint32_t assetType, const Writer& payload);
+
+    // 조회 결과 기록 (호출 측에서 역직렬화까지 성공했을 때 적중으로 기록)
+    void RecordHit() { hits++; }
+    void RecordMiss() { misses++; }
+
+    // 사용할 수 없는 항목 제거
+    void Remove(const SourceKey& key);
+
+    Stats GetStats() const;
+    bool IsEnabled() const { return !directory.empty(); }
+
+    // 의존 파일(MTL 등) 변경 확인용 크기와 수정 시간 조회 - 없으면 0
+    static bool GetFileStamp(const std::string& path, uint64_t& size, uint64_t& writeTime);
+
+    // 64비트 내용 해시 (xxHash64 방식)
+    static uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+private:
+    std::string GetEntryPath(const SourceKey& key, uint32_t assetType) const;
+    void EvictIfNeeded();
+
+    std::string directory;
+    uint64_t maxBytes = 0;
+
+    std::atomic<uint64_t> hits{ 0 };
+    std::atomic<uint64_t> misses{ 0 };
+    std::atomic<uint64_t> writes{ 0 };
+    std::atomic<uint64_t> evictions{ 0 };
+    std::atomic<uint64_t> bytesOnDisk{ 0 };
+
+    // 파일 저장 및 제거 동기화
+    mutable std::mutex fileMutex;
+};
@@ -1,19 +1,19 @@
 #include "Model.h"
 #include "Camera.h"
+#include "ObjParser.h"
+#include <chrono>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <unordered_map>
 #include <d3dcompiler.h>
 #include <DirectXTex.h>
 #include "WICTextureLoader11.h"  // DirectXTex의 텍스처 로더
 
-// 상수 버퍼 구조체 
-struct ConstantBuffer
+// 재질별 상수 버퍼 구조체 (b3) - 뷰/투영은 프레임별(b2), 월드와 인스턴스 덮어쓰기는 오브젝트별(b0) 버퍼
+struct ObjMaterialConstants
 {
-    XMMATRIX World;
-    XMMATRIX View;
-    XMMATRIX Projection;
     XMFLOAT4 AmbientColor;
     XMFLOAT4 DiffuseColor;
     XMFLOAT4 SpecularColor;
@@ -21,17 +21,50 @@ struct ConstantBuffer
     float HasTexture;
     XMFLOAT2 Padding;
 };
+// 버텍스 용접용 인덱스 조합 해시
+struct CornerHash
+{
+    size_t operator()(const ObjParser::Corner& corner) const
+    {
+        uint64_t hash = static_cast<uint32_t>(corner.Position);
+        hash = hash * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(corner.TexCoord);
+        hash = hash * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(corner.Normal);
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+};
+
+struct CornerEqual
+{
+    bool operator()(const ObjParser::Corner& a, const ObjParser::Corner& b) const
+    {
+        return a.Position == b.Position && a.TexCoord == b.TexCoord && a.Normal == b.Normal;
+    }
+};
+
 // 조명을 지원하는 업데이트된 픽셀 셰이더
 const char* pixelShaderCode = R"(
 Texture2D diffuseTexture : register(t0);
 SamplerState samLinear : register(s0);
 
-// 모델용 상수 버퍼 (b0)
-cbuffer ModelConstantBuffer : register(b0)
+// 오브젝트별 상수 버퍼 (b0)
+cbuffer ObjectConstantBuffer : register(b0)
 {
     matrix World;
+    float4 OverrideTint;
+    float4 OverrideHighlight;
+}
+
+// 프레임별 상수 버퍼 (b2)
+cbuffer FrameConstantBuffer : register(b2)
+{
     matrix View;
     matrix Projection;
+    float4 CameraPosition;
+}
+
+// 재질별 상수 버퍼 (b3)
+cbuffer MaterialConstantBuffer : register(b3)
+{
     float4 AmbientColor;
     float4 DiffuseColor;
     float4 SpecularColor;
@@ -150,10 +183,10 @@ float4 main(PS_INPUT input) : SV_Target
     
     // 정규화
     float3 normal = normalize(input.Normal);
-    float3 viewDir = normalize(float3(0.0, 0.0, -5.0) - input.WorldPos);
+    float3 viewDir = normalize(CameraPosition.xyz - input.WorldPos);
     
     // 최종 조명 계산
-    float3 result = AmbientColor.rgb; // 앰비언트 조명 시작점
+    float3 result = AmbientColor.rgb * OverrideHighlight.a; // 앰비언트 조명 시작점
     
     // 사용 가능한 모든 조명 처리
     for (int i = 0; i < LightCount; i++)
@@ -174,8 +207,9 @@ float4 main(PS_INPUT input) : SV_Target
         }
     }
     
-    // 최종 색상 계산
-    float4 finalColor = float4(result, 1.0) * texColor;
+    // 최종 색상 계산 (인스턴스 색상 배율과 강조 색 적용)
+    float4 finalColor = float4(result * OverrideTint.rgb, OverrideTint.a) * texColor;
+    finalColor.rgb += OverrideHighlight.rgb;
     
     // HDR 톤 매핑: 간단한 햅번 오퍼레이터
     finalColor.rgb = finalColor.rgb / (finalColor.rgb + float3(1.0, 1.0, 1.0));
@@ -186,17 +220,18 @@ float4 main(PS_INPUT input) : SV_Target
 
 // 조명을 지원하는 업데이트된 버텍스 셰이더
 const char* vertexShaderCode = R"(
-cbuffer ConstantBuffer : register(b0)
+cbuffer ObjectConstantBuffer : register(b0)
 {
     matrix World;
+    float4 OverrideTint;
+    float4 OverrideHighlight;
+}
+
+cbuffer FrameConstantBuffer : register(b2)
+{
     matrix View;
     matrix Projection;
-    float4 AmbientColor;
-    float4 DiffuseColor;
-    float4 SpecularColor;
-    float Shininess;
-    float HasTexture;
-    float2 Padding;
+    float4 CameraPosition;
 }
 
 struct VS_INPUT
@@ -246,264 +281,295 @@ Model::~Model()
     Release();
 }
 
-bool Model::LoadObjModel(const std::string& filename, ID3D11Device* device)
+bool Model::LoadObjModel(const std::string& filename, ID3D11Device* device, MeshCache* meshCache,
+    const MeshCache::SourceKey* sourceKey)
 {
-    // OBJ 파일에서 로드할 데이터
-    std::vector<XMFLOAT3> positions;
-    std::vector<XMFLOAT3> normals;
-    std::vector<XMFLOAT2> texCoords;
+    // 모델 정보 설정
+    modelInfo.Name = filename.substr(filename.find_last_of("/\\") + 1);
+    modelInfo.FilePath = filename;
+
+    // 메시 캐시 조회 - 원본이 바뀌지 않았으면 파싱을 건너뜀 (내용 해시는 이 작업에서 한 번만 계산)
+    MeshCache::SourceKey cacheKey;
+    if (sourceKey)
+    {
+        cacheKey = *sourceKey;
+    }
+    bool useCache = meshCache && meshCache->IsEnabled() && MeshCache::CompleteKey(filename, cacheKey);
+    bool loadedFromCache = false;
+
+    if (useCache)
+    {
+        MappedFile cacheFile;
+        MeshCache::Reader reader;
+        if (meshCache->Lookup(cacheKey, MeshCache::AssetObj, cacheFile, reader) && ReadCache(reader))
+        {
+            meshCache->RecordHit();
+            loadedFromCache = true;
+            if (importProgress)
+            {
+                importProgress->BeginPhase(ImportProgress::Phase::Read, cacheFile.GetSize());
+                importProgress->Advance(ImportProgress::Phase::Read, cacheFile.GetSize());
+            }
+            OutputDebugStringA(("OBJ loaded from mesh cache: " + filename + "\n").c_str());
+        }
+        else
+        {
+            // 일부만 읽힌 데이터 정리
+            meshes.clear();
+            materials.clear();
+            meshCache->RecordMiss();
+        }
+    }
+
+    if (!loadedFromCache)
+    {
+        if (!BuildFromObj(filename))
+        {
+            return false;
+        }
+
+        if (useCache)
+        {
+            MeshCache::Writer writer;
+            WriteCache(writer);
+            meshCache->Store(cacheKey, MeshCache::AssetObj, writer);
+        }
+    }
+
+    // 취소되었으면 GPU 리소스를 만들지 않고 처리한 데이터 해제
+    if (IsImportCancelled())
+    {
+        meshes.clear();
+        materials.clear();
+        return false;
+    }
 
-    std::map<std::string, std::vector<uint32_t>> materialIndices; // 재질별 인덱스
-    std::string currentMaterialName = "default";
+    // 피킹 BVH는 캐시에 저장하지 않고 로드할 때마다 메시에서 생성
+    BuildPickingBvhs();
 
+    return CreateDeviceResources(device);
+}
+
+bool Model::BuildFromObj(const std::string& filename)
+{
     // 기본 재질 추가
     Material defaultMaterial;
     defaultMaterial.Name = "default";
     materials[defaultMaterial.Name] = defaultMaterial;
 
-    // OBJ 파일 읽기
-    std::ifstream file(filename);
-    if (!file.is_open())
+    // OBJ 파일 파싱 (메모리 매핑 후 청크 단위 병렬 토큰화)
+    auto parseStart = std::chrono::high_resolution_clock::now();
+
+    ObjParser::Result objData;
+    if (!ObjParser::ParseFile(filename, objData))
     {
         std::cerr << "Failed to open OBJ file: " << filename << std::endl;
         return false;
     }
 
+    if (importProgress)
+    {
+        importProgress->BeginPhase(ImportProgress::Phase::Read, objData.FileBytes);
+        importProgress->Advance(ImportProgress::Phase::Read, objData.FileBytes);
+        importProgress->BeginPhase(ImportProgress::Phase::Process, objData.Groups.size());
+    }
+
+    double parseMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - parseStart).count();
+    double fileMB = objData.FileBytes / (1024.0 * 1024.0);
+    double throughput = parseMs > 0.0 ? fileMB / (parseMs / 1000.0) : 0.0;
+    OutputDebugStringA(("OBJ parsed: " + std::to_string(fileMB) + " MB in " + std::to_string(parseMs) +
+        " ms (" + std::to_string(throughput) + " MB/s, " + std::to_string(objData.ThreadCount) + " threads)\n").c_str());
+
+    std::vector<XMFLOAT3>& positions = objData.Positions;
+    const std::vector<XMFLOAT3>& normals = objData.Normals;
+    const std::vector<XMFLOAT2>& texCoords = objData.TexCoords;
+
     // 파일 경로에서 디렉토리 경로 추출
     std::string directory = GetDirectoryFromPath(filename);
     std::string mtlFilePath;
 
-    std::string line;
-    std::vector<uint32_t> posIndices, normalIndices, texCoordIndices;
-
-    while (std::getline(file, line))
+    if (!objData.MtlLib.empty())
     {
-        std::istringstream iss(line);
-        std::string token;
-        iss >> token;
+        mtlFilePath = directory + objData.MtlLib;
+        modelInfo.MtlFilePath = mtlFilePath;
+    }
 
-        if (token == "v") // 정점 위치
-        {
-            XMFLOAT3 position;
-            iss >> position.x >> position.y >> position.z;
-            positions.push_back(position);
-        }
-        else if (token == "vn") // 정점 법선
-        {
-            XMFLOAT3 normal;
-            iss >> normal.x >> normal.y >> normal.z;
-            normals.push_back(normal);
-        }
-        else if (token == "vt") // 텍스처 좌표
+    // usemtl로 지정된 재질이 없으면 기본 재질로 추가
+    for (const auto& group : objData.Groups)
+    {
+        if (materials.find(group.MaterialName) == materials.end())
         {
-            XMFLOAT2 texCoord;
-            iss >> texCoord.x >> texCoord.y;
-            texCoord.y = 1.0f - texCoord.y; // DirectX 좌표계로 변환
-            texCoords.push_back(texCoord);
+            Material newMaterial;
+            newMaterial.Name = group.MaterialName;
+            materials[group.MaterialName] = newMaterial;
         }
-        else if (token == "f") // 면
-        {
-            std::string faceVertex;
-            int vertexCount = 0;
-
-            std::vector<uint32_t> facePositions, faceTexCoords, faceNormals;
+    }
 
-            while (iss >> faceVertex)
-            {
-                vertexCount++;
+    // MTL 파일 로드 (텍스처는 디바이스 리소스 생성 단계에서 로드)
+    if (!mtlFilePath.empty())
+    {
+        LoadMaterialFromMTL(mtlFilePath, nullptr);
+    }
 
-                // '/'로 분리된 인덱스 처리
-                std::replace(faceVertex.begin(), faceVertex.end(), '/', ' ');
-                std::istringstream faceData(faceVertex);
+    // 모델의 바운딩 박스 계산 및 자동 크기 조정
+    // 버퍼를 한 번만 만들도록 메시 생성 전에 위치 데이터를 원점 기준으로 이동
+    if (!positions.empty())
+    {
+        BoundingBox positionBounds = BoundingVolumes::FromPositions(positions.data(), sizeof(XMFLOAT3), positions.size());
+        XMFLOAT3 minPos = positionBounds.min;
+        XMFLOAT3 maxPos = positionBounds.max;
 
-                uint32_t posIndex, texCoordIndex, normalIndex;
-                faceData >> posIndex;
+        // 모델 중심 계산
+        XMFLOAT3 center;
+        center.x = (minPos.x + maxPos.x) * 0.5f;
+        center.y = (minPos.y + maxPos.y) * 0.5f;
+        center.z = (minPos.z + maxPos.z) * 0.5f;
 
-                if (faceData.peek() != EOF) {
-                    faceData >> texCoordIndex;
-                }
-                else {
-                    texCoordIndex = 1; // 기본값
-                }
+        // 모델 크기 계산
+        float sizeX = maxPos.x - minPos.x;
+        float sizeY = maxPos.y - minPos.y;
+        float sizeZ = maxPos.z - minPos.z;
+        float maxSize = max(max(sizeX, sizeY), sizeZ);
 
-                if (faceData.peek() != EOF) {
-                    faceData >> normalIndex;
-                }
-                else {
-                    normalIndex = 1; // 기본값
-                }
+        // 모델 위치와 크기 조정 - 직접 중심에 배치하도록 수정
+        modelInfo.Position = XMFLOAT3(0.0f, 0.0f, 0.0f); // 원점에 배치
+        float scale = 2.0f / maxSize; // 적절한 크기로 조정
+        modelInfo.Scale = XMFLOAT3(scale, scale, scale);
 
-                // OBJ 인덱스는 1부터 시작하므로 0부터 시작하도록 조정
-                facePositions.push_back(posIndex - 1);
-                faceTexCoords.push_back(texCoordIndex - 1);
-                faceNormals.push_back(normalIndex - 1);
-            }
+        // 원점 기준 로컬 바운딩 박스
+        bounds.min = XMFLOAT3(minPos.x - center.x, minPos.y - center.y, minPos.z - center.z);
+        bounds.max = XMFLOAT3(maxPos.x - center.x, maxPos.y - center.y, maxPos.z - center.z);
+        bounds.center = XMFLOAT3(0.0f, 0.0f, 0.0f);
+        bounds.radius = sqrtf(sizeX * sizeX + sizeY * sizeY + sizeZ * sizeZ) * 0.5f;
 
-            // 면을 삼각형으로 분할 (삼각형화)
-            for (int i = 1; i < vertexCount - 1; i++)
-            {
-                // 첫 번째 정점
-                posIndices.push_back(facePositions[0]);
-                texCoordIndices.push_back(faceTexCoords[0]);
-                normalIndices.push_back(faceNormals[0]);
-                materialIndices[currentMaterialName].push_back(materialIndices[currentMaterialName].size());
-
-                // 두 번째 정점
-                posIndices.push_back(facePositions[i]);
-                texCoordIndices.push_back(faceTexCoords[i]);
-                normalIndices.push_back(faceNormals[i]);
-                materialIndices[currentMaterialName].push_back(materialIndices[currentMaterialName].size());
-
-                // 세 번째 정점
-                posIndices.push_back(facePositions[i + 1]);
-                texCoordIndices.push_back(faceTexCoords[i + 1]);
-                normalIndices.push_back(faceNormals[i + 1]);
-                materialIndices[currentMaterialName].push_back(materialIndices[currentMaterialName].size());
-            }
-        }
-        else if (token == "mtllib") // 재질 라이브러리
+        // 모델 데이터를 원점 기준으로 수정
+        for (auto& pos : positions)
         {
-            iss >> mtlFilePath;
-            mtlFilePath = directory + mtlFilePath;
-            modelInfo.MtlFilePath = mtlFilePath;
-        }
-        else if (token == "usemtl") // 재질 사용
-        {
-            iss >> currentMaterialName;
-
-            // 해당 재질이 없으면 기본 재질 사용
-            if (materials.find(currentMaterialName) == materials.end())
-            {
-                Material newMaterial;
-                newMaterial.Name = currentMaterialName;
-                materials[currentMaterialName] = newMaterial;
-            }
+            pos.x -= center.x;
+            pos.y -= center.y;
+            pos.z -= center.z;
         }
     }
 
-    file.close();
+    // 메시 생성 - (위치, 텍스처 좌표, 법선) 인덱스 조합이 같은 꼭짓점은 하나의 버텍스로 합침
+    importStats = ImportStats();
+    importStats.ParseMilliseconds = parseMs;
+    importStats.ParseThreadCount = objData.ThreadCount;
 
-    // texCoords나 normals가 없는 경우 기본값 추가
-    if (texCoords.empty()) {
-        texCoords.push_back(XMFLOAT2(0.0f, 0.0f));
-    }
-    if (normals.empty()) {
-        normals.push_back(XMFLOAT3(0.0f, 1.0f, 0.0f));
-    }
+    std::unordered_map<ObjParser::Corner, uint32_t, CornerHash, CornerEqual> vertexLookup;
 
-    // MTL 파일 로드
-    if (!mtlFilePath.empty())
+    for (auto& group : objData.Groups)
     {
-        LoadMaterialFromMTL(mtlFilePath, device);
-    }
+        // 취소되었으면 재질 그룹 단위로 멈춤
+        if (IsImportCancelled())
+        {
+            return false;
+        }
 
-    // 메시 생성
-    for (const auto& matPair : materialIndices)
-    {
         Mesh mesh;
-        mesh.MaterialName = matPair.first;
+        mesh.MaterialName = group.MaterialName;
 
         // 해당 재질의 인덱스 수 저장
-        mesh.IndexCount = static_cast<UINT>(matPair.second.size());
+        mesh.IndexCount = static_cast<UINT>(group.Corners.size());
+        mesh.Indices.reserve(group.Corners.size());
+
+        vertexLookup.clear();
+        vertexLookup.reserve(group.Corners.size() / 2);
 
         // 버텍스 및 인덱스 생성
-        for (size_t i = 0; i < matPair.second.size(); i++)
+        for (const ObjParser::Corner& corner : group.Corners)
         {
-            uint32_t idx = matPair.second[i];
+            auto inserted = vertexLookup.emplace(corner, static_cast<uint32_t>(mesh.Vertices.size()));
+            if (!inserted.second)
+            {
+                // 이미 만든 버텍스 재사용
+                mesh.Indices.push_back(inserted.first->second);
+                continue;
+            }
 
             Vertex vertex;
-            vertex.Position = positions[posIndices[idx]];
+
+            // 위치 (범위를 벗어나면 원점)
+            if (corner.Position >= 0 && static_cast<size_t>(corner.Position) < positions.size()) {
+                vertex.Position = positions[corner.Position];
+            }
+            else {
+                vertex.Position = XMFLOAT3(0.0f, 0.0f, 0.0f);
+            }
 
             // 텍스처 좌표 (있는 경우)
-            if (texCoordIndices[idx] < texCoords.size()) {
-                vertex.TexCoord = texCoords[texCoordIndices[idx]];
+            if (corner.TexCoord >= 0 && static_cast<size_t>(corner.TexCoord) < texCoords.size()) {
+                vertex.TexCoord = texCoords[corner.TexCoord];
             }
             else {
                 vertex.TexCoord = XMFLOAT2(0.0f, 0.0f);
             }
 
             // 법선 (있는 경우)
-            if (normalIndices[idx] < normals.size()) {
-                vertex.Normal = normals[normalIndices[idx]];
+            if (corner.Normal >= 0 && static_cast<size_t>(corner.Normal) < normals.size()) {
+                vertex.Normal = normals[corner.Normal];
             }
             else {
                 vertex.Normal = XMFLOAT3(0.0f, 1.0f, 0.0f);
             }
 
+            mesh.Indices.push_back(inserted.first->second);
             mesh.Vertices.push_back(vertex);
-            mesh.Indices.push_back(static_cast<uint32_t>(i));
         }
 
-        // 버퍼 생성
-        CreateBuffers(device, mesh);
-
-        // 메시 추가
-        meshes.push_back(mesh);
-    }
+        mesh.Vertices.shrink_to_fit();
 
-    // 모델 정보 설정
-    modelInfo.Name = filename.substr(filename.find_last_of("/\\") + 1);
-    modelInfo.FilePath = filename;
+        importStats.CornerCount += group.Corners.size();
+        importStats.VertexCount += mesh.Vertices.size();
 
-    // 모델의 바운딩 박스 계산 및 자동 크기 조정
-    if (!positions.empty())
-    {
-        XMFLOAT3 minPos = positions[0];
-        XMFLOAT3 maxPos = positions[0];
+        // 그룹의 꼭짓점 데이터는 더 이상 필요 없으므로 바로 해제
+        std::vector<ObjParser::Corner>().swap(group.Corners);
 
-        for (const auto& pos : positions)
+        // 메시 추가
+        meshes.push_back(std::move(mesh));
+        if (importProgress)
         {
-            minPos.x = min(minPos.x, pos.x);
-            minPos.y = min(minPos.y, pos.y);
-            minPos.z = min(minPos.z, pos.z);
-
-            maxPos.x = max(maxPos.x, pos.x);
-            maxPos.y = max(maxPos.y, pos.y);
-            maxPos.z = max(maxPos.z, pos.z);
+            importProgress->Advance(ImportProgress::Phase::Process);
         }
+    }
 
-        // 모델 중심 계산
-        XMFLOAT3 center;
-        center.x = (minPos.x + maxPos.x) * 0.5f;
-        center.y = (minPos.y + maxPos.y) * 0.5f;
-        center.z = (minPos.z + maxPos.z) * 0.5f;
+    // 가져오기 통계 - 용접 전(꼭짓점마다 버텍스)과 후의 버텍스/인덱스 크기 비교
+    importStats.UnweldedMeshBytes = importStats.CornerCount * (sizeof(Vertex) + sizeof(uint32_t));
+    importStats.WeldedMeshBytes = importStats.VertexCount * sizeof(Vertex) + importStats.CornerCount * sizeof(uint32_t);
+    importStats.ReductionRatio = importStats.CornerCount > 0 ?
+        static_cast<float>(importStats.VertexCount) / static_cast<float>(importStats.CornerCount) : 1.0f;
 
-        // 모델 크기 계산
-        float sizeX = maxPos.x - minPos.x;
-        float sizeY = maxPos.y - minPos.y;
-        float sizeZ = maxPos.z - minPos.z;
-        float maxSize = max(max(sizeX, sizeY), sizeZ);
+    OutputDebugStringA(("OBJ vertices: " + std::to_string(importStats.CornerCount) + " -> " +
+        std::to_string(importStats.VertexCount) + " (ratio " + std::to_string(importStats.ReductionRatio) + "), mesh data " +
+        std::to_string(importStats.UnweldedMeshBytes / 1024) + " KB -> " + std::to_string(importStats.WeldedMeshBytes / 1024) +
+        " KB (welded saves " + std::to_string((importStats.UnweldedMeshBytes - importStats.WeldedMeshBytes) / 1024) + " KB)\n").c_str());
 
-        // 모델 위치와 크기 조정 - 직접 중심에 배치하도록 수정
-        modelInfo.Position = XMFLOAT3(0.0f, 0.0f, 0.0f); // 원점에 배치
-        float scale = 2.0f / maxSize; // 적절한 크기로 조정
-        modelInfo.Scale = XMFLOAT3(scale, scale, scale);
+    return true;
+}
 
-        // 모델 데이터를 원점 기준으로 수정
-        for (auto& mesh : meshes)
+bool Model::CreateDeviceResources(ID3D11Device* device)
+{
+    // 재질 텍스처 로드
+    for (auto& matPair : materials)
+    {
+        Material& material = matPair.second;
+        if (!material.DiffuseMapPath.empty() && !material.DiffuseMap)
         {
-            for (auto& vertex : mesh.Vertices)
-            {
-                vertex.Position.x -= center.x;
-                vertex.Position.y -= center.y;
-                vertex.Position.z -= center.z;
-            }
-
-            // 버퍼 재생성
-            if (mesh.VertexBuffer)
-            {
-                mesh.VertexBuffer->Release();
-                mesh.VertexBuffer = nullptr;
-            }
-
-            if (mesh.IndexBuffer)
-            {
-                mesh.IndexBuffer->Release();
-                mesh.IndexBuffer = nullptr;
-            }
+            LoadTexture(material.DiffuseMapPath, device, &material.DiffuseMap);
+        }
+    }
 
-            // 버퍼 생성
-            CreateBuffers(device, mesh);
+    // 메시 버퍼 생성
+    if (importProgress)
+    {
+        importProgress->BeginPhase(ImportProgress::Phase::Upload, meshes.size());
+    }
+    for (auto& mesh : meshes)
+    {
+        CreateBuffers(device, mesh);
+        if (importProgress)
+        {
+            importProgress->Advance(ImportProgress::Phase::Upload);
         }
     }
 
@@ -538,12 +604,119 @@ bool Model::LoadObjModel(const std::string& filename, ID3D11Device* device)
         return false;
     }
 
-    OutputDebugStringA(("Model loaded: " + filename + "\n").c_str());
+    OutputDebugStringA(("Model loaded: " + modelInfo.FilePath + "\n").c_str());
     OutputDebugStringA(("Mesh count: " + std::to_string(meshes.size()) + "\n").c_str());
 
     return true;
 }
 
+void Model::WriteCache(MeshCache::Writer& writer) const
+{
+    // MTL 파일 의존성 (MTL이 바뀌면 캐시 무효)
+    uint64_t mtlSize = 0;
+    uint64_t mtlWriteTime = 0;
+    if (!modelInfo.MtlFilePath.empty())
+    {
+        MeshCache::GetFileStamp(modelInfo.MtlFilePath, mtlSize, mtlWriteTime);
+    }
+    writer.WriteString(modelInfo.MtlFilePath);
+    writer.Write(mtlSize);
+    writer.Write(mtlWriteTime);
+
+    // 자동 크기 조정 및 중심 맞춤 결과
+    writer.Write(modelInfo.Position);
+    writer.Write(modelInfo.Scale);
+    writer.Write(bounds);
+    writer.Write(importStats);
+
+    // 재질 테이블
+    writer.Write(static_cast<uint64_t>(materials.size()));
+    for (const auto& matPair : materials)
+    {
+        const Material& material = matPair.second;
+        writer.WriteString(material.Name);
+        writer.Write(material.Ambient);
+        writer.Write(material.Diffuse);
+        writer.Write(material.Specular);
+        writer.Write(material.Shininess);
+        writer.WriteString(material.DiffuseMapPath);
+    }
+
+    // 메시
+    writer.Write(static_cast<uint64_t>(meshes.size()));
+    for (const auto& mesh : meshes)
+    {
+        writer.WriteString(mesh.MaterialName);
+        writer.WriteVector(mesh.Vertices);
+        writer.WriteVector(mesh.Indices);
+    }
+}
+
+bool Model::ReadCache(MeshCache::Reader& reader)
+{
+    std::string mtlFilePath;
+    uint64_t mtlSize = 0;
+    uint64_t mtlWriteTime = 0;
+    if (!reader.ReadString(mtlFilePath) || !reader.Read(mtlSize) || !reader.Read(mtlWriteTime))
+    {
+        return false;
+    }
+
+    // MTL 파일이 바뀌었으면 캐시를 사용하지 않음
+    if (!mtlFilePath.empty())
+    {
+        uint64_t currentSize = 0;
+        uint64_t currentWriteTime = 0;
+        MeshCache::GetFileStamp(mtlFilePath, currentSize, currentWriteTime);
+        if (currentSize != mtlSize || currentWriteTime != mtlWriteTime)
+        {
+            return false;
+        }
+    }
+    modelInfo.MtlFilePath = mtlFilePath;
+
+    if (!reader.Read(modelInfo.Position) || !reader.Read(modelInfo.Scale) ||
+        !reader.Read(bounds) || !reader.Read(importStats))
+    {
+        return false;
+    }
+
+    uint64_t materialCount = 0;
+    if (!reader.ReadCount(materialCount))
+    {
+        return false;
+    }
+    for (uint64_t i = 0; i < materialCount; i++)
+    {
+        Material material;
+        if (!reader.ReadString(material.Name) || !reader.Read(material.Ambient) || !reader.Read(material.Diffuse) ||
+            !reader.Read(material.Specular) || !reader.Read(material.Shininess) || !reader.ReadString(material.DiffuseMapPath))
+        {
+            return false;
+        }
+        materials[material.Name] = material;
+    }
+
+    uint64_t meshCount = 0;
+    if (!reader.ReadCount(meshCount))
+    {
+        return false;
+    }
+    meshes.reserve(static_cast<size_t>(meshCount));
+    for (uint64_t i = 0; i < meshCount; i++)
+    {
+        Mesh mesh;
+        if (!reader.ReadString(mesh.MaterialName) || !reader.ReadVector(mesh.Vertices) || !reader.ReadVector(mesh.Indices))
+        {
+            return false;
+        }
+        mesh.IndexCount = static_cast<UINT>(mesh.Indices.size());
+        meshes.push_back(std::move(mesh));
+    }
+
+    return true;
+}
+
 bool Model::LoadMaterialFromMTL(const std::string& mtlFilePath, ID3D11Device* device)
 {
     std::ifstream file(mtlFilePath);
@@ -612,8 +785,11 @@ bool Model::LoadMaterialFromMTL(const std::string& mtlFilePath, ID3D11Device* de
                 texturePath = directory + texturePath;
                 materials[currentMaterialName].DiffuseMapPath = texturePath;
 
-                // 텍스처 로드
-                LoadTexture(texturePath, device, &materials[currentMaterialName].DiffuseMap);
+                // 텍스처 로드 (디바이스가 없으면 경로만 기록)
+                if (device)
+                {
+                    LoadTexture(texturePath, device, &materials[currentMaterialName].DiffuseMap);
+                }
             }
         }
     }
@@ -745,14 +921,8 @@ bool Model::CreateShaders(ID3D11Device* device)
         return false;
     }
 
-    // 상수 버퍼 생성
-    D3D11_BUFFER_DESC cbDesc;
-    ZeroMemory(&cbDesc, sizeof(cbDesc));
-    cbDesc.Usage = D3D11_USAGE_DEFAULT;
-    cbDesc.ByteWidth = sizeof(ConstantBuffer);
-    cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    hr = device->CreateBuffer(&cbDesc, nullptr, &constantBuffer);
-    if (FAILED(hr))
+    // 오브젝트별 상수 버퍼 생성 (재질 버퍼는 재질마다 처음 그릴 때 생성)
+    if (!ConstantBuffers::Create(device, sizeof(ObjectConstants), &constantBuffer))
     {
         return false;
     }
@@ -763,7 +933,13 @@ bool Model::CreateShaders(ID3D11Device* device)
 // Model.cpp 수정 - Render 함수 수정
 void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager)
 {
-    if (!modelInfo.Visible || meshes.empty())
+    Render(deviceContext, camera, lightManager, modelInfo);
+}
+
+void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager,
+    const ModelInfo& instance)
+{
+    if (!instance.Visible || meshes.empty())
         return;
 
     // 셰이더 설정
@@ -775,6 +951,14 @@ void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, Lig
     // 샘플러 상태 설정
     deviceContext->PSSetSamplers(0, 1, &this->samplerState);
 
+    // 오브젝트별 상수는 인스턴스마다 한 번 (뷰/투영/카메라 위치는 ModelManager가 프레임마다 b2로 올림)
+    ObjectConstants objectConstants = ConstantBuffers::MakeObjectConstants(CalculateWorldMatrix(instance), instance.Override);
+    if (!ConstantBuffers::Update(deviceContext, &constantBuffer, &objectConstants, sizeof(ObjectConstants),
+        ConstantBuffers::FREQUENCY_OBJECT))
+        return;
+    deviceContext->VSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
+    deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_OBJECT, 1, &constantBuffer);
+
     // 각 메시별로 렌더링
     for (const auto& mesh : meshes)
     {
@@ -793,24 +977,22 @@ void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, Lig
             material = &materials["default"];
         }
 
-        // 상수 버퍼 업데이트
-        ConstantBuffer cb;
-        cb.World = XMMatrixTranspose(CalculateWorldMatrix());
-        cb.View = XMMatrixTranspose(camera.GetViewMatrix());
-        cb.Projection = XMMatrixTranspose(camera.GetProjectionMatrix());
-
-        // 재질 정보 설정
-        cb.AmbientColor = XMFLOAT4(material->Ambient.x, material->Ambient.y, material->Ambient.z, 1.0f);
-        cb.DiffuseColor = XMFLOAT4(material->Diffuse.x, material->Diffuse.y, material->Diffuse.z, 1.0f);
-        cb.SpecularColor = XMFLOAT4(material->Specular.x, material->Specular.y, material->Specular.z, 1.0f);
-        cb.Shininess = material->Shininess;
-
-        // 텍스처 유무 설정
-        cb.HasTexture = (material->DiffuseMap != nullptr) ? 1.0f : 0.0f;
-
-        deviceContext->UpdateSubresource(constantBuffer, 0, nullptr, &cb, 0, 0);
-        deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
-        deviceContext->PSSetConstantBuffers(0, 1, &constantBuffer);
+        // 재질 상수는 바뀐 경우만 다시 채워서 올림 (인스턴스 덮어쓰기는 오브젝트별 버퍼에 있으므로 공유 재질은 그대로 둠)
+        if (material->ConstantsDirty || !material->ConstantBuffer)
+        {
+            ObjMaterialConstants materialConstants;
+            materialConstants.AmbientColor = XMFLOAT4(material->Ambient.x, material->Ambient.y, material->Ambient.z, 1.0f);
+            materialConstants.DiffuseColor = XMFLOAT4(material->Diffuse.x, material->Diffuse.y, material->Diffuse.z, 1.0f);
+            materialConstants.SpecularColor = XMFLOAT4(material->Specular.x, material->Specular.y, material->Specular.z, 1.0f);
+            materialConstants.Shininess = material->Shininess;
+            materialConstants.HasTexture = (material->DiffuseMap != nullptr) ? 1.0f : 0.0f;
+            materialConstants.Padding = XMFLOAT2(0.0f, 0.0f);
+            if (!ConstantBuffers::Update(deviceContext, &material->ConstantBuffer, &materialConstants,
+                sizeof(ObjMaterialConstants), ConstantBuffers::FREQUENCY_MATERIAL))
+                continue;
+            material->ConstantsDirty = false;
+        }
+        deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_MATERIAL, 1, &material->ConstantBuffer);
 
         // 텍스처 설정
         if (material->DiffuseMap)
@@ -818,12 +1000,8 @@ void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, Lig
             deviceContext->PSSetShaderResources(0, 1, &material->DiffuseMap);
         }
 
-        // 조명 정보 설정
-         if (lightManager)
-         {
-            lightManager->UpdateLightBuffer(deviceContext);
-            lightManager->SetLightBuffer(deviceContext);
-         }
+        // 조명 상수 버퍼는 ModelManager가 프레임마다 한 번 올리고 바인딩
+
         // 버텍스 및 인덱스 버퍼 설정
         UINT stride = sizeof(Vertex);
         UINT offset = 0;
@@ -835,23 +1013,115 @@ void Model::Render(ID3D11DeviceContext* deviceContext, const Camera& camera, Lig
 
         // 그리기
         deviceContext->DrawIndexed(mesh.IndexCount, 0, 0);
+        ConstantBuffers::RecordDraw(sizeof(ObjMaterialConstants));
     }
 }
 
-XMMATRIX Model::CalculateWorldMatrix()
+// 셰이더 리소스 뷰가 가리키는 2D 텍스처의 크기 (밉 포함)
+static uint64_t GetTextureBytes(ID3D11ShaderResourceView* textureView)
+{
+    uint64_t bytes = 0;
+    ID3D11Resource* resource = nullptr;
+    textureView->GetResource(&resource);
+
+    ID3D11Texture2D* texture2D = nullptr;
+    if (resource && SUCCEEDED(resource->QueryInterface(__uuidof(ID3D11Texture2D), reinterpret_cast<void**>(&texture2D))))
+    {
+        D3D11_TEXTURE2D_DESC desc;
+        texture2D->GetDesc(&desc);
+        for (UINT level = 0; level < desc.MipLevels; level++)
+        {
+            size_t rowPitch = 0;
+            size_t slicePitch = 0;
+            if (SUCCEEDED(DirectX::ComputePitch(desc.Format, (std::max)(desc.Width >> level, 1u),
+                (std::max)(desc.Height >> level, 1u), rowPitch, slicePitch)))
+            {
+                bytes += slicePitch * desc.ArraySize;
+            }
+        }
+        texture2D->Release();
+    }
+
+    if (resource)
+    {
+        resource->Release();
+    }
+    return bytes;
+}
+
+uint64_t Model::GetMemoryUsage() const
+{
+    // 메시 데이터 (CPU 사본 + GPU 버퍼)와 재질 텍스처
+    uint64_t bytes = 0;
+    for (const auto& mesh : meshes)
+    {
+        bytes += (mesh.Vertices.size() * sizeof(Vertex) + mesh.Indices.size() * sizeof(uint32_t)) * 2;
+        bytes += mesh.Picking.GetMemoryUsage();
+    }
+    for (const auto& material : materials)
+    {
+        if (material.second.DiffuseMap)
+        {
+            bytes += GetTextureBytes(material.second.DiffuseMap);
+        }
+    }
+    return bytes;
+}
+
+XMMATRIX Model::CalculateWorldMatrix(const ModelInfo& instance) const
 {
     // 월드 행렬 계산 - 순서가 중요합니다 (Scale -> Rotation -> Translation)
-    XMMATRIX scale = XMMatrixScaling(modelInfo.Scale.x, modelInfo.Scale.y, modelInfo.Scale.z);
+    XMMATRIX scale = XMMatrixScaling(instance.Scale.x, instance.Scale.y, instance.Scale.z);
     XMMATRIX rotation = XMMatrixRotationRollPitchYaw(
-        XMConvertToRadians(modelInfo.Rotation.x),
-        XMConvertToRadians(modelInfo.Rotation.y),
-        XMConvertToRadians(modelInfo.Rotation.z));
-    XMMATRIX translation = XMMatrixTranslation(modelInfo.Position.x, modelInfo.Position.y, modelInfo.Position.z);
+        XMConvertToRadians(instance.Rotation.x),
+        XMConvertToRadians(instance.Rotation.y),
+        XMConvertToRadians(instance.Rotation.z));
+    XMMATRIX translation = XMMatrixTranslation(instance.Position.x, instance.Position.y, instance.Position.z);
 
     // SRT 순서대로 행렬 곱셈
     return scale * rotation * translation;
 }
 
+void Model::BuildPickingBvhs()
+{
+    auto buildStart = std::chrono::high_resolution_clock::now();
+    size_t triangleCount = 0;
+    for (auto& mesh : meshes)
+    {
+        mesh.Picking.Build(mesh.Vertices, mesh.Indices);
+        triangleCount += mesh.Picking.GetTriangleCount();
+    }
+
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - buildStart).count();
+    OutputDebugStringA(("OBJ picking BVH: " + std::to_string(triangleCount) + " triangles in " +
+        std::to_string(buildMs) + " ms\n").c_str());
+}
+
+bool Model::Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, const ModelInfo& instance, RayHit& hit) const
+{
+    // 레이를 메시 로컬 공간으로 역변환 - 방향은 정규화하지 않으므로 교차 거리는 월드 레이 기준 그대로
+    XMMATRIX inverseWorld = XMMatrixInverse(nullptr, CalculateWorldMatrix(instance));
+    XMFLOAT3 localOrigin;
+    XMFLOAT3 localDirection;
+    XMStoreFloat3(&localOrigin, XMVector3TransformCoord(XMLoadFloat3(&origin), inverseWorld));
+    XMStoreFloat3(&localDirection, XMVector3TransformNormal(XMLoadFloat3(&direction), inverseWorld));
+
+    bool found = false;
+    for (size_t i = 0; i < meshes.size(); i++)
+    {
+        int triangle = -1;
+        if (meshes[i].Picking.Raycast(localOrigin, localDirection, hit.Distance, triangle))
+        {
+            hit.Node = -1;
+            hit.Mesh = static_cast<int>(i);
+            hit.Primitive = 0;
+            hit.Triangle = triangle;
+            found = true;
+        }
+    }
+    return found;
+}
+
 std::string Model::GetDirectoryFromPath(const std::string& filePath)
 {
     size_t pos = filePath.find_last_of("/\\");
@@ -875,6 +1145,8 @@ void Model::Release()
     for (auto& material : materials)
     {
         if (material.second.DiffuseMap) { material.second.DiffuseMap->Release(); material.second.DiffuseMap = nullptr; }
+        if (material.second.ConstantBuffer) { material.second.ConstantBuffer->Release(); material.second.ConstantBuffer = nullptr; }
+        material.second.ConstantsDirty = true;
     }
 
     // 셰이더 및 관련 리소스 해제
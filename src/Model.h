@@ -7,6 +7,12 @@
 #include <memory>
 #include <map>
 #include "Camera.h"
+#include "Common.h"
+#include "MeshCache.h"
+#include "ImportProgress.h"
+#include "PickingBvh.h"
+#include "BoundingVolumes.h"
+#include "ConstantBuffers.h"
 
 using namespace DirectX;
 
@@ -31,6 +37,10 @@ public:
         float Shininess = 32.0f;
         std::string DiffuseMapPath;
         ID3D11ShaderResourceView* DiffuseMap = nullptr;
+
+        // 재질 상수 버퍼 (b3) - 처음 그릴 때 만들고 값이나 텍스처가 바뀌어 ConstantsDirty가 켜진 경우만 다시 올림
+        ID3D11Buffer* ConstantBuffer = nullptr;
+        bool ConstantsDirty = true;
     };
 
     // 메시 구조체 - 재질별로 분리된 메시 
@@ -42,6 +52,9 @@ public:
         ID3D11Buffer* VertexBuffer = nullptr;
         ID3D11Buffer* IndexBuffer = nullptr;
         UINT IndexCount = 0;
+
+        // 피킹용 삼각형 BVH (가져올 때 생성)
+        TriangleBvh Picking;
     };
 
     // 모델 정보 구조체
@@ -54,14 +67,32 @@ public:
         XMFLOAT3 Position = { 0.0f, 0.0f, 0.0f };
         XMFLOAT3 Rotation = { 0.0f, 0.0f, 0.0f };
         XMFLOAT3 Scale = { 1.0f, 1.0f, 1.0f };
+        MaterialOverride Override; // 그릴 때만 적용하는 재질 덮어쓰기
+    };
+
+    // OBJ 가져오기 통계
+    struct ImportStats
+    {
+        double ParseMilliseconds = 0.0;
+        unsigned int ParseThreadCount = 1;
+        size_t CornerCount = 0;      // 삼각형 꼭짓점 수 (용접 전 버텍스 수)
+        size_t VertexCount = 0;      // 용접 후 고유 버텍스 수
+        float ReductionRatio = 1.0f; // VertexCount / CornerCount
+        size_t UnweldedMeshBytes = 0; // 용접 전 버텍스 + 인덱스 크기 (배열 크기로 계산한 값)
+        size_t WeldedMeshBytes = 0;   // 용접 후 버텍스 + 인덱스 크기 (배열 크기로 계산한 값)
     };
 
     // 생성자 및 소멸자
     Model();
     ~Model();
 
-    // OBJ 모델 로드 함수
-    bool LoadObjModel(const std::string& filename, ID3D11Device* device);
+    // OBJ 모델 로드 함수 (meshCache가 있으면 파싱 결과를 캐시에서 읽거나 저장)
+    // sourceKey는 AssetRegistry가 만든 원본 식별 정보 (여기서 내용 해시만 채움, 없으면 새로 계산)
+    bool LoadObjModel(const std::string& filename, ID3D11Device* device, MeshCache* meshCache = nullptr,
+        const MeshCache::SourceKey* sourceKey = nullptr);
+
+    // 로드하는 동안 단계별 작업량을 보고하고 취소를 확인할 진행 상태 (없으면 보고하지 않음)
+    void SetImportProgress(std::shared_ptr<ImportProgress> progress) { importProgress = std::move(progress); }
 
     // MTL 파일 로드 함수
     bool LoadMaterialFromMTL(const std::string& mtlFilePath, ID3D11Device* device);
@@ -72,12 +103,28 @@ public:
     // Model.h의 Render 함수 선언 수정
     void Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager);
 
+    // 인스턴스 렌더링 함수 - 공유 에셋을 인스턴스의 변환과 표시 여부로 렌더링
+    void Render(ID3D11DeviceContext* deviceContext, const Camera& camera, LightManager* lightManager,
+        const ModelInfo& instance);
+
     // 모델 정보 getter/setter
     ModelInfo& GetModelInfo() { return modelInfo; }
 
     // 재질 정보 getter
     const std::map<std::string, Material>& GetMaterials() const { return materials; }
 
+    // 가져오기 통계 getter
+    const ImportStats& GetImportStats() const { return importStats; }
+
+    // 원점 기준 로컬 바운딩 박스 getter
+    const BoundingBox& GetBoundingBox() const { return bounds; }
+
+    // 월드 레이와 인스턴스 메시 삼각형의 가장 가까운 교차 (hit.Distance보다 가까우면 hit을 갱신하고 true)
+    bool Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, const ModelInfo& instance, RayHit& hit) const;
+
+    // 에셋이 차지하는 메모리 (메시 CPU/GPU 사본, 텍스처) - 공유 에셋 통계용
+    uint64_t GetMemoryUsage() const;
+
     // 리소스 해제
     void Release();
 
@@ -89,11 +136,24 @@ private:
     bool CreateBuffers(ID3D11Device* device, Mesh& mesh);
 
     // 월드 변환 행렬 계산
-    XMMATRIX CalculateWorldMatrix();
+    XMMATRIX CalculateWorldMatrix(const ModelInfo& instance) const;
 
     // 셰이더 생성 함수
     bool CreateShaders(ID3D11Device* device);
 
+    // OBJ 파싱 및 버텍스 용접 (CPU 작업만 수행)
+    bool BuildFromObj(const std::string& filename);
+
+    // 텍스처, 버퍼, 셰이더 등 GPU 리소스 생성
+    bool CreateDeviceResources(ID3D11Device* device);
+
+    // 메시별 피킹 BVH 생성 (파싱하거나 캐시에서 읽은 뒤)
+    void BuildPickingBvhs();
+
+    // 메시 캐시 직렬화
+    void WriteCache(MeshCache::Writer& writer) const;
+    bool ReadCache(MeshCache::Reader& reader);
+
     // 경로에서 디렉토리 추출
     std::string GetDirectoryFromPath(const std::string& filePath);
 
@@ -107,9 +167,19 @@ private:
     ID3D11VertexShader* vertexShader = nullptr;
     ID3D11PixelShader* pixelShader = nullptr;
     ID3D11InputLayout* inputLayout = nullptr;
-    ID3D11Buffer* constantBuffer = nullptr;
+    ID3D11Buffer* constantBuffer = nullptr; // 오브젝트별 상수 (b0)
     ID3D11SamplerState* samplerState = nullptr;
 
     // 모델 정보
     ModelInfo modelInfo;
+
+    // 가져오기 통계
+    ImportStats importStats;
+
+    // 가져오기 진행 상태 - 취소되면 재질 그룹 단위로 작업을 멈춤
+    std::shared_ptr<ImportProgress> importProgress;
+    bool IsImportCancelled() const { return importProgress && importProgress->IsCancelled(); }
+
+    // 로컬 바운딩 박스
+    BoundingBox bounds = {};
 };
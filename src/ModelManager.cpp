@@ -3,11 +3,76 @@
 #include <Commdlg.h>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <codecvt>
 #include <imgui.h>
 #include <iostream>
+#include <random>
 #include <shlobj.h>
 
+namespace
+{
+    // GLB 가져오기를 ImportPipeline 단계로 나눠 실행하는 작업 (작업량은 로더가 진행 상태에 보고)
+    class GlbImportJob : public ImportPipeline::Job
+    {
+    public:
+        GlbImportJob(const std::string &path, const MeshCache::SourceKey &sourceKey, std::shared_ptr<GltfLoader> model,
+                     MeshCache *meshCache, MeshCache *textureCache, std::shared_ptr<ImportProgress> progress)
+            : path(path), sourceKey(sourceKey), model(std::move(model)), meshCache(meshCache), textureCache(textureCache),
+              progress(std::move(progress))
+        {
+            this->model->SetImportProgress(this->progress);
+        }
+
+        ~GlbImportJob() override
+        {
+            model->SetImportProgress(nullptr);
+        }
+
+        bool RunStage(ImportPipeline::Stage stage) override
+        {
+            switch (stage)
+            {
+            case ImportPipeline::Stage::Read:
+                return model->ReadImportStage(path, meshCache, &sourceKey);
+            case ImportPipeline::Stage::Parse:
+                return model->ParseImportStage();
+            case ImportPipeline::Stage::Process:
+                return model->ProcessImportStage();
+            case ImportPipeline::Stage::DecodeTextures:
+                // 셰이더 바이트코드도 작업자에서 미리 컴파일 (업로드 단계에서는 디바이스 객체만 생성)
+                GltfLoader::DecodeTextureImages({model.get()}, textureCache);
+                return !progress->IsCancelled() && GltfLoader::CompileShaders();
+            default:
+                return true;
+            }
+        }
+
+        void CollectUploads(std::vector<ImportPipeline::UploadItem> &items) override
+        {
+            model->PrepareUploads(items);
+        }
+
+        bool Upload(ID3D11Device *device, const ImportPipeline::UploadItem &item) override
+        {
+            return model->UploadResource(device, item);
+        }
+
+        void Cancel() override
+        {
+            progress->Cancel();
+        }
+
+    private:
+        std::string path;
+        MeshCache::SourceKey sourceKey;
+        std::shared_ptr<GltfLoader> model;
+        MeshCache *meshCache = nullptr;
+        MeshCache *textureCache = nullptr;
+        std::shared_ptr<ImportProgress> progress;
+    };
+}
+
 ModelManager::ModelManager() : device(nullptr)
 {
     // 카메라 초기화 - 초기 위치 설정
@@ -19,6 +84,16 @@ ModelManager::ModelManager() : device(nullptr)
     lightManager = std::make_shared<LightManager>();
 
     stateManager = std::make_unique<InteriorStateManager>();
+
+    // 메시 캐시 초기화 - 실행 파일 위치 기준 cache\mesh 폴더, 최대 2GB
+    char modulePath[MAX_PATH] = {};
+    GetModuleFileNameA(nullptr, modulePath, MAX_PATH);
+    std::string exeDirectory(modulePath);
+    exeDirectory = exeDirectory.substr(0, exeDirectory.find_last_of("/\\") + 1);
+    meshCache.Initialize(exeDirectory + "cache\\mesh", 2ull * 1024 * 1024 * 1024);
+
+    // 텍스처 캐시 초기화 - 밉 + BC 압축 결과를 이미지 내용 해시로 저장, 최대 2GB
+    textureCache.Initialize(exeDirectory + "cache\\texture", 2ull * 1024 * 1024 * 1024);
 }
 
 // 조명 관리자 초기화 함수 추가
@@ -71,9 +146,38 @@ void ModelManager::AddModel(const std::string &path, ID3D11Device *device)
 
 void ModelManager::AddObjModel(const std::string &path, ID3D11Device *device)
 {
-    auto wrapper = std::make_shared<ObjModelWrapper>();
-    if (wrapper->model->LoadObjModel(path, device))
+    // 같은 파일이 이미 로드되어 있으면 에셋을 공유하고 인스턴스만 추가
+    auto handle = assetRegistry.AcquireObj(path);
+    bool loaded = false;
+    if (handle.LoadPromise)
     {
+        loaded = handle.Asset->LoadObjModel(path, device, &meshCache, &handle.Key);
+        handle.LoadPromise->set_value(loaded);
+    }
+    else if (handle.Loaded.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        // 같은 파일을 아직 비동기로 로드 중이면 기다리지 않고 로딩 요청으로 인스턴스를 추가
+        // (작업자가 로드를 마칠 때까지 UI가 멈추지 않도록)
+        AddObjModelAsync(path);
+        return;
+    }
+    else
+    {
+        try
+        {
+            loaded = handle.Loaded.get();
+        }
+        catch (...)
+        {
+            loaded = false;
+        }
+    }
+
+    if (loaded)
+    {
+        auto wrapper = std::make_shared<ObjModelWrapper>(handle.Asset);
+        wrapper->InitializeInstance();
+
         ModelInfo info;
         info.model = wrapper;
         info.type = MODEL_OBJ;
@@ -98,9 +202,38 @@ void ModelManager::AddObjModel(const std::string &path, ID3D11Device *device)
 
 void ModelManager::AddGlbModel(const std::string &path, ID3D11Device *device)
 {
-    auto wrapper = std::make_shared<GlbModelWrapper>();
-    if (wrapper->model->LoadGlbModel(path, device))
+    // 같은 파일이 이미 로드되어 있으면 에셋을 공유하고 인스턴스만 추가
+    auto handle = assetRegistry.AcquireGlb(path);
+    bool loaded = false;
+    if (handle.LoadPromise)
+    {
+        loaded = handle.Asset->LoadGlbModel(path, device, &meshCache, &textureCache, &handle.Key);
+        handle.LoadPromise->set_value(loaded);
+    }
+    else if (handle.Loaded.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        // 같은 파일을 아직 비동기로 로드 중이면 기다리지 않고 로딩 요청으로 인스턴스를 추가
+        // (GLB는 업로드가 끝나야 메인 스레드의 UpdateLoadingStatus가 결과를 설정하므로 여기서 기다리면 교착됨)
+        AddGlbModelAsync(path);
+        return;
+    }
+    else
+    {
+        try
+        {
+            loaded = handle.Loaded.get();
+        }
+        catch (...)
+        {
+            loaded = false;
+        }
+    }
+
+    if (loaded)
     {
+        auto wrapper = std::make_shared<GlbModelWrapper>(handle.Asset);
+        wrapper->InitializeInstance();
+
         ModelInfo info;
         info.model = wrapper;
         info.type = MODEL_GLB;
@@ -137,7 +270,7 @@ void ModelManager::AddModelAsync(const std::string &path)
     }
 }
 
-void ModelManager::AddObjModelAsync(const std::string &path)
+void ModelManager::AddObjModelAsync(const std::string &path, const std::vector<InstancePlacement> &placements, uint32_t batch)
 {
     if (!device)
     {
@@ -145,11 +278,7 @@ void ModelManager::AddObjModelAsync(const std::string &path)
         return;
     }
 
-    auto progress = std::make_shared<LoadingProgress>();
-    progress->filename = path.substr(path.find_last_of("/\\") + 1);
-    progress->progress = 0.0f;
-    progress->isComplete = false;
-    progress->isError = false;
+    auto progress = std::make_shared<ImportProgress>(GetLoadingName(path, placements.size()));
 
     {
         std::lock_guard<std::mutex> lock(progressMutex);
@@ -160,17 +289,36 @@ void ModelManager::AddObjModelAsync(const std::string &path)
     request.filePath = path;
     request.type = MODEL_OBJ;
     request.progress = progress;
-
-    auto objWrapper = std::make_shared<ObjModelWrapper>();
-    request.model = objWrapper;
-
-    // 스레드 풀에서 작업을 실행하고 future를 받아옴
-    request.future = std::async(std::launch::async,
-                                &ModelManager::LoadObjModelThreadFunction,
-                                path,
-                                device,
-                                objWrapper->model,
-                                progress);
+    request.placements = placements;
+    request.batch = batch;
+
+    auto handle = assetRegistry.AcquireObj(path);
+    request.model = std::make_shared<ObjModelWrapper>(handle.Asset);
+
+    if (handle.LoadPromise)
+    {
+        // 스레드 풀에서 작업을 실행하고 future를 받아옴 - 결과는 같은 에셋을 기다리는 요청과 공유
+        ID3D11Device *loadDevice = device;
+        MeshCache *loadMeshCache = &meshCache;
+        auto asset = handle.Asset;
+        auto loadPromise = handle.LoadPromise;
+        MeshCache::SourceKey sourceKey = handle.Key;
+        request.cancel = ThreadPool::CancellationToken::Create();
+        request.future = ThreadPool::GetShared()
+                             .Submit([path, sourceKey, loadDevice, loadMeshCache, asset, progress, loadPromise]()
+                                     {
+                                         bool result = LoadObjModelThreadFunction(path, sourceKey, loadDevice, loadMeshCache, asset, progress);
+                                         loadPromise->set_value(result);
+                                         return result;
+                                     },
+                                     ThreadPool::Priority::Normal, request.cancel)
+                             .share();
+    }
+    else
+    {
+        // 같은 파일을 이미 로드했거나 로드 중이면 그 결과만 기다림
+        request.future = handle.Loaded;
+    }
 
     {
         std::lock_guard<std::mutex> lock(loadRequestsMutex);
@@ -178,7 +326,7 @@ void ModelManager::AddObjModelAsync(const std::string &path)
     }
 }
 
-void ModelManager::AddGlbModelAsync(const std::string &path)
+void ModelManager::AddGlbModelAsync(const std::string &path, const std::vector<InstancePlacement> &placements, uint32_t batch)
 {
     if (!device)
     {
@@ -186,11 +334,7 @@ void ModelManager::AddGlbModelAsync(const std::string &path)
         return;
     }
 
-    auto progress = std::make_shared<LoadingProgress>();
-    progress->filename = path.substr(path.find_last_of("/\\") + 1);
-    progress->progress = 0.0f;
-    progress->isComplete = false;
-    progress->isError = false;
+    auto progress = std::make_shared<ImportProgress>(GetLoadingName(path, placements.size()));
 
     {
         std::lock_guard<std::mutex> lock(progressMutex);
@@ -201,17 +345,23 @@ void ModelManager::AddGlbModelAsync(const std::string &path)
     request.filePath = path;
     request.type = MODEL_GLB;
     request.progress = progress;
+    request.placements = placements;
+    request.batch = batch;
 
-    auto glbWrapper = std::make_shared<GlbModelWrapper>();
-    request.model = glbWrapper;
+    auto handle = assetRegistry.AcquireGlb(path);
+    request.model = std::make_shared<GlbModelWrapper>(handle.Asset);
 
-    // 스레드 풀에서 작업을 실행하고 future를 받아옴
-    request.future = std::async(std::launch::async,
-                                &ModelManager::LoadGlbModelThreadFunction,
-                                path,
-                                device,
-                                glbWrapper->model,
-                                progress);
+    if (handle.LoadPromise)
+    {
+        // 읽기 -> 파싱 -> 처리 -> 텍스처 디코딩은 작업자 스레드에서, GPU 업로드는 UpdateLoadingStatus에서 프레임마다 나눠 처리
+        // 업로드까지 끝나면 loadPromise로 결과를 설정 (같은 에셋을 기다리는 요청과 공유)
+        request.import = importPipeline.Submit(
+            std::make_shared<GlbImportJob>(path, handle.Key, handle.Asset, &meshCache, &textureCache, progress));
+        request.loadPromise = handle.LoadPromise;
+    }
+
+    // 같은 파일을 이미 로드했거나 로드 중이면 그 결과만 기다림
+    request.future = handle.Loaded;
 
     {
         std::lock_guard<std::mutex> lock(loadRequestsMutex);
@@ -219,86 +369,61 @@ void ModelManager::AddGlbModelAsync(const std::string &path)
     }
 }
 
-bool ModelManager::LoadObjModelThreadFunction(const std::string &path, ID3D11Device *device, std::shared_ptr<Model> model, std::shared_ptr<LoadingProgress> progress)
+void ModelManager::AddModelInstanceAsync(const std::string &path, ModelType type, const InstancePlacement &placement, uint32_t batch)
 {
-    try
     {
-        // 실제 로딩 진행
-        progress->progress = 0.1f; // 시작
-
-        bool result = model->LoadObjModel(path, device);
-
-        if (result)
-        {
-            progress->progress = 1.0f;
-            progress->isComplete = true;
-
-            // 시간 기록 (완료된 시간 표시용)
-            progress->errorMessage = std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
-                                                        std::chrono::system_clock::now().time_since_epoch())
-                                                        .count());
+        std::lock_guard<std::mutex> lock(loadRequestsMutex);
 
-            return true;
-        }
-        else
+        // 인스턴스는 UpdateLoadingStatus가 같은 잠금 안에서 요청을 처리할 때 만들어지므로 그 전에 붙인 배치도 함께 생성됨
+        for (auto &request : loadRequests)
         {
-            progress->isError = true;
-            progress->errorMessage = "Failed to load OBJ model: " + path;
-            return false;
+            if (request.batch == batch && !request.placements.empty() && request.type == type &&
+                request.filePath == path && !request.progress->IsCancelled() && !request.discarded)
+            {
+                request.placements.push_back(placement);
+                return;
+            }
         }
     }
-    catch (const std::exception &e)
+
+    if (type == MODEL_GLB)
     {
-        progress->isError = true;
-        progress->errorMessage = "Exception: " + std::string(e.what());
-        return false;
+        AddGlbModelAsync(path, {placement}, batch);
     }
-    catch (...)
+    else
     {
-        progress->isError = true;
-        progress->errorMessage = "Unknown error occurred while loading model";
-        return false;
+        AddObjModelAsync(path, {placement}, batch);
     }
 }
 
-bool ModelManager::LoadGlbModelThreadFunction(const std::string &path, ID3D11Device *device, std::shared_ptr<GltfLoader> model, std::shared_ptr<LoadingProgress> progress)
+bool ModelManager::LoadObjModelThreadFunction(const std::string &path, const MeshCache::SourceKey &sourceKey, ID3D11Device *device, MeshCache *meshCache, std::shared_ptr<Model> model, std::shared_ptr<ImportProgress> progress)
 {
     try
     {
-        // 실제 로딩 진행
-        progress->progress = 0.1f; // 시작
-
-        bool result = model->LoadGlbModel(path, device);
+        // 모델이 단계별 작업량을 보고하고 취소되면 재질 그룹 단위로 멈춤
+        model->SetImportProgress(progress);
+        bool result = model->LoadObjModel(path, device, meshCache, &sourceKey);
+        model->SetImportProgress(nullptr);
 
+        // 이미 취소되었으면 Complete/Fail은 무시됨
         if (result)
         {
-            progress->progress = 1.0f;
-            progress->isComplete = true;
-
-            // 시간 기록 (완료된 시간 표시용)
-            progress->errorMessage = std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
-                                                        std::chrono::system_clock::now().time_since_epoch())
-                                                        .count());
-
-            return true;
+            progress->Complete();
         }
         else
         {
-            progress->isError = true;
-            progress->errorMessage = "Failed to load GLB model: " + path;
-            return false;
+            progress->Fail("Failed to load OBJ model: " + path);
         }
+        return result && !progress->IsCancelled();
     }
     catch (const std::exception &e)
     {
-        progress->isError = true;
-        progress->errorMessage = "Exception: " + std::string(e.what());
+        progress->Fail("Exception: " + std::string(e.what()));
         return false;
     }
     catch (...)
     {
-        progress->isError = true;
-        progress->errorMessage = "Unknown error occurred while loading model";
+        progress->Fail("Unknown error occurred while loading model");
         return false;
     }
 }
@@ -307,9 +432,46 @@ void ModelManager::UpdateLoadingStatus()
 {
     std::lock_guard<std::mutex> lock(loadRequestsMutex);
 
-    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-                   std::chrono::system_clock::now().time_since_epoch())
-                   .count();
+    // 가져오기 파이프라인의 GPU 업로드를 프레임 예산 안에서 처리하고 끝난 가져오기의 결과를 공유 에셋에 설정
+    if (device)
+    {
+        ImportPipeline::DeviceUploadSink uploadSink(device);
+        std::vector<std::shared_ptr<ImportPipeline::Entry>> finishedImports;
+        importPipeline.PumpUploads(uploadSink, uploadBudgetMilliseconds, finishedImports);
+
+        for (const auto &entry : finishedImports)
+        {
+            for (auto &request : loadRequests)
+            {
+                if (request.import != entry)
+                {
+                    continue;
+                }
+
+                // 실패하면 멈춘 단계를 함께 표시 (취소는 진행 상태가 이미 취소됨)
+                bool result = entry->GetStage() == ImportPipeline::Stage::Done;
+                if (entry->GetStage() == ImportPipeline::Stage::Failed)
+                {
+                    request.progress->Fail(std::string("Failed to load GLB model (") +
+                                           ImportProgress::GetPhaseName(request.progress->GetPhase()) + "): " + request.filePath);
+                }
+
+                OutputDebugStringA(("GLB import: " + request.filePath +
+                                    "\n  read " + std::to_string(entry->GetStageMilliseconds(ImportPipeline::Stage::Read)) +
+                                    " ms, parse " + std::to_string(entry->GetStageMilliseconds(ImportPipeline::Stage::Parse)) +
+                                    " ms, process " + std::to_string(entry->GetStageMilliseconds(ImportPipeline::Stage::Process)) +
+                                    " ms, decode " + std::to_string(entry->GetStageMilliseconds(ImportPipeline::Stage::DecodeTextures)) +
+                                    " ms, upload " + std::to_string(entry->GetStageMilliseconds(ImportPipeline::Stage::Upload)) +
+                                    " ms (" + std::to_string(entry->GetUploadedCount()) + "/" +
+                                    std::to_string(entry->GetUploadCount()) + " items)\n")
+                                       .c_str());
+
+                request.loadPromise->set_value(result);
+                request.import = nullptr;
+                request.loadPromise = nullptr;
+            }
+        }
+    }
 
     // 완료된 로딩 요청 처리
     for (auto it = loadRequests.begin(); it != loadRequests.end();)
@@ -328,53 +490,26 @@ void ModelManager::UpdateLoadingStatus()
             }
             catch (...)
             {
-                // 예외 처리
-                request.progress->isError = true;
-                request.progress->errorMessage = "Exception during model loading";
+                // 시작 전에 취소된 작업도 여기로 옴 (이미 취소된 진행 상태는 바뀌지 않음)
+                request.progress->Fail("Exception during model loading");
             }
 
+            // 공유 에셋을 기다린 요청은 로드 함수가 진행 상태를 갱신하지 않으므로 여기서 완료 처리
+            // 취소한 요청은 결과와 상관없이 모델을 추가하지 않음 (요청을 지우면 에셋과 처리한 데이터가 해제됨)
             if (result)
             {
-                // 성공적으로 로드된 모델 추가
-                ModelInfo info;
-                info.model = request.model;
-                info.type = request.type;
-
-                if (request.type == MODEL_OBJ)
-                {
-                    auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(request.model);
-                    info.name = objWrapper->model->GetModelInfo().Name;
-                    info.path = request.filePath;
-                }
-                else
-                {
-                    auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(request.model);
-                    info.name = glbWrapper->model->GetModelInfo().Name;
-                    info.path = request.filePath;
-                }
-
-                models.push_back(info);
-                selectedModelIndex = static_cast<int>(models.size()) - 1;
+                request.progress->Complete();
+            }
+            else
+            {
+                request.progress->Fail("Failed to load model: " + request.filePath);
+            }
+            result = result && !request.progress->IsCancelled() && !request.discarded;
 
-                // 첫 번째 재질 선택
-                if (request.type == MODEL_OBJ)
-                {
-                    auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(request.model);
-                    const auto &materials = objWrapper->model->GetMaterials();
-                    if (!materials.empty())
-                    {
-                        selectedMaterialName = materials.begin()->first;
-                    }
-                }
-                else
-                {
-                    auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(request.model);
-                    const auto &materials = glbWrapper->model->GetMaterials();
-                    if (!materials.empty())
-                    {
-                        selectedMaterialName = materials.begin()->first;
-                    }
-                }
+            if (result)
+            {
+                // 성공적으로 로드된 모델 추가
+                AddLoadedInstances(request);
             }
 
             // 처리 완료된 요청 제거
@@ -392,33 +527,184 @@ void ModelManager::UpdateLoadingStatus()
 
         for (auto it = loadingProgresses.begin(); it != loadingProgresses.end();)
         {
-            auto &progress = *it;
-
-            if (progress->isComplete || progress->isError)
+            // 완료는 잠시 표시한 뒤, 취소는 바로 제거 (실패는 계속 표시)
+            ImportProgress::State state = (*it)->GetState();
+            if ((state == ImportProgress::State::Complete &&
+                 (*it)->GetMillisecondsSinceFinished() > loadingCompleteDisplayTime) ||
+                state == ImportProgress::State::Cancelled)
             {
-                // 완료 시간이 저장된 경우 (밀리초 타임스탬프)
-                if (!progress->errorMessage.empty() && progress->isComplete)
-                {
-                    try
-                    {
-                        long long completeTime = std::stoll(progress->errorMessage);
-                        if (now - completeTime > loadingCompleteDisplayTime)
-                        {
-                            it = loadingProgresses.erase(it);
-                            continue;
-                        }
-                    }
-                    catch (...)
-                    {
-                        // 시간 파싱 실패하면 그냥 유지
-                    }
-                }
+                it = loadingProgresses.erase(it);
+                continue;
             }
             ++it;
         }
     }
 }
 
+void ModelManager::CancelLoad(const std::shared_ptr<ImportProgress> &progress)
+{
+    std::lock_guard<std::mutex> lock(loadRequestsMutex);
+
+    // 같은 파일을 기다리는 요청은 한 번의 로드를 공유하므로 함께 취소
+    std::string filePath;
+    for (const auto &request : loadRequests)
+    {
+        if (request.progress == progress)
+        {
+            filePath = request.filePath;
+        }
+    }
+
+    for (auto &request : loadRequests)
+    {
+        if (request.progress == progress || (!filePath.empty() && request.filePath == filePath))
+        {
+            CancelRequest(request);
+        }
+    }
+}
+
+void ModelManager::CancelLoads()
+{
+    std::lock_guard<std::mutex> lock(loadRequestsMutex);
+    for (auto &request : loadRequests)
+    {
+        CancelRequest(request);
+    }
+}
+
+void ModelManager::CancelLoadBatch(uint32_t batch)
+{
+    CancelSelectedRequests([batch](const LoadRequest &request) { return request.batch == batch; });
+}
+
+void ModelManager::CancelLoadsExcept(uint32_t batch)
+{
+    CancelSelectedRequests([batch](const LoadRequest &request) { return request.batch != batch; });
+}
+
+void ModelManager::CancelSelectedRequests(const std::function<bool(const LoadRequest &)> &selected)
+{
+    std::lock_guard<std::mutex> lock(loadRequestsMutex);
+    for (auto &request : loadRequests)
+    {
+        if (!selected(request) || request.discarded)
+        {
+            continue;
+        }
+
+        bool shared = false;
+        for (const auto &other : loadRequests)
+        {
+            if (&other != &request && !selected(other) && other.filePath == request.filePath && !other.progress->IsCancelled())
+            {
+                shared = true;
+                break;
+            }
+        }
+
+        if (shared)
+        {
+            request.discarded = true;
+        }
+        else
+        {
+            CancelRequest(request);
+        }
+    }
+}
+
+void ModelManager::CancelRequest(LoadRequest &request)
+{
+    // 시작 전인 OBJ 작업은 버리고, 진행 중인 작업은 진행 상태를 확인하는 지점에서 멈춤
+    request.cancel.Cancel();
+    request.progress->Cancel();
+    if (request.import)
+    {
+        request.import->Cancel();
+    }
+}
+
+void ModelManager::AddLoadedInstances(LoadRequest &request)
+{
+    // 첫 인스턴스는 요청의 래퍼를 쓰고 나머지는 같은 에셋을 참조하는 래퍼를 새로 만듦
+    size_t instanceCount = (std::max)(request.placements.size(), static_cast<size_t>(1));
+    models.reserve(models.size() + instanceCount);
+
+    for (size_t i = 0; i < instanceCount; i++)
+    {
+        ModelInfo info;
+        info.type = request.type;
+        info.path = request.filePath;
+
+        if (request.type == MODEL_OBJ)
+        {
+            auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(request.model);
+            if (i > 0)
+            {
+                objWrapper = std::make_shared<ObjModelWrapper>(objWrapper->model);
+            }
+            objWrapper->InitializeInstance();
+            info.model = objWrapper;
+            info.name = objWrapper->model->GetModelInfo().Name;
+        }
+        else
+        {
+            auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(request.model);
+            if (i > 0)
+            {
+                glbWrapper = std::make_shared<GlbModelWrapper>(glbWrapper->model);
+            }
+            glbWrapper->InitializeInstance();
+            info.model = glbWrapper;
+            info.name = glbWrapper->model->GetModelInfo().Name;
+        }
+
+        // 저장된 배치가 있으면 에셋 기본 배치 대신 적용
+        if (i < request.placements.size())
+        {
+            const InstancePlacement &placement = request.placements[i];
+            info.model->SetPosition(placement.Position);
+            info.model->SetRotation(placement.Rotation);
+            info.model->SetScale(placement.Scale);
+            info.model->SetVisibility(placement.Visible);
+        }
+
+        models.push_back(info);
+    }
+    selectedModelIndex = static_cast<int>(models.size()) - 1;
+
+    // 첫 번째 재질 선택
+    if (request.type == MODEL_OBJ)
+    {
+        auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(request.model);
+        const auto &materials = objWrapper->model->GetMaterials();
+        if (!materials.empty())
+        {
+            selectedMaterialName = materials.begin()->first;
+        }
+    }
+    else
+    {
+        auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(request.model);
+        const auto &materials = glbWrapper->model->GetMaterials();
+        if (!materials.empty())
+        {
+            selectedMaterialName = materials.begin()->first;
+        }
+    }
+}
+
+std::string ModelManager::GetLoadingName(const std::string &path, size_t instanceCount)
+{
+    std::string name = path.substr(path.find_last_of("/\\") + 1);
+    if (instanceCount > 1)
+    {
+        name += " x" + std::to_string(instanceCount);
+    }
+    return name;
+}
+
 void ModelManager::RemoveModel(int index)
 {
     if (index >= 0 && index < models.size())
@@ -440,30 +726,59 @@ void ModelManager::RemoveModel(int index)
 
 void ModelManager::RenderModels(ID3D11DeviceContext *deviceContext)
 {
+    // 지난 프레임의 상수 버퍼 업로드 기록을 마감 (상태 표시줄)
+    ConstantBuffers::EndFrame();
+
+    // 프레임별 상수 (뷰/투영/카메라 위치)는 여기서 한 번만 올림
+    FrameConstants frameConstants;
+    frameConstants.view = XMMatrixTranspose(camera.GetViewMatrix());
+    frameConstants.projection = XMMatrixTranspose(camera.GetProjectionMatrix());
+    XMFLOAT3 cameraPosition = camera.GetPosition();
+    frameConstants.cameraPosition = XMFLOAT4(cameraPosition.x, cameraPosition.y, cameraPosition.z, 1.0f);
+    if (ConstantBuffers::Update(deviceContext, &frameConstantBuffer, &frameConstants, sizeof(FrameConstants),
+                                ConstantBuffers::FREQUENCY_FRAME))
+    {
+        deviceContext->VSSetConstantBuffers(ConstantBuffers::SLOT_FRAME, 1, &frameConstantBuffer);
+        deviceContext->PSSetConstantBuffers(ConstantBuffers::SLOT_FRAME, 1, &frameConstantBuffer);
+    }
+
+    // 조명 상수 버퍼는 프레임마다 한 번만 바인딩 (조명이 바뀐 경우만 다시 올림)
+    if (lightManager)
+    {
+        lightManager->UpdateLightBuffer(deviceContext);
+        lightManager->SetLightBuffer(deviceContext);
+    }
+
     // 1. 먼저 방 렌더링 (불투명)
     if (roomModel)
     {
         roomModel->Render(deviceContext, camera, lightManager.get());
     }
 
-    // 2. 불투명 모델 렌더링
+    // 시야 절두체 밖의 모델은 그리지 않음 (월드 박스는 변환이 바뀐 모델만 다시 계산)
+    BoundingVolumes::Frustum frustum = BoundingVolumes::ExtractFrustum(camera.GetViewMatrix() * camera.GetProjectionMatrix());
+    culledModelCount = 0;
+    auto isCulled = [&](const ModelInfo &modelInfo)
+    {
+        if (BoundingVolumes::Intersects(frustum, modelInfo.model->GetBoundingBox()))
+        {
+            return false;
+        }
+        culledModelCount++;
+        return true;
+    };
+
+    // 2. 불투명 모델 렌더링 (hover/선택/드래그 상태는 인스턴스 재질 덮어쓰기로 전달)
     for (int i = 0; i < models.size(); i++)
     {
         const auto &modelInfo = models[i];
-        bool isHovered = (isHoverEnabled && hoveredModelIndex == i);
-        
-        // hover 상태가 아닌 경우만 먼저 렌더링
-        if (!isHovered)
+        MaterialOverride materialOverride = GetMaterialOverride(i);
+        modelInfo.model->SetMaterialOverride(materialOverride);
+
+        // 반투명 모델은 마지막에 렌더링
+        if (materialOverride.tint.w >= 1.0f && !isCulled(modelInfo))
         {
-            if (modelInfo.type == MODEL_OBJ)
-            {
-                auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(modelInfo.model);
-                objWrapper->model->Render(deviceContext, camera, lightManager.get());
-            }
-            else if (modelInfo.type == MODEL_GLB)
-            {
-                modelInfo.model->Render(deviceContext, camera, lightManager.get());
-            }
+            modelInfo.model->Render(deviceContext, camera, lightManager.get());
         }
     }
 
@@ -473,74 +788,45 @@ void ModelManager::RenderModels(ID3D11DeviceContext *deviceContext)
         dummyCharacter->Render(deviceContext, camera);
     }
 
-    // 4. 투명/Hover 모델 렌더링 (마지막에)
+    // 4. 투명/Hover 모델 렌더링 (마지막에) - 공유 재질은 그대로 두고 상수 버퍼에만 투명도 적용
     for (int i = 0; i < models.size(); i++)
     {
         const auto &modelInfo = models[i];
-        bool isHovered = (isHoverEnabled && hoveredModelIndex == i);
-        
-        if (isHovered)
+        if (GetMaterialOverride(i).tint.w < 1.0f && !isCulled(modelInfo))
         {
-            // hover 상태인 경우 투명도 적용하여 렌더링
-            if (modelInfo.type == MODEL_OBJ)
-            {
-                auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(modelInfo.model);
-                auto &materials = const_cast<std::map<std::string, Model::Material> &>(objWrapper->model->GetMaterials());
-                std::map<std::string, XMFLOAT4> originalDiffuse;
-
-                for (auto &material : materials)
-                {
-                    originalDiffuse[material.first] = material.second.Diffuse;
-                    material.second.Diffuse.w = hoverAlpha;
-                }
-
-                objWrapper->model->Render(deviceContext, camera, lightManager.get());
-
-                // 원본 색상 복원
-                for (auto &material : materials)
-                {
-                    material.second.Diffuse = originalDiffuse[material.first];
-                }
-            }
-            else if (modelInfo.type == MODEL_GLB)
-            {
-                auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(modelInfo.model);
-
-                // GLB 모델의 경우 PBR 재질의 투명도 임시 변경
-                auto &materials = const_cast<std::map<std::string, GltfLoader::PbrMaterial> &>(glbWrapper->model->GetMaterials());
-                std::map<std::string, XMFLOAT4> originalBaseColor; // 원본 색상 저장
-
-                for (auto &material : materials)
-                {
-                    originalBaseColor[material.first] = material.second.BaseColorFactor;
-                    material.second.BaseColorFactor.w = hoverAlpha; // 투명도 적용
-                }
-
-                modelInfo.model->Render(deviceContext, camera, lightManager.get());
-
-                // 원본 색상 복원
-                for (auto &material : materials)
-                {
-                    material.second.BaseColorFactor = originalBaseColor[material.first];
-                }
-            }
+            modelInfo.model->Render(deviceContext, camera, lightManager.get());
         }
     }
 }
 
-// 프레임 처리 함수
-void ModelManager::ProcessFrame(HWND hwnd, float deltaTime)
+// 모델 상태별 재질 덮어쓰기
+MaterialOverride ModelManager::GetMaterialOverride(int index) const
 {
-    // 마우스 위치 추적 (hover 효과를 위해)
-    if (!isDragging && isHoverEnabled)
+    MaterialOverride materialOverride;
+    if (isDragging && draggedModelIndex == index)
     {
-        POINT cursorPos;
-        if (GetCursorPos(&cursorPos) && ScreenToClient(hwnd, &cursorPos))
-        {
-            OnMouseHover(cursorPos.x, cursorPos.y, hwnd);
-        }
+        // 드래그 중인 모델은 푸른 반투명 고스트
+        materialOverride.tint = XMFLOAT4(0.7f, 0.85f, 1.0f, hoverAlpha);
+    }
+    else if (isHoverEnabled && hoveredModelIndex == index)
+    {
+        // hover 시 투명도 적용
+        materialOverride.tint.w = hoverAlpha;
     }
 
+    // 선택한 모델은 강조 색을 더하고 자체 발광을 키움
+    if (selectedModelIndex == index)
+    {
+        materialOverride.highlight = XMFLOAT3(0.08f, 0.08f, 0.02f);
+        materialOverride.emissiveBoost = 1.5f;
+    }
+    return materialOverride;
+}
+
+// 프레임 처리 함수
+void ModelManager::ProcessFrame(HWND hwnd, float deltaTime)
+{
+    // 입력 처리는 창을 만든 스레드에서만 동작하므로 (GetActiveWindow 등) 작업 그래프 전에 메인 스레드에서 실행
     // 현재 카메라 모드에 따라 다른 처리
     if (isFirstPersonMode)
     {
@@ -558,15 +844,49 @@ void ModelManager::ProcessFrame(HWND hwnd, float deltaTime)
     //// 카메라 입력 처리
     // camera.ProcessInput(hwnd, deltaTime);
 
-    // GLB 모델의 애니메이션 업데이트
+    // 마우스 위치 추적 (hover 효과를 위해)
+    bool hoverRequested = false;
+    POINT cursorPos = {};
+    if (!isDragging && isHoverEnabled)
+    {
+        hoverRequested = GetCursorPos(&cursorPos) && ScreenToClient(hwnd, &cursorPos);
+    }
+
+    // 프레임 갱신 작업 그래프 구성
+    // 애니메이션 상태는 에셋에 있으므로 공유 에셋당 애니메이션 -> 월드 행렬 -> 바운딩 박스 순서로 한 번만 진행
+    // 서로 다른 에셋의 작업은 공유 스레드 풀에서 동시에 실행
+    frameTasks.Clear();
+    std::vector<GltfLoader *> animatedAssets;
+    std::vector<TaskGraph::TaskId> boundsTasks;
     for (auto &modelInfo : models)
     {
         if (modelInfo.type == MODEL_GLB)
         {
             auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(modelInfo.model);
-            glbWrapper->model->UpdateAnimation(deltaTime);
+            GltfLoader *asset = glbWrapper->model.get();
+            if (asset && std::find(animatedAssets.begin(), animatedAssets.end(), asset) == animatedAssets.end())
+            {
+                animatedAssets.push_back(asset);
+
+                const std::string &name = modelInfo.name;
+                TaskGraph::TaskId animation = frameTasks.Add("애니메이션: " + name, [asset, deltaTime]()
+                                                             { asset->UpdateAnimation(deltaTime); });
+                TaskGraph::TaskId transforms = frameTasks.Add("월드 행렬: " + name, [asset]()
+                                                              { asset->UpdateWorldTransforms(); }, {animation});
+                boundsTasks.push_back(frameTasks.Add("바운딩 박스: " + name, [asset]()
+                                                     { asset->UpdateAnimatedBounds(); }, {transforms}));
+            }
         }
     }
+
+    // hover 피킹은 모델 바운딩 박스를 읽으므로 바운딩 박스 갱신이 모두 끝난 뒤 실행
+    if (hoverRequested)
+    {
+        frameTasks.Add("Hover 피킹", [this, cursorPos, hwnd]()
+                       { OnMouseHover(cursorPos.x, cursorPos.y, hwnd); }, boundsTasks);
+    }
+
+    frameTasks.Run(ThreadPool::GetShared());
 }
 
 void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
@@ -605,7 +925,7 @@ void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
         testPos.x += moveSpeed * sinf(XMConvertToRadians(dummyCharacter->GetRotation()));
         testPos.z += moveSpeed * cosf(XMConvertToRadians(dummyCharacter->GetRotation()));
 
-        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth))
+        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth) && !CollidesWithModels(newPosition, testPos))
         {
             dummyCharacter->MoveForward(moveSpeed);
             newPosition = dummyCharacter->GetPosition();
@@ -619,7 +939,7 @@ void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
         testPos.x -= moveSpeed * sinf(XMConvertToRadians(dummyCharacter->GetRotation()));
         testPos.z -= moveSpeed * cosf(XMConvertToRadians(dummyCharacter->GetRotation()));
 
-        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth))
+        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth) && !CollidesWithModels(newPosition, testPos))
         {
             dummyCharacter->MoveForward(-moveSpeed);
             newPosition = dummyCharacter->GetPosition();
@@ -633,7 +953,7 @@ void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
         testPos.x -= moveSpeed * cosf(XMConvertToRadians(dummyCharacter->GetRotation()));
         testPos.z += moveSpeed * sinf(XMConvertToRadians(dummyCharacter->GetRotation()));
 
-        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth))
+        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth) && !CollidesWithModels(newPosition, testPos))
         {
             dummyCharacter->MoveRight(-moveSpeed);
             newPosition = dummyCharacter->GetPosition();
@@ -647,7 +967,7 @@ void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
         testPos.x += moveSpeed * cosf(XMConvertToRadians(dummyCharacter->GetRotation()));
         testPos.z -= moveSpeed * sinf(XMConvertToRadians(dummyCharacter->GetRotation()));
 
-        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth))
+        if (!dummyCharacter->CheckCollision(testPos, roomWidth, roomHeight, roomDepth) && !CollidesWithModels(newPosition, testPos))
         {
             dummyCharacter->MoveRight(moveSpeed);
             newPosition = dummyCharacter->GetPosition();
@@ -698,6 +1018,38 @@ void ModelManager::ProcessCharacterInput(HWND hwnd, float deltaTime)
     }
 }
 
+// 캐릭터와 모델 충돌 체크 (캐릭터는 발 위치 기준 원기둥을 감싸는 박스)
+bool ModelManager::CollidesWithModels(const XMFLOAT3 &current, const XMFLOAT3 &next) const
+{
+    // 러그처럼 바닥에 낮게 깔린 모델은 넘어갈 수 있도록 발목 높이 아래는 무시
+    const float stepHeight = 0.3f;
+    float radius = dummyCharacter->GetRadius();
+    float height = dummyCharacter->GetHeight();
+    auto characterBox = [&](const XMFLOAT3 &position)
+    {
+        return BoundingVolumes::FromMinMax(
+            XMVectorSet(position.x - radius, position.y + stepHeight, position.z - radius, 0.0f),
+            XMVectorSet(position.x + radius, position.y + height, position.z + radius, 0.0f));
+    };
+
+    BoundingBox currentBox = characterBox(current);
+    BoundingBox nextBox = characterBox(next);
+    for (const auto &modelInfo : models)
+    {
+        if (!modelInfo.model->IsVisible())
+        {
+            continue;
+        }
+
+        BoundingBox modelBox = modelInfo.model->GetBoundingBox();
+        if (BoundingVolumes::Intersects(nextBox, modelBox) && !BoundingVolumes::Intersects(currentBox, modelBox))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool ModelManager::OpenTextureFileDialog(HWND hwnd, std::string &filePath)
 {
     OPENFILENAMEA ofn;
@@ -799,25 +1151,29 @@ void ModelManager::RenderObjMaterialProperties(std::shared_ptr<Model> model)
         // 앰비언트 색상 편집
         if (ImGui::ColorEdit3("주변광 색상", (float *)&material.Ambient))
         {
-            // 색상이 변경됨
+            // 색상이 변경됨 - 재질 상수 버퍼를 다음에 그릴 때 다시 올림
+            material.ConstantsDirty = true;
         }
 
         // 디퓨즈 색상 편집
         if (ImGui::ColorEdit3("확산광 색상", (float *)&material.Diffuse))
         {
             // 색상이 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 스페큘러 색상 편집
         if (ImGui::ColorEdit3("반사광 색상", (float *)&material.Specular))
         {
             // 색상이 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 광택도 편집
         if (ImGui::SliderFloat("Gloss", &material.Shininess, 1.0f, 128.0f))
         {
             // 광택도가 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 텍스처 정보
@@ -835,6 +1191,7 @@ void ModelManager::RenderObjMaterialProperties(std::shared_ptr<Model> model)
                     // 선택된 텍스처 로드
                     model->LoadTexture(texturePath, device, &material.DiffuseMap);
                     material.DiffuseMapPath = texturePath;
+                    material.ConstantsDirty = true; // 텍스처 유무가 바뀔 수 있음
                 }
             }
         }
@@ -851,6 +1208,7 @@ void ModelManager::RenderObjMaterialProperties(std::shared_ptr<Model> model)
                     // 선택된 텍스처 로드
                     model->LoadTexture(texturePath, device, &material.DiffuseMap);
                     material.DiffuseMapPath = texturePath;
+                    material.ConstantsDirty = true; // 텍스처 유무가 바뀔 수 있음
                 }
             }
         }
@@ -901,25 +1259,29 @@ void ModelManager::RenderGlbMaterialProperties(std::shared_ptr<GltfLoader> model
         // 베이스 컬러 편집
         if (ImGui::ColorEdit4("베이스 컬러", (float *)&material.BaseColorFactor))
         {
-            // 색상이 변경됨
+            // 색상이 변경됨 - 재질 상수 버퍼를 다음에 그릴 때 다시 올림
+            material.ConstantsDirty = true;
         }
 
         // 이미시브 편집
         if (ImGui::ColorEdit3("이미시브 컬러", (float *)&material.EmissiveFactor))
         {
             // 색상이 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 메탈릭 인자 편집
         if (ImGui::SliderFloat("메탈릭 인자", &material.MetallicFactor, 0.0f, 1.0f))
         {
             // 메탈릭 인자가 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 러프니스 인자 편집
         if (ImGui::SliderFloat("러프니스 인자", &material.RoughnessFactor, 0.0f, 1.0f))
         {
             // 러프니스 인자가 변경됨
+            material.ConstantsDirty = true;
         }
 
         // 텍스처 정보 - 베이스 컬러
@@ -1172,6 +1534,36 @@ void ModelManager::RenderImGuiWindow(HWND hwnd, ID3D11Device *device, float delt
         }
     }
 
+    // 배치 파일 형식 변환 (JSON .interior <-> 바이너리 .interiorb, 대상 형식은 저장할 확장자로 결정)
+    if (ImGui::Button("배치 파일 변환"))
+    {
+        std::string sourcePath;
+        std::string targetPath;
+        if (OpenLoadFileDialog(hwnd, sourcePath) && OpenSaveFileDialog(hwnd, targetPath))
+        {
+            if (!stateManager->ConvertStateFile(sourcePath, targetPath))
+            {
+                OutputDebugStringA("배치 파일 변환에 실패했습니다.\n");
+            }
+        }
+    }
+
+    // 배치 파일 저장/로드 성능 측정 (합성 배치, 결과는 디버그 출력)
+    ImGui::SameLine();
+    if (ImGui::Button("배치 형식 성능 측정 (1만/10만개)"))
+    {
+        stateManager->BenchmarkStateFormats(10000);
+        stateManager->BenchmarkStateFormats(100000);
+    }
+
+    // hover 피킹 성능 측정 (첫 번째 모델을 격자로 복제, 결과는 디버그 출력)
+    ImGui::SameLine();
+    if (ImGui::Button("피킹 성능 측정 (1천/1만개)"))
+    {
+        BenchmarkPicking(1000);
+        BenchmarkPicking(10000);
+    }
+
     ImGui::Separator();
 
     // 모델 목록
@@ -1408,7 +1800,7 @@ bool ModelManager::OpenSaveFileDialog(HWND hwnd, std::string& filePath)
     ofn.hwndOwner = hwnd;
     ofn.lpstrFile = szFile;
     ofn.nMaxFile = sizeof(szFile);
-    ofn.lpstrFilter = "Interior Design Files\0*.interior\0JSON Files\0*.json\0All Files\0*.*\0";
+    ofn.lpstrFilter = "Interior Design Files\0*.interior\0Binary Layout Files\0*.interiorb\0JSON Files\0*.json\0All Files\0*.*\0";
     ofn.nFilterIndex = 1;
     ofn.lpstrFileTitle = NULL;
     ofn.nMaxFileTitle = 0;
@@ -1434,7 +1826,7 @@ bool ModelManager::OpenLoadFileDialog(HWND hwnd, std::string& filePath)
     ofn.hwndOwner = hwnd;
     ofn.lpstrFile = szFile;
     ofn.nMaxFile = sizeof(szFile);
-    ofn.lpstrFilter = "Interior Design Files\0*.interior\0JSON Files\0*.json\0All Files\0*.*\0";
+    ofn.lpstrFilter = "Interior Design Files\0*.interior\0Binary Layout Files\0*.interiorb\0JSON Files\0*.json\0All Files\0*.*\0";
     ofn.nFilterIndex = 1;
     ofn.lpstrFileTitle = NULL;
     ofn.nMaxFileTitle = 0;
@@ -1451,10 +1843,25 @@ bool ModelManager::OpenLoadFileDialog(HWND hwnd, std::string& filePath)
 
 void ModelManager::Release()
 {
-    // 로딩 중인 모든 요청을 기다림
+    // 단계별 가져오기를 취소하고 작업자에서 실행 중인 단계가 끝날 때까지 대기
+    importPipeline.Shutdown();
+
+    // 아직 시작하지 않은 로드 작업은 취소하고 실행 중인 요청만 기다림
     {
         std::lock_guard<std::mutex> lock(loadRequestsMutex);
         for (auto &request : loadRequests)
+        {
+            request.cancel.Cancel();
+
+            // 업로드 전에 멈춘 가져오기는 실패로 완료 (같은 에셋을 기다리는 요청이 멈추지 않도록)
+            if (request.loadPromise)
+            {
+                request.loadPromise->set_value(false);
+                request.loadPromise = nullptr;
+                request.import = nullptr;
+            }
+        }
+        for (auto &request : loadRequests)
         {
             if (request.future.valid())
             {
@@ -1482,6 +1889,12 @@ void ModelManager::Release()
         modelInfo.model->Release();
     }
     models.clear();
+
+    if (frameConstantBuffer)
+    {
+        frameConstantBuffer->Release();
+        frameConstantBuffer = nullptr;
+    }
 }
 // 향상된 UI 렌더링 함수
 void ModelManager::RenderEnhancedUI(HWND hwnd, ID3D11Device *device, float deltaTime)
@@ -1728,6 +2141,11 @@ void ModelManager::RenderToolbar(HWND hwnd)
 
                 ImGui::Text("현재 hover된 모델: %s",
                             hoveredModelIndex >= 0 ? models[hoveredModelIndex].name.c_str() : "없음");
+                if (hoveredModelIndex >= 0)
+                {
+                    ImGui::Text("거리 %.2f, 메시 %d, 프리미티브 %d, 삼각형 %d", hoverPick.Hit.Distance,
+                                hoverPick.Hit.Mesh, hoverPick.Hit.Primitive, hoverPick.Hit.Triangle);
+                }
             }
 
             ImGui::End();
@@ -1913,17 +2331,25 @@ void ModelManager::RenderObjMaterialPropertiesEnhanced(std::shared_ptr<Model> mo
 
         EnhancedUI::RenderHeader("색상 속성");
 
+        bool materialChanged = false;
+
         // 앰비언트 색상 편집
-        EnhancedUI::ColorEdit("주변광 색상", (float *)&material.Ambient, "물체에 적용되는 기본 빛의 색상");
+        materialChanged |= EnhancedUI::ColorEdit("주변광 색상", (float *)&material.Ambient, "물체에 적용되는 기본 빛의 색상");
 
         // 디퓨즈 색상 편집
-        EnhancedUI::ColorEdit("확산광 색상", (float *)&material.Diffuse, "직접적인 빛에 반응하는 물체의 기본 색상");
+        materialChanged |= EnhancedUI::ColorEdit("확산광 색상", (float *)&material.Diffuse, "직접적인 빛에 반응하는 물체의 기본 색상");
 
         // 스페큘러 색상 편집
-        EnhancedUI::ColorEdit("반사광 색상", (float *)&material.Specular, "반짝이는 하이라이트의 색상");
+        materialChanged |= EnhancedUI::ColorEdit("반사광 색상", (float *)&material.Specular, "반짝이는 하이라이트의 색상");
 
         // 광택도 편집
-        EnhancedUI::SliderFloat("광택도", &material.Shininess, 1.0f, 128.0f, "하이라이트의 집중도. 광택도가 높을 수록 더 날카롭게 빛난다.");
+        materialChanged |= EnhancedUI::SliderFloat("광택도", &material.Shininess, 1.0f, 128.0f, "하이라이트의 집중도. 광택도가 높을 수록 더 날카롭게 빛난다.");
+
+        // 바뀐 재질은 다음에 그릴 때 상수 버퍼를 다시 올림
+        if (materialChanged)
+        {
+            material.ConstantsDirty = true;
+        }
 
         EnhancedUI::RenderHeader("Texture");
 
@@ -1949,6 +2375,7 @@ void ModelManager::RenderObjMaterialPropertiesEnhanced(std::shared_ptr<Model> mo
                     // 선택된 텍스처 로드
                     model->LoadTexture(texturePath, device, &material.DiffuseMap);
                     material.DiffuseMapPath = texturePath;
+                    material.ConstantsDirty = true; // 텍스처 유무가 바뀔 수 있음
                 }
             }
         }
@@ -1966,6 +2393,7 @@ void ModelManager::RenderObjMaterialPropertiesEnhanced(std::shared_ptr<Model> mo
                     // 선택된 텍스처 로드
                     model->LoadTexture(texturePath, device, &material.DiffuseMap);
                     material.DiffuseMapPath = texturePath;
+                    material.ConstantsDirty = true; // 텍스처 유무가 바뀔 수 있음
                 }
             }
         }
@@ -2016,17 +2444,25 @@ void ModelManager::RenderGlbMaterialPropertiesEnhanced(std::shared_ptr<GltfLoade
 
         EnhancedUI::RenderHeader("PBR 재질 속성");
 
+        bool materialChanged = false;
+
         // 베이스 컬러 편집
-        EnhancedUI::ColorEdit("베이스 컬러", (float *)&material.BaseColorFactor, "물체의 기본 색상");
+        materialChanged |= EnhancedUI::ColorEdit("베이스 컬러", (float *)&material.BaseColorFactor, "물체의 기본 색상");
 
         // 이미시브 편집
-        EnhancedUI::ColorEdit("자체발광 컬러", (float *)&material.EmissiveFactor, "물체가 자체적으로 발광하는 색상");
+        materialChanged |= EnhancedUI::ColorEdit("자체발광 컬러", (float *)&material.EmissiveFactor, "물체가 자체적으로 발광하는 색상");
 
         // 메탈릭 인자 편집
-        EnhancedUI::SliderFloat("Metallic Factor", &material.MetallicFactor, 0.0f, 1.0f, "0: Non-metal(plastic, ...), 1: Metal. It determines degree of reflection");
+        materialChanged |= EnhancedUI::SliderFloat("Metallic Factor", &material.MetallicFactor, 0.0f, 1.0f, "0: Non-metal(plastic, ...), 1: Metal. It determines degree of reflection");
 
         // 러프니스 인자 편집
-        EnhancedUI::SliderFloat("Roughness Factor", &material.RoughnessFactor, 0.0f, 1.0f, "0: Smooth(Mirror), 1: Rough(diffused). It determines fine roughness of surface.");
+        materialChanged |= EnhancedUI::SliderFloat("Roughness Factor", &material.RoughnessFactor, 0.0f, 1.0f, "0: Smooth(Mirror), 1: Rough(diffused). It determines fine roughness of surface.");
+
+        // 바뀐 재질은 다음에 그릴 때 상수 버퍼를 다시 올림
+        if (materialChanged)
+        {
+            material.ConstantsDirty = true;
+        }
 
         // 텍스처 정보 표시
         EnhancedUI::RenderHeader("Texture Map");
@@ -2144,7 +2580,7 @@ void ModelManager::RenderModelProperties(int modelIndex)
     if (modelInfo.type == MODEL_OBJ)
     {
         auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(modelInfo.model);
-        auto &objModelInfo = objWrapper->model->GetModelInfo();
+        auto &objModelInfo = objWrapper->GetInstanceInfo();
 
         // 가시성
         ImGui::Checkbox("표시", &objModelInfo.Visible);
@@ -2194,7 +2630,7 @@ void ModelManager::RenderModelProperties(int modelIndex)
     else if (modelInfo.type == MODEL_GLB)
     {
         auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(modelInfo.model);
-        auto &glbModelInfo = glbWrapper->model->GetModelInfo();
+        auto &glbModelInfo = glbWrapper->GetInstanceInfo();
 
         // 가시성
         ImGui::Checkbox("표시", &glbModelInfo.Visible);
@@ -2308,15 +2744,30 @@ void ModelManager::RenderModelProperties(int modelIndex)
             {
                 const auto &anim = animations[currentAnim];
                 ImGui::Text("시간: %.2f / %.2f", currentTime, anim.EndTime);
+
+                // CPU 애니메이션 평가 성능 측정 (결과는 디버그 출력)
+                if (ImGui::Button("성능 측정 (500개)", ImVec2(-1, 0)))
+                {
+                    glbWrapper->model->BenchmarkAnimation(500);
+                }
             }
         }
+
+        // 노드 계층 월드 행렬 갱신 성능 측정 (합성 계층, 결과는 디버그 출력)
+        if (ImGui::Button("노드 계층 성능 측정 (5000개)", ImVec2(-1, 0)))
+        {
+            GltfLoader::BenchmarkNodeHierarchy(5000);
+        }
     }
 }
 
 // 로딩 진행 상태 창 렌더링 (개선된 버전)
 void ModelManager::RenderLoadingProgress()
 {
-    std::lock_guard<std::mutex> lock(progressMutex);
+    // 취소 버튼은 진행 상태 잠금을 푼 뒤에 처리 (UpdateLoadingStatus와 잠금 순서를 맞춤)
+    std::shared_ptr<ImportProgress> cancelTarget;
+
+    std::unique_lock<std::mutex> lock(progressMutex);
 
     if (loadingProgresses.empty())
     {
@@ -2326,30 +2777,69 @@ void ModelManager::RenderLoadingProgress()
     ImGui::SetNextWindowSize(ImVec2(400, 0), ImGuiCond_Once);
     if (ImGui::Begin("모델 로딩 상태", nullptr, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_AlwaysAutoResize))
     {
-        for (const auto &progress : loadingProgresses)
+        for (size_t i = 0; i < loadingProgresses.size(); i++)
         {
-            std::string label = progress->filename;
+            const auto &progress = loadingProgresses[i];
+            const std::string &label = progress->GetFilename();
+            ImportProgress::State state = progress->GetState();
 
-            if (progress->isComplete)
+            if (state == ImportProgress::State::Complete)
             {
                 ImGui::TextColored(ImVec4(0.0f, 0.8f, 0.0f, 1.0f), "✓ %s", label.c_str());
                 ImGui::ProgressBar(1.0f, ImVec2(-1, 8), "");
                 continue;
             }
 
-            if (progress->isError)
+            if (state == ImportProgress::State::Failed)
             {
                 ImGui::TextColored(ImVec4(0.8f, 0.0f, 0.0f, 1.0f), "✗ %s", label.c_str());
                 ImGui::ProgressBar(0.0f, ImVec2(-1, 8), "");
-                ImGui::TextColored(ImVec4(0.8f, 0.0f, 0.0f, 1.0f), "오류: %s", progress->errorMessage.c_str());
+                ImGui::TextColored(ImVec4(0.8f, 0.0f, 0.0f, 1.0f), "오류: %s", progress->GetErrorMessage().c_str());
                 continue;
             }
 
-            ImGui::Text("%s", label.c_str());
-            ImGui::ProgressBar(progress->progress, ImVec2(-1, 8), "");
-        }
+            if (state == ImportProgress::State::Cancelled)
+            {
+                continue;
+            }
+
+            ImGui::PushID(static_cast<int>(i));
+            ImGui::Text("%s (%s)", label.c_str(), ImportProgress::GetPhaseName(progress->GetPhase()));
+            ImGui::SameLine();
+            if (ImGui::SmallButton("취소"))
+            {
+                cancelTarget = progress;
+            }
+            ImGui::ProgressBar(progress->GetFraction(), ImVec2(-1, 8), "");
+
+            // 단계별 작업량 (읽은 크기, 처리한 프리미티브, 디코딩한 텍스처, 업로드한 리소스)
+            ImGui::Text("%.1f MB, 프리미티브 %llu/%llu, 텍스처 %llu/%llu, 업로드 %llu/%llu",
+                        progress->GetDone(ImportProgress::Phase::Read) / (1024.0 * 1024.0),
+                        (unsigned long long)progress->GetDone(ImportProgress::Phase::Process),
+                        (unsigned long long)progress->GetTotal(ImportProgress::Phase::Process),
+                        (unsigned long long)progress->GetDone(ImportProgress::Phase::DecodeTextures),
+                        (unsigned long long)progress->GetTotal(ImportProgress::Phase::DecodeTextures),
+                        (unsigned long long)progress->GetDone(ImportProgress::Phase::Upload),
+                        (unsigned long long)progress->GetTotal(ImportProgress::Phase::Upload));
+            ImGui::PopID();
+        }
+
+        // 프레임마다 GPU 업로드에 쓰는 시간 - 남은 업로드는 다음 프레임으로 넘어감
+        ImportPipeline::Stats importStats = importPipeline.GetStats();
+        ImGui::Separator();
+        ImGui::PushItemWidth(-1);
+        EnhancedUI::SliderFloat("업로드 예산 (ms)", &uploadBudgetMilliseconds, 0.5f, 16.0f, "프레임마다 GPU 업로드에 쓰는 최대 시간");
+        ImGui::PopItemWidth();
+        ImGui::Text("업로드: 마지막 프레임 %u개 %.2f ms, 최대 %.2f ms", importStats.LastPumpItems,
+                    importStats.LastPumpMilliseconds, importStats.MaxPumpMilliseconds);
     }
     ImGui::End();
+
+    lock.unlock();
+    if (cancelTarget)
+    {
+        CancelLoad(cancelTarget);
+    }
 }
 
 // 공간 속성 렌더링 (개선된 버전)
@@ -2446,7 +2936,72 @@ void ModelManager::RenderStatusBar()
     ImGui::Begin("##statusbar", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoCollapse);
 
     // 좌측에 모델 수 표시
-    ImGui::Text("Model: %d", (int)models.size());
+    ImGui::Text("Model: %d (culled %d)", (int)models.size(), culledModelCount);
+
+    // 프레임 갱신 작업 시간 (툴팁에 작업별 시간과 실행한 스레드)
+    ImGui::SameLine();
+    ImGui::Text("| Frame tasks: %d (%.2f ms)", (int)frameTasks.GetTaskCount(), frameTasks.GetTotalMilliseconds());
+    bool frameTasksHovered = ImGui::IsItemHovered();
+
+    // 공유 작업 스케줄러 상태 (대기 중인 작업 수, 작업자 사용률)
+    ThreadPool::Stats jobStats = GetJobStats();
+    ImGui::SameLine();
+    ImGui::Text("| Jobs: %d queued, %.0f%% busy", (int)jobStats.GetQueueDepth(), jobStats.Utilization * 100.0);
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::BeginTooltip();
+        ImGui::Text("작업자 %u개 (실행 중 %d)", jobStats.ThreadCount, (int)jobStats.ActiveWorkers);
+        ImGui::Text("대기열: 높음 %d, 보통 %d, 낮음 %d", (int)jobStats.QueueDepth[0], (int)jobStats.QueueDepth[1],
+                    (int)jobStats.QueueDepth[2]);
+        ImGui::Text("실행 %llu, 훔침 %llu, 취소 %llu", (unsigned long long)jobStats.Executed,
+                    (unsigned long long)jobStats.Stolen, (unsigned long long)jobStats.Cancelled);
+
+        ImportPipeline::Stats importStats = GetImportStats();
+        ImGui::Text("가져오기 %d개 (업로드 대기 %d), 업로드 %llu개 %llu KB", (int)importStats.Active,
+                    (int)importStats.WaitingUploads, (unsigned long long)importStats.UploadedItems,
+                    (unsigned long long)(importStats.UploadedBytes / 1024));
+        ImGui::EndTooltip();
+    }
+    if (frameTasksHovered && frameTasks.GetTaskCount() > 0)
+    {
+        ImGui::BeginTooltip();
+        for (const auto &timing : frameTasks.GetTimings())
+        {
+            ImGui::Text("%-40s %7.3f ms  (+%.3f ms, 스레드 %u)", timing.Name.c_str(), timing.Milliseconds,
+                        timing.StartMilliseconds, timing.Worker);
+        }
+        ImGui::EndTooltip();
+    }
+
+    // 조명 상수 버퍼 업로드 (조명이 바뀐 프레임에만 올림)
+    if (lightManager)
+    {
+        ImGui::SameLine();
+        ImGui::Text("| Light uploads: %llu (skipped %llu)", (unsigned long long)lightManager->GetUploadCount(),
+                    (unsigned long long)lightManager->GetSkippedUploadCount());
+    }
+
+    // 상수 버퍼 업로드 (지난 프레임, 빈도별로 나누기 전 방식과 비교)
+    const ConstantBuffers::FrameStats &constantStats = ConstantBuffers::GetLastFrame();
+    ImGui::SameLine();
+    ImGui::Text("| CB uploads: %llu (%.1f KB, unsplit %llu / %.1f KB)", (unsigned long long)constantStats.GetTotalUpdates(),
+                constantStats.GetTotalBytes() / 1024.0, (unsigned long long)constantStats.LegacyUpdates,
+                constantStats.LegacyBytes / 1024.0);
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::BeginTooltip();
+        ImGui::Text("그리기 %llu회", (unsigned long long)constantStats.Draws);
+        ImGui::Text("프레임 %llu회 %llu B, 재질 %llu회 %llu B, 오브젝트 %llu회 %llu B",
+                    (unsigned long long)constantStats.Updates[ConstantBuffers::FREQUENCY_FRAME],
+                    (unsigned long long)constantStats.Bytes[ConstantBuffers::FREQUENCY_FRAME],
+                    (unsigned long long)constantStats.Updates[ConstantBuffers::FREQUENCY_MATERIAL],
+                    (unsigned long long)constantStats.Bytes[ConstantBuffers::FREQUENCY_MATERIAL],
+                    (unsigned long long)constantStats.Updates[ConstantBuffers::FREQUENCY_OBJECT],
+                    (unsigned long long)constantStats.Bytes[ConstantBuffers::FREQUENCY_OBJECT]);
+        ImGui::Text("나누기 전: %llu회 %llu B (그리기마다 전체 버퍼)", (unsigned long long)constantStats.LegacyUpdates,
+                    (unsigned long long)constantStats.LegacyBytes);
+        ImGui::EndTooltip();
+    }
 
     // 드래그 상태 정보 표시
     RenderDragStatusInfo();
@@ -2512,147 +3067,228 @@ Ray ModelManager::CreateRayFromScreenPoint(int screenX, int screenY, int screenW
     return ray;
 }
 
-// 레이와 바운딩 박스 교차 검사
-bool ModelManager::RayIntersectsBoundingBox(const Ray &ray, const BoundingBox &box)
+// 피킹용 상위 BVH 갱신
+void ModelManager::UpdatePickingBvh()
 {
-    // 간단한 구 충돌 테스트 (빠른 판단을 위해)
-    XMVECTOR rayOrigin = XMLoadFloat3(&ray.origin);
-    XMVECTOR rayDir = XMLoadFloat3(&ray.direction);
-    XMVECTOR sphereCenter = XMLoadFloat3(&box.center);
+    bool rebuild = pickingInstances.size() != models.size();
+    pickingInstances.resize(models.size());
+    pickingBounds.resize(models.size());
 
-    XMVECTOR originToCenter = XMVectorSubtract(sphereCenter, rayOrigin);
+    size_t changedCount = 0;
+    for (size_t i = 0; i < models.size(); i++)
+    {
+        const BaseModel *model = models[i].model.get();
+        PickingInstance &instance = pickingInstances[i];
 
-    // XMVECTOR normalizedOriginToCenter = XMVector3Normalize(originToCenter);
-    // XMVECTOR normalizedRayDir = XMVector3Normalize(rayDir);
+        // 월드 박스는 래퍼가 변환이 바뀐 경우만 다시 계산하므로 버전만 비교
+        uint64_t boundsVersion = model->GetBoundsVersion();
+        bool visible = model->IsVisible();
 
-    float tca = XMVectorGetX(XMVector3Dot(originToCenter, rayDir));
+        if (instance.model == model && instance.visible == visible && instance.boundsVersion == boundsVersion)
+        {
+            continue;
+        }
 
-    //std::cout << "tca: " << tca << std::endl;
-    OutputDebugStringA(("tca: " + std::to_string(tca) + "\n").c_str());
+        // 목록에서 모델이 추가/삭제되어 자리가 바뀌었으면 트리를 다시 만듦
+        if (instance.model != model)
+        {
+            rebuild = true;
+        }
 
-    // 레이가 구에서 멀리 떨어져 있는 경우
-    if (tca < 0.0f)
-        return false;
+        instance.model = model;
+        instance.boundsVersion = boundsVersion;
+        instance.visible = visible;
 
-    float d2 = XMVectorGetX(XMVector3Dot(originToCenter, originToCenter)) - tca * tca;
-    float radius2 = box.radius * box.radius;
+        // 숨긴 모델은 빈 박스로 두어 검사에서 제외
+        if (visible)
+        {
+            BoundingBox box = model->GetBoundingBox();
+            pickingBounds[i] = {box.min, box.max};
+        }
+        else
+        {
+            pickingBounds[i] = PickingBvh::EmptyBounds();
+        }
+        changedCount++;
+    }
 
-    // 레이가 구를 지나가지 않는 경우
-    if (d2 > radius2)
-        return false;
+    // 박스만 갱신하면 트리 모양이 점점 나빠지므로 많이 움직였거나 갱신이 쌓이면 다시 생성
+    if (rebuild || changedCount * 4 > models.size() || pickingRefitCount >= 256)
+    {
+        instanceBvh.Build(pickingBounds);
+        pickingRefitCount = 0;
+    }
+    else if (changedCount > 0)
+    {
+        instanceBvh.Refit(pickingBounds);
+        pickingRefitCount++;
+    }
+}
 
-    // 보다 정확한 바운딩 박스 충돌 검사
-    // AABB와 레이 충돌 계산 (슬랩 메서드)
-    XMFLOAT3 invDir = XMFLOAT3(
-        1.0f / ray.direction.x,
-        1.0f / ray.direction.y,
-        1.0f / ray.direction.z);
-
-    XMFLOAT3 t1 = XMFLOAT3(
-        (box.min.x - ray.origin.x) * invDir.x,
-        (box.min.y - ray.origin.y) * invDir.y,
-        (box.min.z - ray.origin.z) * invDir.z);
-
-    XMFLOAT3 t2 = XMFLOAT3(
-        (box.max.x - ray.origin.x) * invDir.x,
-        (box.max.y - ray.origin.y) * invDir.y,
-        (box.max.z - ray.origin.z) * invDir.z);
-
-    // min/max 교체 (invDir이 음수인 경우)
-    float tmin = max(
-        min(t1.x, t2.x),
-        max(min(t1.y, t2.y), min(t1.z, t2.z)));
-
-    float tmax = min(
-        max(t1.x, t2.x),
-        min(max(t1.y, t2.y), max(t1.z, t2.z)));
-
-    // 박스 뒤에 있거나 교차하지 않는 경우
-    if (tmax < 0.0f || tmin > tmax)
-        return false;
+// 모델 선택 (레이캐스팅 사용)
+ModelManager::PickResult ModelManager::PickModel(const Ray &ray)
+{
+    UpdatePickingBvh();
 
-    // 교차 발생
-    return true;
+    // 레이가 지나가는 인스턴스 박스를 가까운 순서로 방문하고, 찾은 교차보다 먼 박스는 건너뜀
+    PickResult result;
+    instanceBvh.Raycast(ray.origin, ray.direction, result.Hit.Distance, [&](uint32_t item, float &closest)
+                        {
+                            RayHit hit;
+                            hit.Distance = closest;
+                            if (models[item].model->Raycast(ray, hit))
+                            {
+                                result.ModelIndex = static_cast<int>(item);
+                                result.Hit = hit;
+                                closest = hit.Distance;
+                            }
+                        });
+
+    return result;
 }
 
-// 모델 선택 (레이캐스팅 사용)
-int ModelManager::PickModel(const Ray &ray)
+// hover 피킹 성능 측정
+void ModelManager::BenchmarkPicking(size_t instanceCount, size_t rayCount)
 {
-    // 테스트 모드: GLB 모델 우선 선택
-    bool testMode = false; // 테스트 모드 비활성화
-    if (testMode)
+    if (models.empty() || instanceCount == 0)
     {
-        // 가장 가까운 GLB 모델 찾기
-        float closestDist = FLT_MAX;
-        int closestGlbIndex = -1;
-
-        for (int i = 0; i < models.size(); i++)
-        {
-            if (models[i].type == MODEL_GLB)
-            {
-                XMFLOAT3 cameraPos = camera.GetPosition();
+        OutputDebugStringA("Picking benchmark: 측정할 모델을 먼저 불러오세요.\n");
+        return;
+    }
 
-                XMFLOAT3 modelPos = models[i].model->GetPosition();
-                XMVECTOR modelPosVec = XMLoadFloat3(&modelPos);
-                XMVECTOR cameraPosVec = XMLoadFloat3(&cameraPos);
-                XMVECTOR distVec = XMVectorSubtract(modelPosVec, cameraPosVec);
-                float dist = XMVectorGetX(XMVector3Length(distVec));
+    // 첫 번째 모델의 에셋을 공유하는 인스턴스를 격자로 배치 (간격은 에셋 크기 기준)
+    const ModelInfo &source = models[0];
+    BoundingBox sourceBounds = source.model->GetBoundingBox();
+    float spacing = (std::max)((std::max)(sourceBounds.max.x - sourceBounds.min.x, sourceBounds.max.z - sourceBounds.min.z), 0.1f) * 1.5f;
+    size_t gridSize = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(instanceCount))));
+    float gridExtent = gridSize * spacing * 0.5f;
 
-                if (dist < closestDist)
-                {
-                    closestDist = dist;
-                    closestGlbIndex = i;
-                }
-            }
+    std::vector<ModelInfo> benchmarkModels;
+    benchmarkModels.reserve(instanceCount);
+    for (size_t i = 0; i < instanceCount; i++)
+    {
+        ModelInfo info = source;
+        XMFLOAT3 position((i % gridSize) * spacing - gridExtent, 0.0f, (i / gridSize) * spacing - gridExtent);
+        XMFLOAT3 rotation(0.0f, static_cast<float>((i * 37) % 360), 0.0f);
+        if (source.type == MODEL_OBJ)
+        {
+            auto wrapper = std::make_shared<ObjModelWrapper>(std::static_pointer_cast<ObjModelWrapper>(source.model)->model);
+            wrapper->InitializeInstance();
+            wrapper->GetInstanceInfo().Position = position;
+            wrapper->GetInstanceInfo().Rotation = rotation;
+            info.model = wrapper;
         }
-
-        // GLB 모델이 있으면 해당 모델 선택, 없으면 기존 로직 실행
-        if (closestGlbIndex >= 0)
+        else
         {
-            OutputDebugStringA(("테스트 모드: GLB 모델 " + std::to_string(closestGlbIndex) + " 선택됨\n").c_str());
-            return closestGlbIndex;
+            auto wrapper = std::make_shared<GlbModelWrapper>(std::static_pointer_cast<GlbModelWrapper>(source.model)->model);
+            wrapper->InitializeInstance();
+            wrapper->GetInstanceInfo().Position = position;
+            wrapper->GetInstanceInfo().Rotation = rotation;
+            info.model = wrapper;
         }
+        benchmarkModels.push_back(info);
     }
-    int pickedModelIndex = -1;
-    float closestDistance = FLT_MAX;
 
-    for (int i = 0; i < models.size(); i++)
+    // 측정하는 동안만 모델 목록을 바꿔 끼우고 피킹 상태는 처음부터 다시 만듦
+    std::swap(models, benchmarkModels);
+    pickingInstances.clear();
+
+    auto elapsed = [](std::chrono::high_resolution_clock::time_point start)
     {
-        BoundingBox box = models[i].model->GetBoundingBox();
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
 
-        // 각 모델의 바운딩 박스 정보 로그
-        std::string modelType = (models[i].type == MODEL_GLB) ? "GLB" : "OBJ";
-        /*OutputDebugStringA(("모델 [" + std::to_string(i) + "] " + modelType +
-                            " - 중심: " + std::to_string(box.center.x) + "," +
-                            std::to_string(box.center.y) + "," + std::to_string(box.center.z) +
-                            " - 반지름: " + std::to_string(box.radius) + "\n")
-                               .c_str());*/
+    auto buildStart = std::chrono::high_resolution_clock::now();
+    UpdatePickingBvh();
+    double buildMs = elapsed(buildStart);
+    size_t nodeCount = instanceBvh.GetNodeCount();
 
-        std::cout << "모델 [" << i << "] " << modelType
-                  << " - 중심: " << box.center.x << "," << box.center.y << "," << box.center.z
-                  << " - 반지름: " << box.radius << std::endl;
+    // 변환이 바뀌지 않았을 때 갱신 확인 비용 (hover마다 실행)
+    auto checkStart = std::chrono::high_resolution_clock::now();
+    UpdatePickingBvh();
+    double checkMs = elapsed(checkStart);
 
-        if (RayIntersectsBoundingBox(ray, box))
-        {
+    // 모델 하나를 드래그할 때의 갱신 비용 (월드 박스 하나 + 노드 박스 갱신)
+    std::shared_ptr<BaseModel> dragged = models[instanceCount / 2].model;
+    XMFLOAT3 draggedPosition = dragged->GetPosition();
+    draggedPosition.x += spacing * 0.25f;
+    if (source.type == MODEL_OBJ)
+    {
+        std::static_pointer_cast<ObjModelWrapper>(dragged)->GetInstanceInfo().Position = draggedPosition;
+    }
+    else
+    {
+        std::static_pointer_cast<GlbModelWrapper>(dragged)->GetInstanceInfo().Position = draggedPosition;
+    }
+    auto refitStart = std::chrono::high_resolution_clock::now();
+    UpdatePickingBvh();
+    double refitMs = elapsed(refitStart);
 
-            /*OutputDebugStringA(("모델 [" + std::to_string(i) + "] 와 충돌 감지\n").c_str());*/
-            std::cout << "모델 [" << i << "] 와 충돌 감지" << std::endl;
+    // 격자 위 카메라 높이에서 격자 안의 임의의 점을 향하는 레이
+    std::mt19937 random(12345);
+    std::uniform_real_distribution<float> offset(-gridExtent, gridExtent);
+    std::vector<Ray> rays(rayCount);
+    for (auto &ray : rays)
+    {
+        XMVECTOR origin = XMVectorSet(offset(random) * 0.5f, gridExtent * 0.5f + 2.0f, -gridExtent - 2.0f, 1.0f);
+        XMVECTOR target = XMVectorSet(offset(random), 0.0f, offset(random), 1.0f);
+        XMStoreFloat3(&ray.origin, origin);
+        XMStoreFloat3(&ray.direction, XMVector3Normalize(XMVectorSubtract(target, origin)));
+    }
 
-            // 충돌 거리 계산 (카메라에서 모델 중심까지의 거리)
-            XMVECTOR rayOrigin = XMLoadFloat3(&ray.origin);
-            XMVECTOR center = XMLoadFloat3(&box.center);
-            XMVECTOR distVec = XMVectorSubtract(center, rayOrigin);
-            float distance = XMVectorGetX(XMVector3Length(distVec));
+    // BVH 피킹 (hover와 같은 경로)
+    std::vector<PickResult> results(rayCount);
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+    size_t hitCount = 0;
+    for (size_t i = 0; i < rayCount; i++)
+    {
+        auto pickStart = std::chrono::high_resolution_clock::now();
+        results[i] = PickModel(rays[i]);
+        double pickMs = elapsed(pickStart);
+        totalMs += pickMs;
+        maxMs = (std::max)(maxMs, pickMs);
+        hitCount += results[i].ModelIndex >= 0 ? 1 : 0;
+    }
 
-            if (distance < closestDistance)
+    // 비교 기준: 모든 인스턴스를 정확히 검사 (오래 걸리므로 레이 일부만)
+    size_t linearRayCount = (std::min)(rayCount, static_cast<size_t>(50));
+    size_t mismatchCount = 0;
+    auto linearStart = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < linearRayCount; i++)
+    {
+        PickResult linear;
+        for (size_t m = 0; m < models.size(); m++)
+        {
+            if (models[m].model->Raycast(rays[i], linear.Hit))
             {
-                closestDistance = distance;
-                pickedModelIndex = i;
+                linear.ModelIndex = static_cast<int>(m);
             }
         }
+        // 다른 모델을 골랐거나 교차 거리가 다르면 불일치 (거리 허용 오차는 거리에 비례, 둘 다 빗나가면 같은 초기값)
+        float distanceEpsilon = 1e-4f * (std::max)(1.0f, linear.Hit.Distance);
+        if (linear.ModelIndex != results[i].ModelIndex ||
+            std::fabs(linear.Hit.Distance - results[i].Hit.Distance) > distanceEpsilon)
+        {
+            mismatchCount++;
+        }
     }
+    double linearMs = linearRayCount > 0 ? elapsed(linearStart) / linearRayCount : 0.0;
 
-    return pickedModelIndex;
+    std::swap(models, benchmarkModels);
+    pickingInstances.clear();
+
+    double averageMs = rayCount > 0 ? totalMs / rayCount : 0.0;
+    OutputDebugStringA(("Picking benchmark: " + std::to_string(instanceCount) + " instances of " + source.name +
+                        ", " + std::to_string(rayCount) + " rays\n" +
+                        "  top-level BVH build " + std::to_string(buildMs) + " ms (" + std::to_string(nodeCount) +
+                        " nodes), unchanged check " + std::to_string(checkMs) + " ms, one moved " + std::to_string(refitMs) + " ms\n" +
+                        "  hover pick avg " + std::to_string(averageMs * 1000.0) + " us, max " + std::to_string(maxMs * 1000.0) +
+                        " us, hits " + std::to_string(hitCount) + "\n" +
+                        "  exact linear scan avg " + std::to_string(linearMs * 1000.0) + " us (" +
+                        std::to_string(linearMs / (std::max)(averageMs, 1e-6)) + "x), mismatches " +
+                        std::to_string(mismatchCount) + "/" + std::to_string(linearRayCount) + "\n")
+                           .c_str());
 }
 
 // 레이와 평면의 교차점 계산
@@ -2697,43 +3333,6 @@ void ModelManager::OnMouseDown(int x, int y, HWND hwnd)
     if (!(GetAsyncKeyState(VK_LBUTTON) & 0x8000))
         return;
 
-    // GLB 모델 정보 출력
-    OutputDebugStringA("== GLB 모델 정보 ==\n");
-    for (int i = 0; i < models.size(); i++)
-    {
-        if (models[i].type == MODEL_GLB)
-        {
-            auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(models[i].model);
-            XMFLOAT3 pos = glbWrapper->GetPosition();
-            BoundingBox box = glbWrapper->GetBoundingBox();
-
-            OutputDebugStringA(("GLB 모델 [" + std::to_string(i) + "] - " + models[i].name + "\n").c_str());
-            OutputDebugStringA(("  위치: " + std::to_string(pos.x) + "," +
-                                std::to_string(pos.y) + "," + std::to_string(pos.z) + "\n")
-                                   .c_str());
-            OutputDebugStringA(("  바운딩 박스 중심: " + std::to_string(box.center.x) + "," +
-                                std::to_string(box.center.y) + "," + std::to_string(box.center.z) + "\n")
-                                   .c_str());
-            OutputDebugStringA(("  바운딩 박스 반지름: " + std::to_string(box.radius) + "\n").c_str());
-        }
-    }
-
-    OutputDebugStringA(("총 모델 수: " + std::to_string(models.size()) + "\n").c_str());
-
-    for (int i = 0; i < models.size(); i++)
-    {
-        std::string modelType = (models[i].type == MODEL_GLB) ? "GLB" : "OBJ";
-        OutputDebugStringA(("모델 [" + std::to_string(i) + "] - 타입: " + modelType +
-                            " - 이름: " + models[i].name + "\n")
-                               .c_str());
-
-        // 위치 정보도 출력
-        XMFLOAT3 pos = models[i].model->GetPosition();
-        OutputDebugStringA(("  위치: " + std::to_string(pos.x) + "," +
-                            std::to_string(pos.y) + "," + std::to_string(pos.z) + "\n")
-                               .c_str());
-    }
-
     // 현재 윈도우 크기 가져오기
     RECT rect;
     GetClientRect(hwnd, &rect);
@@ -2768,10 +3367,17 @@ void ModelManager::OnMouseDown(int x, int y, HWND hwnd)
     OutputDebugStringA(("마우스 클릭: X=" + std::to_string(x) + ", Y=" + std::to_string(y) + "\n").c_str());
 
     // 레이와 충돌하는 모델 찾기
-    draggedModelIndex = PickModel(ray);
+    PickResult pick = PickModel(ray);
+    draggedModelIndex = pick.ModelIndex;
 
     // 모델 선택 결과 로그
     OutputDebugStringA(("선택된 모델 인덱스: " + std::to_string(draggedModelIndex) + "\n").c_str());
+    if (pick.ModelIndex >= 0)
+    {
+        OutputDebugStringA(("  거리: " + std::to_string(pick.Hit.Distance) + ", 메시: " + std::to_string(pick.Hit.Mesh) +
+                            ", 프리미티브: " + std::to_string(pick.Hit.Primitive) + ", 삼각형: " + std::to_string(pick.Hit.Triangle) + "\n")
+                               .c_str());
+    }
 
     // 모델이 선택된 경우 드래그 시작
     if (draggedModelIndex >= 0)
@@ -2809,25 +3415,6 @@ void ModelManager::OnMouseDown(int x, int y, HWND hwnd)
         dragStartIntersectPos = GetPlaneIntersectionPoint(ray, dragPlaneNormal, dragPlaneD);
         currentIntersectPos = dragStartIntersectPos;
     }
-
-    // 모든 모델의 바운딩 박스 정보 출력
-    OutputDebugStringA("=== 바운딩 박스 디버깅 ===\n");
-    for (int i = 0; i < models.size(); i++)
-    {
-        BoundingBox box = models[i].model->GetBoundingBox();
-        XMFLOAT3 position = models[i].model->GetPosition();
-        
-        OutputDebugStringA(("모델 [" + std::to_string(i) + "] " + models[i].name + "\n").c_str());
-        OutputDebugStringA(("  실제 위치: (" + std::to_string(position.x) + ", " + 
-                            std::to_string(position.y) + ", " + std::to_string(position.z) + ")\n").c_str());
-        OutputDebugStringA(("  바운딩 박스 중심: (" + std::to_string(box.center.x) + ", " + 
-                            std::to_string(box.center.y) + ", " + std::to_string(box.center.z) + ")\n").c_str());
-        OutputDebugStringA(("  바운딩 박스 크기: Min(" + std::to_string(box.min.x) + ", " + 
-                            std::to_string(box.min.y) + ", " + std::to_string(box.min.z) + 
-                            ") Max(" + std::to_string(box.max.x) + ", " + 
-                            std::to_string(box.max.y) + ", " + std::to_string(box.max.z) + ")\n").c_str());
-        OutputDebugStringA(("  반지름: " + std::to_string(box.radius) + "\n").c_str());
-    }
 }
 
 // OnMouseHover 함수 구현 (기존 OnMouseMove 함수 근처에 추가)
@@ -2857,7 +3444,8 @@ void ModelManager::OnMouseHover(int x, int y, HWND hwnd)
     Ray ray = CreateRayFromScreenPoint(x, y, screenWidth, screenHeight);
 
     // 레이와 충돌하는 모델 찾기
-    int newHoveredIndex = PickModel(ray);
+    hoverPick = PickModel(ray);
+    int newHoveredIndex = hoverPick.ModelIndex;
 
     // hover 상태가 변경된 경우에만 업데이트
     if (newHoveredIndex != hoveredModelIndex)
@@ -2935,12 +3523,12 @@ void ModelManager::OnMouseMove(int x, int y, HWND hwnd)
         if (models[draggedModelIndex].type == MODEL_OBJ)
         {
             auto objWrapper = std::static_pointer_cast<ObjModelWrapper>(models[draggedModelIndex].model);
-            objWrapper->model->GetModelInfo().Position = newPosition;
+            objWrapper->GetInstanceInfo().Position = newPosition;
         }
         else
         {
             auto glbWrapper = std::static_pointer_cast<GlbModelWrapper>(models[draggedModelIndex].model);
-            glbWrapper->model->GetModelInfo().Position = newPosition;
+            glbWrapper->GetInstanceInfo().Position = newPosition;
         }
     }
 }
@@ -1,15 +1,25 @@
 #pragma once
+#include "AssetRegistry.h"
+#include "BoundingVolumes.h"
 #include "Camera.h"
 #include "Common.h"
+#include "ConstantBuffers.h"
 #include "DummyCharacter.h" // 추가
 #include "EnhancedUI.h"
 #include "GltfLoader.h" // GLB 로더 헤더 포함
+#include "ImportPipeline.h"
+#include "ImportProgress.h"
 #include "LightManager.h"
+#include "MeshCache.h"
 #include "Model.h"
+#include "PickingBvh.h"
 #include "RoomModel.h"
+#include "TaskGraph.h"
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <d3d11.h>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -36,16 +46,6 @@ struct Ray
     XMFLOAT3 direction;
 };
 
-// 로딩 진행 상태를 표시하기 위한 구조체
-struct LoadingProgress
-{
-    std::string filename;
-    float progress;
-    bool isComplete;
-    bool isError;
-    std::string errorMessage;
-};
-
 // 베이스 모델 인터페이스
 class BaseModel
 {
@@ -64,7 +64,20 @@ public:
     virtual void SetScale(const XMFLOAT3 &scale) = 0;
     virtual void SetVisibility(bool visible) = 0;
 
+    // 월드 바운딩 볼륨 - 에셋 로컬 박스에 인스턴스 변환을 적용 (변환이나 로컬 박스가 바뀐 경우만 다시 계산)
+    // 피킹, 시야 절두체 컬링, 캐릭터 충돌이 모두 같은 박스를 사용
     virtual BoundingBox GetBoundingBox() const = 0;
+    virtual OrientedBoundingBox GetOrientedBoundingBox() const = 0;
+
+    // 월드 바운딩 볼륨을 다시 계산할 때마다 증가 (복사해 둔 박스가 최신인지 비교용)
+    virtual uint64_t GetBoundsVersion() const = 0;
+
+    // 피킹 - 메시 삼각형 교차 검사
+    virtual bool Raycast(const Ray &ray, RayHit &hit) const = 0;
+
+    // 그릴 때만 적용하는 인스턴스 재질 덮어쓰기 (공유 에셋의 재질은 바꾸지 않음)
+    virtual void SetMaterialOverride(const MaterialOverride &materialOverride) = 0;
+
     // 추가 렌더링 함수 - 조명 관리자 지원
     virtual void Render(ID3D11DeviceContext *deviceContext, const Camera &camera, LightManager *lightManager)
     {
@@ -73,103 +86,131 @@ public:
     }
 };
 
-// OBJ 모델 래퍼 클래스
+// OBJ 모델 인스턴스 클래스
+// 메시/재질은 AssetRegistry가 나눠주는 공유 에셋을 참조하고, 변환과 표시 여부만 인스턴스별로 가짐
 class ObjModelWrapper : public BaseModel
 {
 public:
-    ObjModelWrapper() : model(std::make_shared<Model>()) {}
-    ~ObjModelWrapper() override { model->Release(); }
+    explicit ObjModelWrapper(std::shared_ptr<Model> asset) : model(std::move(asset)) {}
 
     void Render(ID3D11DeviceContext *deviceContext, const Camera &camera) override
     {
         // 조명없는 기본호출
-        model->Render(deviceContext, camera, nullptr);
+        if (model)
+            model->Render(deviceContext, camera, nullptr, instanceInfo);
     }
 
     // 조명 관리자를 지원하는 확장 렌더링 함수
     void Render(ID3D11DeviceContext *deviceContext, const Camera &camera, LightManager *lightManager)
     {
-        model->Render(deviceContext, camera, lightManager);
+        if (model)
+            model->Render(deviceContext, camera, lightManager, instanceInfo);
     }
-    void Release() override { model->Release(); }
+
+    // 공유 에셋 참조만 놓음 (마지막 인스턴스가 놓으면 에셋 소멸자에서 리소스 해제)
+    void Release() override { model.reset(); }
+
+    // 로드된 에셋의 기본 배치(자동 크기 조정 결과)로 인스턴스 초기화
+    void InitializeInstance() { instanceInfo = model->GetModelInfo(); }
+
+    // 인스턴스 변환/표시 여부
+    Model::ModelInfo &GetInstanceInfo() { return instanceInfo; }
 
     XMFLOAT3 GetPosition() const override
     {
-        return model->GetModelInfo().Position;
+        return instanceInfo.Position;
     }
 
     XMFLOAT3 GetRotation() const override
     {
-        return model->GetModelInfo().Rotation;
+        return instanceInfo.Rotation;
     }
 
     XMFLOAT3 GetScale() const override
     {
-        return model->GetModelInfo().Scale;
+        return instanceInfo.Scale;
     }
 
     bool IsVisible() const
     {
-        return model->GetModelInfo().Visible;
+        return instanceInfo.Visible;
     }
 
     void SetPosition(const XMFLOAT3 &position) override
     {
-        model->GetModelInfo().Position = position;
+        instanceInfo.Position = position;
     }
 
     void SetRotation(const XMFLOAT3 &rotation) override
     {
-        model->GetModelInfo().Rotation = rotation;
+        instanceInfo.Rotation = rotation;
     }
 
     void SetScale(const XMFLOAT3 &scale) override
     {
-        model->GetModelInfo().Scale = scale;
+        instanceInfo.Scale = scale;
     }
 
     void SetVisibility(bool visible) override
     {
-        model->GetModelInfo().Visible = visible;
+        instanceInfo.Visible = visible;
     }
 
     BoundingBox GetBoundingBox() const override
     {
-        // 모델의 바운딩 박스 계산 (실제 구현에서는 모델 데이터 기반으로 계산)
-        BoundingBox box;
-        XMFLOAT3 pos = model->GetModelInfo().Position;
-        XMFLOAT3 scale = model->GetModelInfo().Scale;
-        float size = 1.0f; // 기본 크기 (실제 모델에 맞게 조정 필요)
+        UpdateBounds();
+        return bounds.GetWorld();
+    }
 
-        box.min = XMFLOAT3(
-            pos.x - size * scale.x,
-            pos.y - size * scale.y,
-            pos.z - size * scale.z);
+    OrientedBoundingBox GetOrientedBoundingBox() const override
+    {
+        UpdateBounds();
+        return bounds.GetOriented();
+    }
 
-        box.max = XMFLOAT3(
-            pos.x + size * scale.x,
-            pos.y + size * scale.y,
-            pos.z + size * scale.z);
+    uint64_t GetBoundsVersion() const override
+    {
+        UpdateBounds();
+        return bounds.GetVersion();
+    }
 
-        box.center = pos;
-        box.radius = size * max(max(scale.x, scale.y), scale.z);
+    bool Raycast(const Ray &ray, RayHit &hit) const override
+    {
+        return model && instanceInfo.Visible && model->Raycast(ray.origin, ray.direction, instanceInfo, hit);
+    }
 
-        return box;
+    void SetMaterialOverride(const MaterialOverride &materialOverride) override
+    {
+        instanceInfo.Override = materialOverride;
     }
 
     std::shared_ptr<Model> model;
+
+private:
+    // 원점 기준 에셋 박스로 월드 박스 캐시 갱신
+    void UpdateBounds() const
+    {
+        if (model)
+        {
+            bounds.Update(model->GetBoundingBox(), instanceInfo.Position, instanceInfo.Rotation, instanceInfo.Scale);
+        }
+    }
+
+    Model::ModelInfo instanceInfo;
+    mutable InstanceBounds bounds;
 };
 
-// GLB 모델 래퍼 클래스
+// GLB 모델 인스턴스 클래스
+// 메시/재질/애니메이션은 AssetRegistry가 나눠주는 공유 에셋을 참조하고, 변환과 표시 여부만 인스턴스별로 가짐
 class GlbModelWrapper : public BaseModel
 {
 public:
-    GlbModelWrapper() : model(std::make_shared<GltfLoader>()) {}
-    ~GlbModelWrapper() override { model->Release(); }
+    explicit GlbModelWrapper(std::shared_ptr<GltfLoader> asset) : model(std::move(asset)) {}
 
     void Render(ID3D11DeviceContext *deviceContext, const Camera &camera) override
     {
-        model->Render(deviceContext, camera);
+        if (model)
+            model->Render(deviceContext, camera, instanceInfo);
     }
 
     // 추가: 조명 지원 렌더링 함수 오버라이드
@@ -178,39 +219,47 @@ public:
         if (model && lightManager)
         {
             // 조명 정보를 GLB 모델 렌더링에 전달
-            model->Render(deviceContext, camera, lightManager);
+            model->Render(deviceContext, camera, lightManager, instanceInfo);
         }
-        else
+        else if (model)
         {
             // 조명 관리자가 없으면 기본 렌더링 사용
-            model->Render(deviceContext, camera);
+            model->Render(deviceContext, camera, instanceInfo);
         }
     }
-    void Release() override { model->Release(); }
+
+    // 공유 에셋 참조만 놓음 (마지막 인스턴스가 놓으면 에셋 소멸자에서 리소스 해제)
+    void Release() override { model.reset(); }
+
+    // 로드된 에셋의 기본 배치(자동 크기 조정 결과)로 인스턴스 초기화
+    void InitializeInstance() { instanceInfo = model->GetModelInfo(); }
+
+    // 인스턴스 변환/표시 여부
+    GltfLoader::ModelInfo &GetInstanceInfo() { return instanceInfo; }
 
     XMFLOAT3 GetPosition() const override
     {
-        return model->GetModelInfo().Position;
+        return instanceInfo.Position;
     }
 
     XMFLOAT3 GetRotation() const override
     {
-        return model->GetModelInfo().Rotation;
+        return instanceInfo.Rotation;
     }
 
     XMFLOAT3 GetScale() const override
     {
-        return model->GetModelInfo().Scale;
+        return instanceInfo.Scale;
     }
 
     bool IsVisible() const
     {
-        return model->GetModelInfo().Visible;
+        return instanceInfo.Visible;
     }
 
     void SetPosition(const XMFLOAT3 &position) override
     {
-        model->GetModelInfo().Position = position;
+        instanceInfo.Position = position;
 
         OutputDebugStringA(("GLB 모델 위치 설정: " + std::to_string(position.x) + "," +
                             std::to_string(position.y) + "," + std::to_string(position.z) + "\n")
@@ -219,44 +268,61 @@ public:
 
     void SetRotation(const XMFLOAT3 &rotation) override
     {
-        model->GetModelInfo().Rotation = rotation;
+        instanceInfo.Rotation = rotation;
     }
 
     void SetScale(const XMFLOAT3 &scale) override
     {
-        model->GetModelInfo().Scale = scale;
+        instanceInfo.Scale = scale;
     }
 
     void SetVisibility(bool visible) override
     {
-        model->GetModelInfo().Visible = visible;
+        instanceInfo.Visible = visible;
     }
 
     BoundingBox GetBoundingBox() const override
     {
-        // 모델의 바운딩 박스 계산 (실제 구현에서는 모델 데이터 기반으로 계산)
-        BoundingBox box;
-        XMFLOAT3 pos = model->GetModelInfo().Position;
-        XMFLOAT3 scale = model->GetModelInfo().Scale;
-        float size = 1.0f; // 기본 크기 (실제 모델에 맞게 조정 필요)
+        UpdateBounds();
+        return bounds.GetWorld();
+    }
 
-        box.min = XMFLOAT3(
-            pos.x - size * scale.x,
-            pos.y - size * scale.y,
-            pos.z - size * scale.z);
+    OrientedBoundingBox GetOrientedBoundingBox() const override
+    {
+        UpdateBounds();
+        return bounds.GetOriented();
+    }
 
-        box.max = XMFLOAT3(
-            pos.x + size * scale.x,
-            pos.y + size * scale.y,
-            pos.z + size * scale.z);
+    uint64_t GetBoundsVersion() const override
+    {
+        UpdateBounds();
+        return bounds.GetVersion();
+    }
 
-        box.center = pos;
-        box.radius = size * max(max(scale.x, scale.y), scale.z);
+    bool Raycast(const Ray &ray, RayHit &hit) const override
+    {
+        return model && instanceInfo.Visible && model->Raycast(ray.origin, ray.direction, instanceInfo, hit);
+    }
 
-        return box;
+    void SetMaterialOverride(const MaterialOverride &materialOverride) override
+    {
+        instanceInfo.Override = materialOverride;
     }
 
     std::shared_ptr<GltfLoader> model;
+
+private:
+    // 현재 애니메이션 포즈의 에셋 박스로 월드 박스 캐시 갱신 (포즈가 바뀌면 로컬 박스가 달라져서 다시 계산)
+    void UpdateBounds() const
+    {
+        if (model)
+        {
+            bounds.Update(model->GetAnimatedBounds(), instanceInfo.Position, instanceInfo.Rotation, instanceInfo.Scale);
+        }
+    }
+
+    GltfLoader::ModelInfo instanceInfo;
+    mutable InstanceBounds bounds;
 };
 
 class ModelManager
@@ -266,6 +332,16 @@ public:
     ModelManager();
     ~ModelManager();
     void DragSelectedModel(int x, int y, HWND hwnd);
+
+    // 저장된 인스턴스 배치 (레이아웃 복원 시 로드가 끝나면 이 변환으로 인스턴스를 만듦)
+    struct InstancePlacement
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Rotation;
+        XMFLOAT3 Scale;
+        bool Visible = true;
+    };
+
     // 모델 추가 함수들 - OBJ 및 GLB 지원
     void AddModel(const std::string &path, ID3D11Device *device);
     void AddModelAsync(const std::string &path);
@@ -273,8 +349,18 @@ public:
     // 특정 타입의 모델 추가 (OBJ/GLB)
     void AddObjModel(const std::string &path, ID3D11Device *device);
     void AddGlbModel(const std::string &path, ID3D11Device *device);
-    void AddObjModelAsync(const std::string &path);
-    void AddGlbModelAsync(const std::string &path);
+    // placements가 있으면 파일을 한 번만 로드하고 배치마다 인스턴스를 추가 (없으면 기본 배치로 하나)
+    // 제출한 순서대로 로드를 시작하므로 먼저 보여야 하는 파일을 먼저 제출
+    // batch는 함께 유지하거나 취소할 요청 묶음 번호 (BeginLoadBatch로 받음, 0은 묶지 않음)
+    void AddObjModelAsync(const std::string &path, const std::vector<InstancePlacement> &placements = {}, uint32_t batch = 0);
+    void AddGlbModelAsync(const std::string &path, const std::vector<InstancePlacement> &placements = {}, uint32_t batch = 0);
+
+    // 배치를 하나씩 읽으면서 추가할 때 사용 - 같은 batch에서 같은 파일의 로드가 아직 끝나지 않았으면 그 요청에 배치만 붙이고 없으면 로드 시작
+    void AddModelInstanceAsync(const std::string &path, ModelType type, const InstancePlacement &placement, uint32_t batch);
+
+    // 새 요청 묶음 번호 / 묶음의 요청만 취소 (배치 파일을 읽다가 실패하면 읽는 동안 시작한 로드만 취소)
+    uint32_t BeginLoadBatch() { return ++lastLoadBatch; }
+    void CancelLoadBatch(uint32_t batch);
 
     // 조명 관리자 관련 함수
     void InitLightManager(ID3D11Device *device);
@@ -298,6 +384,11 @@ public:
     // 로딩 상태 업데이트
     void UpdateLoadingStatus();
 
+    // 로딩 중인 모델 취소 (같은 파일을 기다리는 요청도 함께 취소)
+    // 진행 중인 작업은 다음 확인 지점에서 멈추고, 요청이 정리되면 처리한 데이터가 해제됨
+    void CancelLoad(const std::shared_ptr<ImportProgress> &progress);
+    void CancelLoads();
+
     // RoomModel 관련 함수
     void SetRoomModel(std::shared_ptr<RoomModel> room) { roomModel = room; }
     std::shared_ptr<RoomModel> GetRoomModel() const { return roomModel; }
@@ -327,10 +418,17 @@ public:
     void OnMouseUp(int x, int y);
     void OnMouseHover(int x, int y, HWND hwnd);
 
+    // 피킹 결과 (가장 가까운 모델과 교차한 메시 삼각형)
+    struct PickResult
+    {
+        int ModelIndex = -1;
+        RayHit Hit;
+    };
+
     // 레이캐스팅 관련 함수들
     Ray CreateRayFromScreenPoint(int screenX, int screenY, int screenWidth, int screenHeight);
-    int PickModel(const Ray &ray);
-    bool RayIntersectsBoundingBox(const Ray &ray, const BoundingBox &box);
+    // 인스턴스 월드 박스 BVH로 후보를 좁히고 에셋 삼각형 BVH로 정확한 교차 검사 (숨긴 모델은 제외)
+    PickResult PickModel(const Ray &ray);
     XMFLOAT3 GetPlaneIntersectionPoint(const Ray &ray, const XMFLOAT3 &planeNormal, float planeD);
     // 드래그 축 제한 enum
 
@@ -367,8 +465,19 @@ public:
         std::string path;
     };
 
-    void ClearModels()
+    // keepBatch가 있으면 그 묶음의 로딩 요청은 남김 (읽으면서 시작한 새 배치의 로드)
+    void ClearModels(uint32_t keepBatch = 0)
     {
+        // 다른 배치를 불러오기 전에 아직 로딩 중인 모델도 취소
+        if (keepBatch == 0)
+        {
+            CancelLoads();
+        }
+        else
+        {
+            CancelLoadsExcept(keepBatch);
+        }
+
         for (size_t i = 0; i < this->models.size(); ++i)
         {
             RemoveModel(static_cast<int>(i));
@@ -379,6 +488,28 @@ public:
     // Getter & Setter
     std::vector<ModelInfo> GetModels() { return this->models; }
 
+    // 메시 캐시 통계 (적중/실패/저장/제거 횟수, 디스크 사용량)
+    MeshCache::Stats GetMeshCacheStats() const { return meshCache.GetStats(); }
+
+    // 텍스처 캐시 통계
+    MeshCache::Stats GetTextureCacheStats() const { return textureCache.GetStats(); }
+
+    // 공유 에셋 통계 (에셋/인스턴스 수, 공유로 절약한 메모리)
+    AssetRegistry::Stats GetAssetStats() const { return assetRegistry.GetStats(); }
+
+    // 공유 작업 스케줄러 진단 정보 (대기열 깊이, 작업자 사용률)
+    ThreadPool::Stats GetJobStats() const { return ThreadPool::GetShared().GetStats(); }
+
+    // 마지막 프레임 갱신 작업 그래프 (작업별 시간은 상태 표시줄 툴팁에 표시)
+    const TaskGraph &GetFrameTasks() const { return frameTasks; }
+
+    // GLB 가져오기 파이프라인 진단 정보 (진행 중인 가져오기, 프레임별 업로드 시간)
+    ImportPipeline::Stats GetImportStats() const { return importPipeline.GetStats(); }
+
+    // 프레임마다 GPU 업로드에 쓰는 시간 (ms) - 예산을 넘으면 남은 업로드는 다음 프레임으로 넘어감
+    float GetUploadBudget() const { return uploadBudgetMilliseconds; }
+    void SetUploadBudget(float milliseconds) { uploadBudgetMilliseconds = (std::max)(milliseconds, 0.0f); }
+
     void SetModels(int index, const XMFLOAT3 &position, const XMFLOAT3 &rotation, 
         const XMFLOAT3 &scale, bool visible)
     {
@@ -394,6 +525,10 @@ public:
     void SetHoverEnabled(bool enabled) { isHoverEnabled = enabled; }
     bool IsHoverEnabled() const { return isHoverEnabled; }
     int GetHoveredModelIndex() const { return hoveredModelIndex; }
+    const PickResult &GetHoverPick() const { return hoverPick; }
+
+    // hover 피킹 성능 측정 - 첫 번째 모델의 에셋을 instanceCount개 격자로 배치해서 측정 (결과는 디버그 출력)
+    void BenchmarkPicking(size_t instanceCount, size_t rayCount = 1000);
 
 private:
     float mouseSensitivity = 0.1f; // 마우스 회전 민감도 추가
@@ -428,17 +563,26 @@ private:
     {
         std::string filePath;
         ModelType type;
-        std::shared_ptr<LoadingProgress> progress;
+        std::shared_ptr<ImportProgress> progress;
         std::shared_ptr<BaseModel> model;
-        std::future<bool> future;
+        std::shared_future<bool> future; // 같은 에셋을 기다리는 요청끼리 공유
+        ThreadPool::CancellationToken cancel; // 아직 시작하지 않은 로드 작업 취소용
+
+        // 로드가 끝나면 만들 인스턴스 배치 (비어 있으면 에셋 기본 배치로 하나)
+        std::vector<InstancePlacement> placements;
+
+        // 단계별로 가져오는 GLB - 업로드까지 끝나면 loadPromise에 결과를 설정해서 future를 완료
+        std::shared_ptr<ImportPipeline::Entry> import;
+        std::shared_ptr<std::promise<bool>> loadPromise;
+
+        uint32_t batch = 0;     // 요청 묶음 번호 (0은 묶지 않음)
+        bool discarded = false; // 취소했지만 같은 로드를 기다리는 다른 요청이 있어 로드는 계속하고 인스턴스만 만들지 않음
     };
 
     // 비동기 로딩 스레드 함수들
     static bool LoadObjModelThreadFunction(
-        const std::string &path, ID3D11Device *device, std::shared_ptr<Model> model, std::shared_ptr<LoadingProgress> progress);
-
-    static bool LoadGlbModelThreadFunction(
-        const std::string &path, ID3D11Device *device, std::shared_ptr<GltfLoader> model, std::shared_ptr<LoadingProgress> progress);
+        const std::string &path, const MeshCache::SourceKey &sourceKey, ID3D11Device *device, MeshCache *meshCache,
+        std::shared_ptr<Model> model, std::shared_ptr<ImportProgress> progress);
 
     // 모델 컬렉션
     std::vector<ModelInfo> models;
@@ -452,12 +596,28 @@ private:
     // 디바이스 참조
     ID3D11Device *device = nullptr;
 
+    // 요청 하나 취소 (loadRequestsMutex를 잡은 상태에서 호출)
+    void CancelRequest(LoadRequest &request);
+
+    // batch 묶음이 아닌 요청 모두 취소
+    void CancelLoadsExcept(uint32_t batch);
+
+    // selected가 true인 요청 취소 - 같은 파일을 기다리는 다른 요청이 남아 있으면 공유 로드는 멈추지 않고 인스턴스만 버림
+    void CancelSelectedRequests(const std::function<bool(const LoadRequest &)> &selected);
+
+    // 로드가 끝난 요청의 인스턴스를 모델 목록에 추가
+    void AddLoadedInstances(LoadRequest &request);
+
+    // 로딩 창에 표시할 이름 (인스턴스가 여러 개면 개수를 붙임)
+    static std::string GetLoadingName(const std::string &path, size_t instanceCount);
+
     // 로딩 요청 목록
     std::vector<LoadRequest> loadRequests;
     std::mutex loadRequestsMutex;
+    uint32_t lastLoadBatch = 0;
 
     // 로딩 진행 상태 목록
-    std::vector<std::shared_ptr<LoadingProgress>> loadingProgresses;
+    std::vector<std::shared_ptr<ImportProgress>> loadingProgresses;
     std::mutex progressMutex;
 
     // 로딩 완료 대기 시간(ms)
@@ -478,8 +638,57 @@ private:
     std::shared_ptr<LightManager> lightManager;
     std::unique_ptr<InteriorStateManager> stateManager;
 
+    // 가져온 모델의 디스크 캐시 (실행 파일 옆 cache\mesh 폴더)
+    MeshCache meshCache;
+
+    // 처리된 텍스처의 디스크 캐시 (실행 파일 옆 cache\texture 폴더)
+    MeshCache textureCache;
+
+    // 같은 파일을 여러 번 배치할 때 공유하는 모델 에셋
+    AssetRegistry assetRegistry;
+
+    // 단계별 GLB 가져오기 (캐시를 참조하므로 캐시보다 먼저 소멸되도록 뒤에 선언)
+    ImportPipeline importPipeline;
+    float uploadBudgetMilliseconds = 2.0f;
+
     // Hover 기능 관련 변수들
     int hoveredModelIndex = -1; // 현재 hover된 모델 인덱스
     bool isHoverEnabled = true; // hover 기능 활성화 여부
     float hoverAlpha = 0.5f;    // hover 시 투명도 (0.0f ~ 1.0f, 낮을수록 더 투명)
+
+    // 프레임 갱신 작업 그래프 (에셋별 애니메이션/월드 행렬/바운딩 박스, hover 피킹)
+    TaskGraph frameTasks;
+
+    // 마지막 프레임에 시야 절두체 밖이라 그리지 않은 모델 수 (상태 표시줄)
+    int culledModelCount = 0;
+
+    // 프레임별 상수 버퍼 (b2: 뷰, 투영, 카메라 위치) - 모델 셰이더가 공유하므로 프레임마다 한 번만 올림
+    ID3D11Buffer *frameConstantBuffer = nullptr;
+
+    // hover/선택/드래그 상태에 맞는 재질 덮어쓰기 (매 프레임 값으로 만들어 인스턴스에 넘김)
+    MaterialOverride GetMaterialOverride(int index) const;
+
+    // 캐릭터가 current에서 next로 움직일 때 새로 부딪히는 모델이 있는지 (모델 월드 박스 기준)
+    // 이미 겹쳐 있는 모델은 빠져나갈 수 있도록 무시
+    bool CollidesWithModels(const XMFLOAT3 &current, const XMFLOAT3 &next) const;
+
+    // 피킹용 인스턴스 상태 - 마지막으로 트리에 넣은 월드 박스의 버전
+    struct PickingInstance
+    {
+        const BaseModel *model = nullptr;
+        uint64_t boundsVersion = 0;
+        bool visible = false;
+    };
+
+    // 상위 BVH를 현재 모델 목록에 맞춤
+    // 월드 박스 버전이 바뀐 인스턴스만 박스를 다시 넣고, 목록이 바뀌었거나 많이 움직였으면 다시 생성, 아니면 노드 박스만 갱신
+    void UpdatePickingBvh();
+
+    std::vector<PickingInstance> pickingInstances;
+    std::vector<PickingBvh::Bounds> pickingBounds;
+    PickingBvh instanceBvh;
+    size_t pickingRefitCount = 0;
+
+    // 마지막 hover 피킹 결과
+    PickResult hoverPick;
 };
@@ -0,0 +1,174 @@
+#include "MorphTargets.h"
+#include "Avx2Kernels.h"
+#include "CpuFeatures.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // 변화량이 이보다 작은 정점은 움직이지 않는 것으로 처리
+    const float DeltaEpsilon = 1e-7f;
+
+    inline bool IsMoving(const XMFLOAT3& delta)
+    {
+        return std::fabs(delta.x) > DeltaEpsilon || std::fabs(delta.y) > DeltaEpsilon || std::fabs(delta.z) > DeltaEpsilon;
+    }
+}
+
+void MorphTargets::Build(const std::vector<std::vector<XMFLOAT3>>& positionDeltas,
+    const std::vector<std::vector<XMFLOAT3>>& normalDeltas, const void* vertices, size_t vertexCount,
+    size_t stride, size_t positionOffset, size_t normalOffset, Set& set)
+{
+    set = Set();
+    size_t targetCount = (std::max)(positionDeltas.size(), normalDeltas.size());
+    if (targetCount == 0 || vertexCount == 0)
+    {
+        return;
+    }
+
+    // 1. 어떤 타깃에서든 움직이는 정점 모으기
+    bool hasNormals = false;
+    std::vector<uint8_t> moving(vertexCount, 0);
+    for (size_t target = 0; target < targetCount; target++)
+    {
+        if (target < positionDeltas.size() && positionDeltas[target].size() == vertexCount)
+        {
+            for (size_t i = 0; i < vertexCount; i++)
+            {
+                moving[i] |= IsMoving(positionDeltas[target][i]) ? 1 : 0;
+            }
+        }
+        if (target < normalDeltas.size() && normalDeltas[target].size() == vertexCount)
+        {
+            hasNormals = true;
+            for (size_t i = 0; i < vertexCount; i++)
+            {
+                moving[i] |= IsMoving(normalDeltas[target][i]) ? 1 : 0;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        if (moving[i])
+        {
+            set.Vertices.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    if (set.Vertices.empty())
+    {
+        return;
+    }
+
+    // 2. 영향받는 정점의 원래 값과 타깃별 변화량을 조밀하게 복사
+    size_t count = set.Vertices.size();
+    const unsigned char* vertexBytes = static_cast<const unsigned char*>(vertices);
+    set.TargetCount = static_cast<uint32_t>(targetCount);
+    set.BasePositions.resize(count * 3);
+    set.BaseNormals.resize(count * 3);
+    for (size_t i = 0; i < count; i++)
+    {
+        const unsigned char* vertex = vertexBytes + set.Vertices[i] * stride;
+        memcpy(&set.BasePositions[i * 3], vertex + positionOffset, sizeof(float) * 3);
+        memcpy(&set.BaseNormals[i * 3], vertex + normalOffset, sizeof(float) * 3);
+    }
+
+    auto gather = [&set, count, vertexCount](const std::vector<std::vector<XMFLOAT3>>& deltas, std::vector<float>& packed)
+    {
+        packed.assign(set.TargetCount * count * 3, 0.0f);
+        for (size_t target = 0; target < deltas.size(); target++)
+        {
+            if (deltas[target].size() != vertexCount)
+            {
+                continue;
+            }
+
+            float* destination = &packed[target * count * 3];
+            for (size_t i = 0; i < count; i++)
+            {
+                memcpy(destination + i * 3, &deltas[target][set.Vertices[i]], sizeof(float) * 3);
+            }
+        }
+    };
+
+    gather(positionDeltas, set.PositionDeltas);
+    if (hasNormals)
+    {
+        gather(normalDeltas, set.NormalDeltas);
+    }
+}
+
+void MorphTargets::Blend(const Set& set, const float* weights, size_t weightCount, void* destination,
+    size_t stride, size_t positionOffset, size_t normalOffset, std::vector<float>& scratch)
+{
+    if (set.IsEmpty())
+    {
+        return;
+    }
+
+    // 원래 값에서 시작해서 가중치가 0이 아닌 타깃만 누적
+    size_t floatCount = set.Vertices.size() * 3;
+    scratch.resize(floatCount * 2);
+    float* positions = scratch.data();
+    float* normals = scratch.data() + floatCount;
+    memcpy(positions, set.BasePositions.data(), floatCount * sizeof(float));
+    memcpy(normals, set.BaseNormals.data(), floatCount * sizeof(float));
+
+    size_t targetCount = (std::min)(static_cast<size_t>(set.TargetCount), weightCount);
+    for (size_t target = 0; target < targetCount; target++)
+    {
+        if (weights[target] == 0.0f)
+        {
+            continue;
+        }
+
+        Accumulate(positions, &set.PositionDeltas[target * floatCount], weights[target], floatCount);
+        if (!set.NormalDeltas.empty())
+        {
+            Accumulate(normals, &set.NormalDeltas[target * floatCount], weights[target], floatCount);
+        }
+    }
+
+    // 영향받는 정점에만 기록 (노멀은 다시 정규화)
+    unsigned char* vertexBytes = static_cast<unsigned char*>(destination);
+    for (size_t i = 0; i < set.Vertices.size(); i++)
+    {
+        unsigned char* vertex = vertexBytes + set.Vertices[i] * stride;
+        memcpy(vertex + positionOffset, positions + i * 3, sizeof(float) * 3);
+
+        float* normal = normals + i * 3;
+        float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length > 0.0f)
+        {
+            normal[0] /= length;
+            normal[1] /= length;
+            normal[2] /= length;
+        }
+        memcpy(vertex + normalOffset, normal, sizeof(float) * 3);
+    }
+}
+
+void MorphTargets::Accumulate(float* destination, const float* delta, float weight, size_t count)
+{
+    size_t i = 0;
+    if (CpuFeatures::HasAvx2())
+    {
+        i = Avx2Kernels::Accumulate(destination, delta, weight, count);
+    }
+    else
+    {
+        XMVECTOR weight4 = XMVectorReplicate(weight);
+        for (; i + 4 <= count; i += 4)
+        {
+            XMVECTOR value = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(destination + i));
+            value = XMVectorMultiplyAdd(weight4, XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(delta + i)), value);
+            XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(destination + i), value);
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        destination[i] += weight * delta[i];
+    }
+}
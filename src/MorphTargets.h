@@ -0,0 +1,41 @@
+#pragma once
+#include <directxmath.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace DirectX;
+
+// 모프 타깃 블렌딩 (디바이스 없이 동작)
+// 어떤 타깃에서든 움직이는 정점만 골라 조밀한 배열로 보관하고, 가중치가 0이 아닌 타깃의 변화량만 누적한다
+// 누적은 연속된 float 배열에 대한 곱셈-덧셈이라 CPU가 AVX2를 지원하면 8개씩 (Avx2Kernels), 아니면 DirectXMath(SSE2)로 4개씩 처리한다
+class MorphTargets
+{
+public:
+    // 프리미티브 하나의 모프 타깃 (정점 i의 값은 [i * 3, i * 3 + 3) 위치에 x, y, z 순서로 저장)
+    struct Set
+    {
+        uint32_t TargetCount = 0;
+        std::vector<uint32_t> Vertices;     // 영향을 받는 정점 인덱스
+        std::vector<float> BasePositions;   // 영향을 받는 정점의 원래 위치
+        std::vector<float> BaseNormals;     // 영향을 받는 정점의 원래 노멀
+        std::vector<float> PositionDeltas;  // 타깃별 위치 변화량 (타깃마다 Vertices.size() * 3개)
+        std::vector<float> NormalDeltas;    // 타깃별 노멀 변화량 (노멀 타깃이 없으면 비어 있음)
+
+        bool IsEmpty() const { return TargetCount == 0 || Vertices.empty(); }
+    };
+
+    // 타깃별 전체 정점 변화량에서 움직이는 정점만 골라 Set 구성
+    // positionDeltas/normalDeltas[target]은 정점 수만큼이거나 비어 있음 (정점은 stride 간격, 위치/노멀은 float3)
+    static void Build(const std::vector<std::vector<XMFLOAT3>>& positionDeltas,
+        const std::vector<std::vector<XMFLOAT3>>& normalDeltas, const void* vertices, size_t vertexCount,
+        size_t stride, size_t positionOffset, size_t normalOffset, Set& set);
+
+    // 가중치로 섞은 위치/노멀을 destination의 영향받는 정점에만 기록 (나머지 속성과 정점은 그대로)
+    // scratch는 호출 사이에 재사용하는 작업 버퍼
+    static void Blend(const Set& set, const float* weights, size_t weightCount, void* destination,
+        size_t stride, size_t positionOffset, size_t normalOffset, std::vector<float>& scratch);
+
+    // destination[i] += weight * delta[i]
+    static void Accumulate(float* destination, const float* delta, float weight, size_t count);
+};
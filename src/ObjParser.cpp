@@ -0,0 +1,575 @@
+#include "ObjParser.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+    // 10의 거듭제곱 테이블 (double로 정확히 표현 가능한 범위)
+    const double powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    inline bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    inline bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    inline const char* SkipBlanks(const char* p, const char* end)
+    {
+        while (p < end && IsBlank(*p))
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    // 다음 줄의 시작 위치 반환
+    inline const char* SkipLine(const char* p, const char* end)
+    {
+        const char* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+        return newline ? newline + 1 : end;
+    }
+
+    // 공백 또는 줄 끝까지의 토큰 끝 위치
+    inline const char* TokenEnd(const char* p, const char* end)
+    {
+        while (p < end && !IsBlank(*p) && *p != '\n')
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    // 키워드 일치 여부 (뒤에 공백이 와야 함)
+    inline bool MatchKeyword(const char* p, const char* end, const char* keyword, size_t length)
+    {
+        return static_cast<size_t>(end - p) > length && memcmp(p, keyword, length) == 0 && IsBlank(p[length]);
+    }
+
+    // 정수 스캔 - 숫자가 없으면 nullptr 반환
+    inline const char* ScanInt(const char* p, const char* end, int& value)
+    {
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negative = (*p == '-');
+            ++p;
+        }
+
+        if (p >= end || !IsDigit(*p))
+        {
+            return nullptr;
+        }
+
+        int result = 0;
+        while (p < end && IsDigit(*p))
+        {
+            result = result * 10 + (*p - '0');
+            ++p;
+        }
+
+        value = negative ? -result : result;
+        return p;
+    }
+
+    // 실수 스캔 - 일반적인 10진 표기는 직접 처리하고 nan/inf 등은 strtof로 처리
+    inline const char* ScanFloat(const char* p, const char* end, float& value)
+    {
+        const char* start = p;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negative = (*p == '-');
+            ++p;
+        }
+
+        uint64_t mantissa = 0;
+        int digitCount = 0;
+        int exponent = 0;
+        bool hasDigits = false;
+
+        // 정수부
+        while (p < end && IsDigit(*p))
+        {
+            if (digitCount < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa != 0)
+                {
+                    digitCount++;
+                }
+            }
+            else
+            {
+                exponent++;
+            }
+            hasDigits = true;
+            ++p;
+        }
+
+        // 소수부
+        if (p < end && *p == '.')
+        {
+            ++p;
+            while (p < end && IsDigit(*p))
+            {
+                if (digitCount < 19)
+                {
+                    mantissa = mantissa * 10 + (*p - '0');
+                    if (mantissa != 0)
+                    {
+                        digitCount++;
+                    }
+                    exponent--;
+                }
+                hasDigits = true;
+                ++p;
+            }
+        }
+
+        if (!hasDigits)
+        {
+            // nan, inf 같은 특수 표기는 표준 함수로 처리
+            char buffer[64];
+            const char* tokenEnd = TokenEnd(start, end);
+            size_t length = static_cast<size_t>(tokenEnd - start);
+            if (length == 0 || length >= sizeof(buffer))
+            {
+                return nullptr;
+            }
+            memcpy(buffer, start, length);
+            buffer[length] = '\0';
+            char* parsedEnd = nullptr;
+            value = strtof(buffer, &parsedEnd);
+            if (parsedEnd == buffer)
+            {
+                return nullptr;
+            }
+            return start + (parsedEnd - buffer);
+        }
+
+        // 지수부
+        if (p < end && (*p == 'e' || *p == 'E'))
+        {
+            int exponentValue = 0;
+            const char* next = ScanInt(p + 1, end, exponentValue);
+            if (next)
+            {
+                exponent += exponentValue;
+                p = next;
+            }
+        }
+
+        double result = static_cast<double>(mantissa);
+        if (exponent < 0)
+        {
+            result = (exponent >= -22) ? result / powersOfTen[-exponent] : result * std::pow(10.0, exponent);
+        }
+        else if (exponent > 0)
+        {
+            result = (exponent <= 22) ? result * powersOfTen[exponent] : result * std::pow(10.0, exponent);
+        }
+
+        value = static_cast<float>(negative ? -result : result);
+        return p;
+    }
+
+    // OBJ 인덱스(1부터 시작, 음수는 상대 인덱스)를 0부터 시작하는 인덱스로 변환
+    inline int32_t ResolveIndex(int index, size_t count)
+    {
+        if (index > 0)
+        {
+            return index - 1;
+        }
+        if (index < 0)
+        {
+            return static_cast<int32_t>(count) + index;
+        }
+        return -1;
+    }
+
+    // 병렬 파싱을 위한 최소 청크 크기 (작은 파일은 단일 스레드로 처리)
+    const size_t minChunkBytes = 4 * 1024 * 1024;
+
+    // 청크 내 연속된 면 구간 - usemtl을 만날 때마다 새 구간 시작
+    struct Segment
+    {
+        bool HasMaterial = false; // false면 이전 청크의 재질을 이어서 사용
+        std::string MaterialName;
+        std::vector<ObjParser::Corner> Corners;
+    };
+
+    // 음수(상대) 인덱스 보정 정보 - 병합 시 이전 청크들의 요소 수를 더함
+    struct IndexFixup
+    {
+        uint32_t SegmentIndex;
+        uint32_t CornerIndex;
+        uint8_t Component; // 0: 위치, 1: 텍스처 좌표, 2: 법선
+    };
+
+    // 청크 하나의 파싱 결과
+    struct ChunkResult
+    {
+        std::vector<XMFLOAT3> Positions;
+        std::vector<XMFLOAT3> Normals;
+        std::vector<XMFLOAT2> TexCoords;
+        std::vector<Segment> Segments;
+        std::vector<IndexFixup> Fixups;
+        std::string MtlLib;
+        bool HasMaterial = false; // 청크 안에서 usemtl이 나왔는지 여부
+        std::string MaterialName; // 청크 끝에서 사용 중인 재질
+    };
+
+    // 대상이 비어 있고 미리 확보된 공간이 없으면 이동, 아니면 뒤에 추가
+    template <typename T>
+    void Append(std::vector<T>& destination, std::vector<T>& source)
+    {
+        if (destination.empty() && destination.capacity() < source.size())
+        {
+            destination = std::move(source);
+        }
+        else
+        {
+            destination.insert(destination.end(), source.begin(), source.end());
+        }
+    }
+}
+
+
+namespace
+{
+    // 줄 단위로 정렬된 구간 [begin, end)를 파싱
+    void ParseChunk(const char* begin, const char* end, ChunkResult& chunk)
+    {
+        const char* p = begin;
+
+        Segment* currentSegment = nullptr;
+        std::string currentMaterialName;
+        bool hasMaterial = false;
+
+        std::vector<ObjParser::Corner> faceCorners;
+        std::vector<uint8_t> faceRelative; // 꼭짓점별 상대 인덱스 비트 (1: 위치, 2: 텍스처 좌표, 4: 법선)
+        faceCorners.reserve(8);
+        faceRelative.reserve(8);
+
+        while (p < end)
+        {
+            p = SkipBlanks(p, end);
+            if (p >= end)
+            {
+                break;
+            }
+
+            const char c = *p;
+
+            if (c == 'v' && p + 1 < end)
+            {
+                const char next = p[1];
+
+                if (IsBlank(next)) // 정점 위치
+                {
+                    XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+                    const char* q = SkipBlanks(p + 2, end);
+                    q = ScanFloat(q, end, position.x);
+                    if (q) q = ScanFloat(SkipBlanks(q, end), end, position.y);
+                    if (q) q = ScanFloat(SkipBlanks(q, end), end, position.z);
+                    chunk.Positions.push_back(position);
+                }
+                else if (next == 'n' && p + 2 < end && IsBlank(p[2])) // 정점 법선
+                {
+                    XMFLOAT3 normal = { 0.0f, 0.0f, 0.0f };
+                    const char* q = SkipBlanks(p + 3, end);
+                    q = ScanFloat(q, end, normal.x);
+                    if (q) q = ScanFloat(SkipBlanks(q, end), end, normal.y);
+                    if (q) q = ScanFloat(SkipBlanks(q, end), end, normal.z);
+                    chunk.Normals.push_back(normal);
+                }
+                else if (next == 't' && p + 2 < end && IsBlank(p[2])) // 텍스처 좌표
+                {
+                    XMFLOAT2 texCoord = { 0.0f, 0.0f };
+                    const char* q = SkipBlanks(p + 3, end);
+                    q = ScanFloat(q, end, texCoord.x);
+                    if (q) q = ScanFloat(SkipBlanks(q, end), end, texCoord.y);
+                    texCoord.y = 1.0f - texCoord.y; // DirectX 좌표계로 변환
+                    chunk.TexCoords.push_back(texCoord);
+                }
+            }
+            else if (c == 'f' && p + 1 < end && IsBlank(p[1])) // 면
+            {
+                faceCorners.clear();
+                faceRelative.clear();
+
+                const char* q = p + 2;
+                while (true)
+                {
+                    q = SkipBlanks(q, end);
+                    if (q >= end || *q == '\n' || *q == '#')
+                    {
+                        break;
+                    }
+
+                    // v, v/vt, v//vn, v/vt/vn 형식 처리
+                    int positionIndex = 0;
+                    int texCoordIndex = 0;
+                    int normalIndex = 0;
+
+                    const char* next = ScanInt(q, end, positionIndex);
+                    if (!next)
+                    {
+                        q = TokenEnd(q, end);
+                        continue;
+                    }
+                    q = next;
+
+                    if (q < end && *q == '/')
+                    {
+                        ++q;
+                        if (q < end && *q != '/')
+                        {
+                            next = ScanInt(q, end, texCoordIndex);
+                            if (next) q = next;
+                        }
+                        if (q < end && *q == '/')
+                        {
+                            ++q;
+                            next = ScanInt(q, end, normalIndex);
+                            if (next) q = next;
+                        }
+                    }
+                    q = TokenEnd(q, end);
+
+                    // 음수 인덱스는 청크 내 개수 기준으로 변환하고 병합 시 보정
+                    ObjParser::Corner corner;
+                    corner.Position = ResolveIndex(positionIndex, chunk.Positions.size());
+                    corner.TexCoord = ResolveIndex(texCoordIndex, chunk.TexCoords.size());
+                    corner.Normal = ResolveIndex(normalIndex, chunk.Normals.size());
+                    faceCorners.push_back(corner);
+
+                    uint8_t relative = 0;
+                    if (positionIndex < 0) relative |= 1;
+                    if (texCoordIndex < 0) relative |= 2;
+                    if (normalIndex < 0) relative |= 4;
+                    faceRelative.push_back(relative);
+                }
+
+                if (faceCorners.size() >= 3)
+                {
+                    if (!currentSegment)
+                    {
+                        chunk.Segments.emplace_back();
+                        currentSegment = &chunk.Segments.back();
+                        currentSegment->HasMaterial = hasMaterial;
+                        currentSegment->MaterialName = currentMaterialName;
+                    }
+
+                    const uint32_t segmentIndex = static_cast<uint32_t>(chunk.Segments.size() - 1);
+
+                    // 면을 삼각형으로 분할 (팬 방식)
+                    for (size_t i = 1; i + 1 < faceCorners.size(); i++)
+                    {
+                        const size_t triangle[3] = { 0, i, i + 1 };
+                        for (size_t corner : triangle)
+                        {
+                            if (faceRelative[corner])
+                            {
+                                const uint32_t cornerIndex = static_cast<uint32_t>(currentSegment->Corners.size());
+                                for (uint8_t component = 0; component < 3; component++)
+                                {
+                                    if (faceRelative[corner] & (1 << component))
+                                    {
+                                        chunk.Fixups.push_back({ segmentIndex, cornerIndex, component });
+                                    }
+                                }
+                            }
+                            currentSegment->Corners.push_back(faceCorners[corner]);
+                        }
+                    }
+                }
+            }
+            else if (MatchKeyword(p, end, "usemtl", 6)) // 재질 사용
+            {
+                const char* q = SkipBlanks(p + 7, end);
+                std::string name(q, TokenEnd(q, end));
+                if (!name.empty())
+                {
+                    currentMaterialName = name;
+                    hasMaterial = true;
+                    currentSegment = nullptr; // 다음 면에서 새 구간 시작
+                }
+            }
+            else if (MatchKeyword(p, end, "mtllib", 6)) // 재질 라이브러리
+            {
+                const char* q = SkipBlanks(p + 7, end);
+                chunk.MtlLib.assign(q, TokenEnd(q, end));
+            }
+
+            p = SkipLine(p, end);
+        }
+
+        chunk.HasMaterial = hasMaterial;
+        chunk.MaterialName = currentMaterialName;
+    }
+
+    // 청크 결과를 순서대로 병합 - 단일 스레드 파싱과 동일한 결과를 보장
+    void MergeChunks(std::vector<ChunkResult>& chunks, ObjParser::Result& result)
+    {
+        size_t totalPositions = 0;
+        size_t totalNormals = 0;
+        size_t totalTexCoords = 0;
+        for (const auto& chunk : chunks)
+        {
+            totalPositions += chunk.Positions.size();
+            totalNormals += chunk.Normals.size();
+            totalTexCoords += chunk.TexCoords.size();
+        }
+
+        if (chunks.size() > 1)
+        {
+            result.Positions.reserve(totalPositions);
+            result.Normals.reserve(totalNormals);
+            result.TexCoords.reserve(totalTexCoords);
+        }
+
+        std::string currentMaterialName = "default";
+        std::unordered_map<std::string, size_t> groupLookup;
+
+        for (auto& chunk : chunks)
+        {
+            // 이전 청크까지의 요소 수 (상대 인덱스 보정 기준)
+            const int32_t baseCounts[3] = {
+                static_cast<int32_t>(result.Positions.size()),
+                static_cast<int32_t>(result.TexCoords.size()),
+                static_cast<int32_t>(result.Normals.size())
+            };
+
+            for (const auto& fixup : chunk.Fixups)
+            {
+                ObjParser::Corner& corner = chunk.Segments[fixup.SegmentIndex].Corners[fixup.CornerIndex];
+                int32_t* component = fixup.Component == 0 ? &corner.Position : (fixup.Component == 1 ? &corner.TexCoord : &corner.Normal);
+                *component += baseCounts[fixup.Component];
+            }
+
+            Append(result.Positions, chunk.Positions);
+            Append(result.Normals, chunk.Normals);
+            Append(result.TexCoords, chunk.TexCoords);
+
+            // 구간을 재질 그룹에 순서대로 추가
+            for (auto& segment : chunk.Segments)
+            {
+                if (segment.HasMaterial)
+                {
+                    currentMaterialName = segment.MaterialName;
+                }
+
+                auto found = groupLookup.find(currentMaterialName);
+                if (found == groupLookup.end())
+                {
+                    found = groupLookup.emplace(currentMaterialName, result.Groups.size()).first;
+                    result.Groups.emplace_back();
+                    result.Groups.back().MaterialName = currentMaterialName;
+                }
+
+                Append(result.Groups[found->second].Corners, segment.Corners);
+            }
+
+            // 청크 끝에서 유효한 재질을 다음 청크로 이어줌 (면 없이 usemtl만 있는 경우 포함)
+            if (chunk.HasMaterial)
+            {
+                currentMaterialName = chunk.MaterialName;
+            }
+
+            if (!chunk.MtlLib.empty())
+            {
+                result.MtlLib = chunk.MtlLib;
+            }
+
+            // 병합한 청크 메모리는 바로 해제
+            chunk = ChunkResult();
+        }
+    }
+}
+
+bool ObjParser::ParseFile(const std::string& filename, Result& result, unsigned int threadCount)
+{
+    MappedFile file;
+    if (!file.Open(filename))
+    {
+        return false;
+    }
+
+    return Parse(file.GetData(), file.GetSize(), result, threadCount);
+}
+
+bool ObjParser::Parse(const char* data, size_t size, Result& result, unsigned int threadCount)
+{
+    result = Result();
+    result.FileBytes = size;
+
+    if (!data || size == 0)
+    {
+        result.ThreadCount = 1;
+        return true;
+    }
+
+    // 스레드 수 결정 (0이면 공유 스레드 풀의 작업자 수 + 호출 스레드)
+    ThreadPool& pool = ThreadPool::GetShared();
+    if (threadCount == 0)
+    {
+        threadCount = pool.GetThreadCount() + 1;
+    }
+    size_t maxChunks = (std::max)(static_cast<size_t>(1), size / minChunkBytes);
+    size_t chunkCount = (std::min)(static_cast<size_t>(threadCount), maxChunks);
+
+    // 줄바꿈 위치에 맞춰 청크 경계 결정
+    const char* end = data + size;
+    std::vector<const char*> boundaries;
+    boundaries.push_back(data);
+    for (size_t i = 1; i < chunkCount; i++)
+    {
+        const char* split = data + (size * i) / chunkCount;
+        if (split <= boundaries.back())
+        {
+            continue;
+        }
+        split = SkipLine(split, end);
+        if (split >= end)
+        {
+            break;
+        }
+        if (split > boundaries.back())
+        {
+            boundaries.push_back(split);
+        }
+    }
+    boundaries.push_back(end);
+
+    std::vector<ChunkResult> chunks(boundaries.size() - 1);
+    result.ThreadCount = static_cast<unsigned int>(chunks.size());
+
+    if (chunks.size() == 1)
+    {
+        ParseChunk(data, end, chunks[0]);
+    }
+    else
+    {
+        // 청크마다 스레드를 만들지 않고 공유 스레드 풀에서 처리 (호출 스레드도 참여)
+        pool.ParallelFor(chunks.size(), [&boundaries, &chunks](size_t i)
+        {
+            ParseChunk(boundaries[i], boundaries[i + 1], chunks[i]);
+        });
+    }
+
+    MergeChunks(chunks, result);
+    return true;
+}
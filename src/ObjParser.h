@@ -0,0 +1,47 @@
+#pragma once
+#include <directxmath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace DirectX;
+
+// OBJ 텍스트 파서
+// 메모리 매핑된 파일 버퍼를 복사 없이 직접 토큰화한다
+// 큰 파일은 여러 스레드가 청크 단위로 나눠 파싱하며, 결과는 단일 스레드와 동일하다
+class ObjParser
+{
+public:
+    // 삼각형 꼭짓점 하나의 인덱스 (0부터 시작, 없으면 -1)
+    struct Corner
+    {
+        int32_t Position;
+        int32_t TexCoord;
+        int32_t Normal;
+    };
+
+    // 재질 그룹 - usemtl이 처음 등장한 순서대로 저장
+    struct Group
+    {
+        std::string MaterialName;
+        std::vector<Corner> Corners; // 3개씩 하나의 삼각형
+    };
+
+    // 파싱 결과
+    struct Result
+    {
+        std::vector<XMFLOAT3> Positions;
+        std::vector<XMFLOAT3> Normals;
+        std::vector<XMFLOAT2> TexCoords; // v 좌표는 DirectX 좌표계로 뒤집힘
+        std::vector<Group> Groups;
+        std::string MtlLib;
+        size_t FileBytes = 0;
+        unsigned int ThreadCount = 1; // 실제로 사용된 파싱 스레드 수
+    };
+
+    // 파일을 메모리 매핑해서 파싱 (threadCount가 0이면 하드웨어 스레드 수 사용)
+    static bool ParseFile(const std::string& filename, Result& result, unsigned int threadCount = 0);
+
+    // 메모리 버퍼 파싱 - 줄 단위로 나눈 청크를 병렬로 파싱한 뒤 순서대로 병합
+    static bool Parse(const char* data, size_t size, Result& result, unsigned int threadCount = 0);
+};
@@ -0,0 +1,387 @@
+#include "PickingBvh.h"
+#include <algorithm>
+
+namespace
+{
+    // 축마다 나누는 구간 수
+    const int BinCount = 12;
+
+    // 내부 노드 하나를 지나는 비용 (항목 하나를 검사하는 비용 기준)
+    const float TraversalCost = 1.0f;
+
+    // 분할 비용을 비교할 수 없을 만큼 항목이 많으면 비용과 상관없이 분할
+    const uint32_t MaxLeafItems = 16;
+
+    float GetAxis(const XMFLOAT3& vector, int axis)
+    {
+        return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+    }
+
+    void Grow(PickingBvh::Bounds& box, const XMFLOAT3& minPoint, const XMFLOAT3& maxPoint)
+    {
+        box.Min = XMFLOAT3((std::min)(box.Min.x, minPoint.x), (std::min)(box.Min.y, minPoint.y), (std::min)(box.Min.z, minPoint.z));
+        box.Max = XMFLOAT3((std::max)(box.Max.x, maxPoint.x), (std::max)(box.Max.y, maxPoint.y), (std::max)(box.Max.z, maxPoint.z));
+    }
+
+    // 박스 겉넓이의 절반 (SAH 비용 비교용, 빈 박스는 0)
+    float HalfArea(const PickingBvh::Bounds& box)
+    {
+        float x = box.Max.x - box.Min.x;
+        float y = box.Max.y - box.Min.y;
+        float z = box.Max.z - box.Min.z;
+        if (x < 0.0f || y < 0.0f || z < 0.0f)
+        {
+            return 0.0f;
+        }
+        return x * y + y * z + z * x;
+    }
+
+    XMFLOAT3 GetCentroid(const PickingBvh::Bounds& box)
+    {
+        return XMFLOAT3((box.Min.x + box.Max.x) * 0.5f, (box.Min.y + box.Max.y) * 0.5f, (box.Min.z + box.Max.z) * 0.5f);
+    }
+
+    struct Bin
+    {
+        PickingBvh::Bounds Box = PickingBvh::EmptyBounds();
+        uint32_t Count = 0;
+    };
+}
+
+void PickingBvh::Build(const std::vector<Bounds>& itemBounds, uint32_t maxLeafSize)
+{
+    Clear();
+    if (itemBounds.empty())
+    {
+        return;
+    }
+
+    uint32_t itemCount = static_cast<uint32_t>(itemBounds.size());
+    items.resize(itemCount);
+    std::vector<XMFLOAT3> centroids(itemCount);
+    for (uint32_t i = 0; i < itemCount; i++)
+    {
+        items[i] = i;
+        centroids[i] = GetCentroid(itemBounds[i]);
+    }
+
+    nodes.reserve(static_cast<size_t>(itemCount) * 2);
+    nodes.push_back({ XMFLOAT3(), 0, XMFLOAT3(), itemCount });
+
+    // 분할할 노드 (노드 번호, 깊이)
+    std::vector<std::pair<uint32_t, uint32_t>> pending;
+    pending.emplace_back(0, 0);
+
+    while (!pending.empty())
+    {
+        uint32_t nodeIndex = pending.back().first;
+        uint32_t depth = pending.back().second;
+        pending.pop_back();
+
+        uint32_t first = nodes[nodeIndex].First;
+        uint32_t count = nodes[nodeIndex].Count;
+
+        // 노드 박스와 항목 중심 범위
+        Bounds box = EmptyBounds();
+        Bounds centroidBox = EmptyBounds();
+        for (uint32_t i = first; i < first + count; i++)
+        {
+            Grow(box, itemBounds[items[i]].Min, itemBounds[items[i]].Max);
+            Grow(centroidBox, centroids[items[i]], centroids[items[i]]);
+        }
+        nodes[nodeIndex].Min = box.Min;
+        nodes[nodeIndex].Max = box.Max;
+
+        if (count <= maxLeafSize || depth >= MaxDepth)
+        {
+            continue;
+        }
+
+        // 축마다 중심을 구간에 나눠 담고 구간 경계마다 양쪽 비용 계산
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = FLT_MAX;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float axisMin = GetAxis(centroidBox.Min, axis);
+            float extent = GetAxis(centroidBox.Max, axis) - axisMin;
+            if (extent <= 0.0f)
+            {
+                continue;
+            }
+
+            Bin bins[BinCount];
+            float scale = BinCount / extent;
+            for (uint32_t i = first; i < first + count; i++)
+            {
+                int bin = (std::min)(static_cast<int>((GetAxis(centroids[items[i]], axis) - axisMin) * scale), BinCount - 1);
+                bins[bin].Count++;
+                Grow(bins[bin].Box, itemBounds[items[i]].Min, itemBounds[items[i]].Max);
+            }
+
+            // 왼쪽에서 누적한 비용을 먼저 구하고 오른쪽에서 누적하면서 합침
+            float leftCosts[BinCount - 1];
+            Bounds leftBox = EmptyBounds();
+            uint32_t leftCount = 0;
+            for (int split = 0; split < BinCount - 1; split++)
+            {
+                leftCount += bins[split].Count;
+                Grow(leftBox, bins[split].Box.Min, bins[split].Box.Max);
+                leftCosts[split] = leftCount * HalfArea(leftBox);
+            }
+
+            Bounds rightBox = EmptyBounds();
+            uint32_t rightCount = 0;
+            for (int split = BinCount - 1; split > 0; split--)
+            {
+                rightCount += bins[split].Count;
+                Grow(rightBox, bins[split].Box.Min, bins[split].Box.Max);
+                if (rightCount == 0 || rightCount == count)
+                {
+                    continue;
+                }
+
+                float cost = leftCosts[split - 1] + rightCount * HalfArea(rightBox);
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = split;
+                }
+            }
+        }
+
+        // 모든 중심이 한 점에 모였으면 더 나눌 수 없음
+        if (bestAxis < 0)
+        {
+            continue;
+        }
+
+        // 분할해도 항목 검사가 줄지 않으면 잎으로 둠
+        float nodeArea = HalfArea(box);
+        float splitCost = nodeArea > 0.0f ? TraversalCost + bestCost / nodeArea : 0.0f;
+        if (splitCost >= static_cast<float>(count) && count <= MaxLeafItems)
+        {
+            continue;
+        }
+
+        // 선택한 구간 경계 왼쪽의 항목을 앞으로 모음
+        float axisMin = GetAxis(centroidBox.Min, bestAxis);
+        float scale = BinCount / (GetAxis(centroidBox.Max, bestAxis) - axisMin);
+        uint32_t* middle = std::partition(items.data() + first, items.data() + first + count,
+            [&](uint32_t item)
+            {
+                int bin = (std::min)(static_cast<int>((GetAxis(centroids[item], bestAxis) - axisMin) * scale), BinCount - 1);
+                return bin < bestSplit;
+            });
+        uint32_t leftCount = static_cast<uint32_t>(middle - (items.data() + first));
+        if (leftCount == 0 || leftCount == count)
+        {
+            continue;
+        }
+
+        uint32_t left = static_cast<uint32_t>(nodes.size());
+        nodes.push_back({ XMFLOAT3(), first, XMFLOAT3(), leftCount });
+        nodes.push_back({ XMFLOAT3(), first + leftCount, XMFLOAT3(), count - leftCount });
+        nodes[nodeIndex].First = left;
+        nodes[nodeIndex].Count = 0;
+
+        pending.emplace_back(left + 1, depth + 1);
+        pending.emplace_back(left, depth + 1);
+    }
+
+    nodes.shrink_to_fit();
+}
+
+void PickingBvh::Refit(const std::vector<Bounds>& itemBounds)
+{
+    if (itemBounds.size() != items.size())
+    {
+        Build(itemBounds);
+        return;
+    }
+
+    // 자식 노드는 항상 부모보다 뒤에 있으므로 뒤에서부터 계산하면 자식이 먼저 갱신됨
+    for (size_t i = nodes.size(); i-- > 0;)
+    {
+        Node& node = nodes[i];
+        Bounds box = EmptyBounds();
+        if (node.Count > 0)
+        {
+            for (uint32_t item = node.First; item < node.First + node.Count; item++)
+            {
+                Grow(box, itemBounds[items[item]].Min, itemBounds[items[item]].Max);
+            }
+        }
+        else
+        {
+            Grow(box, nodes[node.First].Min, nodes[node.First].Max);
+            Grow(box, nodes[node.First + 1].Min, nodes[node.First + 1].Max);
+        }
+        node.Min = box.Min;
+        node.Max = box.Max;
+    }
+}
+
+void PickingBvh::Clear()
+{
+    nodes.clear();
+    items.clear();
+}
+
+uint64_t PickingBvh::GetMemoryUsage() const
+{
+    return nodes.capacity() * sizeof(Node) + items.capacity() * sizeof(uint32_t);
+}
+
+float PickingBvh::IntersectBounds(const XMFLOAT3& boxMin, const XMFLOAT3& boxMax,
+    const XMFLOAT3& origin, const XMFLOAT3& inverseDirection, float closest)
+{
+    // 빈 박스 (숨긴 항목)
+    if (boxMin.x > boxMax.x)
+    {
+        return FLT_MAX;
+    }
+
+    // 슬랩 방식 - 축마다 두 평면 사이의 구간을 구해서 겹치는 구간이 있는지 확인
+    float x1 = (boxMin.x - origin.x) * inverseDirection.x;
+    float x2 = (boxMax.x - origin.x) * inverseDirection.x;
+    float y1 = (boxMin.y - origin.y) * inverseDirection.y;
+    float y2 = (boxMax.y - origin.y) * inverseDirection.y;
+    float z1 = (boxMin.z - origin.z) * inverseDirection.z;
+    float z2 = (boxMax.z - origin.z) * inverseDirection.z;
+
+    float enter = (std::max)((std::max)((std::min)(x1, x2), (std::min)(y1, y2)), (std::min)(z1, z2));
+    float exit = (std::min)((std::min)((std::max)(x1, x2), (std::max)(y1, y2)), (std::max)(z1, z2));
+
+    if (exit < 0.0f || enter > exit || enter >= closest)
+    {
+        return FLT_MAX;
+    }
+    return (std::max)(enter, 0.0f);
+}
+
+void TriangleBvh::Build(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices, size_t indexCount)
+{
+    Clear();
+
+    if (!positions || indexCount / 3 == 0)
+    {
+        return;
+    }
+
+    std::vector<PickingBvh::Bounds> triangleBounds;
+    UpdateTriangles(positions, stride, vertexCount, indices, indexCount, triangleBounds);
+    bvh.Build(triangleBounds);
+}
+
+void TriangleBvh::Refit(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices, size_t indexCount)
+{
+    // 삼각형 수가 바뀌었으면 새로 생성
+    if (!positions || bvh.IsEmpty() || triangles.size() != indexCount / 3)
+    {
+        Build(positions, stride, vertexCount, indices, indexCount);
+        return;
+    }
+
+    std::vector<PickingBvh::Bounds> triangleBounds;
+    UpdateTriangles(positions, stride, vertexCount, indices, indexCount, triangleBounds);
+    bvh.Refit(triangleBounds);
+}
+
+void TriangleBvh::UpdateTriangles(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices,
+    size_t indexCount, std::vector<PickingBvh::Bounds>& triangleBounds)
+{
+    size_t triangleCount = indexCount / 3;
+    auto getPosition = [positions, stride](uint32_t index) -> const XMFLOAT3&
+    {
+        return *reinterpret_cast<const XMFLOAT3*>(reinterpret_cast<const uint8_t*>(positions) + index * stride);
+    };
+
+    // 범위를 벗어난 인덱스의 삼각형은 번호를 유지하도록 빈 박스로 남김 (검사에서 제외)
+    triangles.resize(triangleCount);
+    triangleBounds.assign(triangleCount, PickingBvh::EmptyBounds());
+    for (size_t i = 0; i < triangleCount; i++)
+    {
+        uint32_t index0 = indices[i * 3];
+        uint32_t index1 = indices[i * 3 + 1];
+        uint32_t index2 = indices[i * 3 + 2];
+        if (index0 >= vertexCount || index1 >= vertexCount || index2 >= vertexCount)
+        {
+            triangles[i] = {};
+            continue;
+        }
+
+        const XMFLOAT3& p0 = getPosition(index0);
+        const XMFLOAT3& p1 = getPosition(index1);
+        const XMFLOAT3& p2 = getPosition(index2);
+        triangles[i].Vertex0 = p0;
+        triangles[i].Edge1 = XMFLOAT3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z);
+        triangles[i].Edge2 = XMFLOAT3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z);
+
+        PickingBvh::Bounds& box = triangleBounds[i];
+        box.Min = XMFLOAT3((std::min)({ p0.x, p1.x, p2.x }), (std::min)({ p0.y, p1.y, p2.y }), (std::min)({ p0.z, p1.z, p2.z }));
+        box.Max = XMFLOAT3((std::max)({ p0.x, p1.x, p2.x }), (std::max)({ p0.y, p1.y, p2.y }), (std::max)({ p0.z, p1.z, p2.z }));
+    }
+}
+
+void TriangleBvh::Clear()
+{
+    bvh.Clear();
+    triangles.clear();
+}
+
+bool TriangleBvh::Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, float& closest, int& triangle) const
+{
+    bool hit = false;
+    bvh.Raycast(origin, direction, closest, [&](uint32_t item, float& itemClosest)
+    {
+        const Triangle& candidate = triangles[item];
+        const XMFLOAT3& e1 = candidate.Edge1;
+        const XMFLOAT3& e2 = candidate.Edge2;
+
+        // p = direction x e2
+        float px = direction.y * e2.z - direction.z * e2.y;
+        float py = direction.z * e2.x - direction.x * e2.z;
+        float pz = direction.x * e2.y - direction.y * e2.x;
+        float determinant = e1.x * px + e1.y * py + e1.z * pz;
+        if (determinant == 0.0f)
+        {
+            return;
+        }
+        float inverseDeterminant = 1.0f / determinant;
+
+        float sx = origin.x - candidate.Vertex0.x;
+        float sy = origin.y - candidate.Vertex0.y;
+        float sz = origin.z - candidate.Vertex0.z;
+        float u = (sx * px + sy * py + sz * pz) * inverseDeterminant;
+        if (u < 0.0f || u > 1.0f)
+        {
+            return;
+        }
+
+        // q = s x e1
+        float qx = sy * e1.z - sz * e1.y;
+        float qy = sz * e1.x - sx * e1.z;
+        float qz = sx * e1.y - sy * e1.x;
+        float v = (direction.x * qx + direction.y * qy + direction.z * qz) * inverseDeterminant;
+        if (v < 0.0f || u + v > 1.0f)
+        {
+            return;
+        }
+
+        float distance = (e2.x * qx + e2.y * qy + e2.z * qz) * inverseDeterminant;
+        if (distance >= 0.0f && distance < itemClosest)
+        {
+            itemClosest = distance;
+            triangle = static_cast<int>(item);
+            hit = true;
+        }
+    });
+    return hit;
+}
+
+uint64_t TriangleBvh::GetMemoryUsage() const
+{
+    return bvh.GetMemoryUsage() + triangles.capacity() * sizeof(Triangle);
+}
@@ -0,0 +1,199 @@
+#pragma once
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <directxmath.h>
+#include <utility>
+#include <vector>
+
+using namespace DirectX;
+
+// 레이 교차 결과 (피킹)
+struct RayHit
+{
+    float Distance = FLT_MAX; // 레이 시작점부터 교차점까지의 레이 매개변수 (찾기 전에는 최대 거리)
+    int Node = -1;            // GLB 노드 (OBJ는 -1)
+    int Mesh = -1;            // 메시 (OBJ는 재질 그룹)
+    int Primitive = -1;       // 메시 안의 프리미티브 (OBJ는 0)
+    int Triangle = -1;        // 프리미티브 인덱스 버퍼의 삼각형 번호
+};
+
+// 축 정렬 박스 목록 위의 BVH
+// 항목 박스의 중심을 축마다 구간(bin)으로 나눠 SAH 비용이 가장 작은 위치에서 분할한다
+// 항목 자체는 옮기지 않고 항목 번호만 정렬하므로 삼각형과 모델 인스턴스에 모두 사용
+class PickingBvh
+{
+public:
+    struct Bounds
+    {
+        XMFLOAT3 Min;
+        XMFLOAT3 Max;
+    };
+
+    // 32바이트 노드 - 자식 두 개는 항상 나란히 저장
+    struct Node
+    {
+        XMFLOAT3 Min;
+        uint32_t First; // 내부 노드는 왼쪽 자식 (오른쪽은 First + 1), 잎 노드는 항목 번호 배열의 시작 위치
+        XMFLOAT3 Max;
+        uint32_t Count; // 잎 노드의 항목 수 (0이면 내부 노드)
+    };
+
+    // 빈 박스 (교차하지 않음) - 숨긴 인스턴스처럼 트리에는 남기고 검사에서 빼야 하는 항목에 사용
+    static Bounds EmptyBounds() { return { XMFLOAT3(FLT_MAX, FLT_MAX, FLT_MAX), XMFLOAT3(-FLT_MAX, -FLT_MAX, -FLT_MAX) }; }
+
+    // 항목 박스로 트리 생성
+    void Build(const std::vector<Bounds>& itemBounds, uint32_t maxLeafSize = 4);
+
+    // 트리 모양은 그대로 두고 노드 박스만 아래에서 위로 다시 계산 (항목 수가 같을 때만 사용)
+    void Refit(const std::vector<Bounds>& itemBounds);
+
+    void Clear();
+    bool IsEmpty() const { return nodes.empty(); }
+    size_t GetNodeCount() const { return nodes.size(); }
+    size_t GetItemCount() const { return items.size(); }
+    uint64_t GetMemoryUsage() const;
+
+    // 레이가 지나가는 잎의 항목을 가까운 노드부터 방문
+    // testItem(item, closest)는 항목과 교차하면 closest를 줄이고, closest보다 먼 노드는 건너뜀
+    template <typename TestItem>
+    void Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, float& closest, TestItem&& testItem) const;
+
+    // 레이가 박스에 들어가는 거리 (closest 안에서 교차하지 않으면 FLT_MAX)
+    static float IntersectBounds(const XMFLOAT3& boxMin, const XMFLOAT3& boxMax,
+        const XMFLOAT3& origin, const XMFLOAT3& inverseDirection, float closest);
+
+    // 트리 깊이 제한 (검사 스택 크기) - 넘으면 잎으로 만듦
+    static const uint32_t MaxDepth = 48;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<uint32_t> items;
+};
+
+// 메시 삼각형 BVH - 가져올 때 한 번 만들고 메시 로컬 공간의 레이로 가장 가까운 삼각형을 찾음
+class TriangleBvh
+{
+public:
+    // Position 멤버가 있는 버텍스 배열과 삼각형 목록 인덱스로 생성
+    template <typename Vertex>
+    void Build(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+    {
+        Build(vertices.empty() ? nullptr : &vertices[0].Position, sizeof(Vertex), vertices.size(),
+            indices.data(), indices.size());
+    }
+
+    void Build(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices, size_t indexCount);
+
+    // 변형된 정점(스키닝 등)으로 삼각형을 다시 채우고 트리 모양은 그대로 둔 채 노드 박스만 갱신 (인덱스는 Build와 같아야 함)
+    template <typename Vertex>
+    void Refit(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+    {
+        Refit(vertices.empty() ? nullptr : &vertices[0].Position, sizeof(Vertex), vertices.size(),
+            indices.data(), indices.size());
+    }
+
+    void Refit(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices, size_t indexCount);
+    void Clear();
+
+    // closest보다 가까운 교차가 있으면 closest와 triangle을 갱신하고 true (양면 검사)
+    // direction은 정규화하지 않아도 됨 - 월드 레이를 역변환한 레이를 그대로 넘기면 closest는 월드 레이의 매개변수
+    bool Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, float& closest, int& triangle) const;
+
+    bool IsEmpty() const { return bvh.IsEmpty(); }
+    size_t GetTriangleCount() const { return triangles.size(); }
+    uint64_t GetMemoryUsage() const;
+
+private:
+    // Moller-Trumbore 검사에 바로 쓰는 형태 (원본 삼각형 순서)
+    struct Triangle
+    {
+        XMFLOAT3 Vertex0;
+        XMFLOAT3 Edge1;
+        XMFLOAT3 Edge2;
+    };
+
+    // 정점 위치로 삼각형과 삼각형 박스 채우기 (범위를 벗어난 인덱스의 삼각형은 빈 박스)
+    void UpdateTriangles(const XMFLOAT3* positions, size_t stride, size_t vertexCount, const uint32_t* indices,
+        size_t indexCount, std::vector<PickingBvh::Bounds>& triangleBounds);
+
+    PickingBvh bvh;
+    std::vector<Triangle> triangles;
+};
+
+template <typename TestItem>
+void PickingBvh::Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction, float& closest, TestItem&& testItem) const
+{
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    // 축과 평행한 레이도 슬랩 검사가 NaN 없이 동작하도록 0 성분을 아주 작은 값으로 바꿈
+    auto inverse = [](float value) { return 1.0f / (std::fabs(value) > 1e-20f ? value : std::copysign(1e-20f, value)); };
+    XMFLOAT3 inverseDirection(inverse(direction.x), inverse(direction.y), inverse(direction.z));
+
+    if (IntersectBounds(nodes[0].Min, nodes[0].Max, origin, inverseDirection, closest) == FLT_MAX)
+    {
+        return;
+    }
+
+    // 나중에 볼 노드와 들어가는 거리 (closest가 줄어들면 꺼낼 때 건너뜀)
+    uint32_t stackNodes[MaxDepth + 1];
+    float stackDistances[MaxDepth + 1];
+    size_t stackSize = 0;
+    uint32_t current = 0;
+
+    for (;;)
+    {
+        const Node& node = nodes[current];
+        if (node.Count > 0)
+        {
+            for (uint32_t i = node.First; i < node.First + node.Count; i++)
+            {
+                testItem(items[i], closest);
+            }
+        }
+        else
+        {
+            uint32_t nearChild = node.First;
+            uint32_t farChild = node.First + 1;
+            float nearDistance = IntersectBounds(nodes[nearChild].Min, nodes[nearChild].Max, origin, inverseDirection, closest);
+            float farDistance = IntersectBounds(nodes[farChild].Min, nodes[farChild].Max, origin, inverseDirection, closest);
+            if (farDistance < nearDistance)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(nearDistance, farDistance);
+            }
+
+            if (nearDistance != FLT_MAX)
+            {
+                if (farDistance != FLT_MAX)
+                {
+                    stackNodes[stackSize] = farChild;
+                    stackDistances[stackSize] = farDistance;
+                    stackSize++;
+                }
+                current = nearChild;
+                continue;
+            }
+        }
+
+        // 아직 closest보다 가까운 노드만 꺼냄
+        bool found = false;
+        while (stackSize > 0)
+        {
+            stackSize--;
+            if (stackDistances[stackSize] < closest)
+            {
+                current = stackNodes[stackSize];
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            return;
+        }
+    }
+}
@@ -758,12 +758,7 @@ void RoomModel::Render(ID3D11DeviceContext* deviceContext, const Camera& camera,
     deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
     deviceContext->PSSetConstantBuffers(0, 1, &constantBuffer);
 
-    // 조명 정보 설정 (lightManager가 있는 경우)
-    if (lightManager)
-    {
-        lightManager->UpdateLightBuffer(deviceContext);
-        lightManager->SetLightBuffer(deviceContext);
-    }
+    // 조명 상수 버퍼는 ModelManager가 프레임마다 한 번 올리고 바인딩
 
     // 버텍스 및 인덱스 버퍼 설정
     UINT stride = sizeof(Vertex);
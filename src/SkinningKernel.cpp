@@ -0,0 +1,114 @@
+#include "SkinningKernel.h"
+#include "Avx2Kernels.h"
+#include "CpuFeatures.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // 길이가 0이 아니면 정규화해서 기록
+    inline void StoreNormalized3(unsigned char* destination, float x, float y, float z)
+    {
+        float length = std::sqrt(x * x + y * y + z * z);
+        if (length > 0.0f)
+        {
+            x /= length;
+            y /= length;
+            z /= length;
+        }
+
+        float values[3] = { x, y, z };
+        memcpy(destination, values, sizeof(values));
+    }
+}
+
+void SkinningKernel::MakeJointMatrix(FXMMATRIX transform, JointMatrix& joint)
+{
+    XMFLOAT4X4 rows;
+    XMStoreFloat4x4(&rows, transform);
+    memcpy(joint.Rows, rows.m, sizeof(joint.Rows));
+}
+
+void SkinningKernel::Skin(const JointMatrix* palette, uint32_t jointCount, const Layout& layout,
+    const void* source, void* destination, size_t begin, size_t end)
+{
+    // AVX2를 지원하는 CPU면 따로 컴파일한 커널 사용
+    if (CpuFeatures::HasAvx2())
+    {
+        Avx2Kernels::Skin(palette, jointCount, layout, source, destination, begin, end);
+        return;
+    }
+
+    const unsigned char* sourceBytes = static_cast<const unsigned char*>(source);
+    unsigned char* destinationBytes = static_cast<unsigned char*>(destination);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const unsigned char* input = sourceBytes + i * layout.Stride;
+        unsigned char* output = destinationBytes + i * layout.Stride;
+
+        // 텍스처 좌표 등 변환하지 않는 속성은 그대로 복사
+        memcpy(output, input, layout.Stride);
+        if (jointCount == 0)
+        {
+            continue;
+        }
+
+        float weights[4];
+        uint32_t joints[4];
+        float position[3];
+        float normal[3];
+        float tangent[4];
+        memcpy(weights, input + layout.Weights, sizeof(weights));
+        memcpy(joints, input + layout.Joints, sizeof(joints));
+        memcpy(position, input + layout.Position, sizeof(position));
+        memcpy(normal, input + layout.Normal, sizeof(normal));
+        memcpy(tangent, input + layout.Tangent, sizeof(tangent));
+
+        // 조인트 행렬 섞기
+        XMMATRIX blended;
+        blended.r[0] = XMVectorZero();
+        blended.r[1] = XMVectorZero();
+        blended.r[2] = XMVectorZero();
+        blended.r[3] = XMVectorZero();
+        float totalWeight = 0.0f;
+        for (int k = 0; k < 4; k++)
+        {
+            if (weights[k] == 0.0f || joints[k] >= jointCount)
+            {
+                continue;
+            }
+
+            const JointMatrix& joint = palette[joints[k]];
+            XMVECTOR weight = XMVectorReplicate(weights[k]);
+            for (int row = 0; row < 4; row++)
+            {
+                blended.r[row] = XMVectorMultiplyAdd(weight,
+                    XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(joint.Rows[row])), blended.r[row]);
+            }
+            totalWeight += weights[k];
+        }
+
+        // 영향을 주는 조인트가 없으면 바인드 포즈 유지
+        if (totalWeight == 0.0f)
+        {
+            continue;
+        }
+
+        XMFLOAT3 skinnedPosition;
+        XMFLOAT3 skinnedNormal;
+        XMFLOAT3 skinnedTangent;
+        XMStoreFloat3(&skinnedPosition, XMVector3Transform(XMVectorSet(position[0], position[1], position[2], 1.0f), blended));
+        XMStoreFloat3(&skinnedNormal, XMVector3TransformNormal(XMVectorSet(normal[0], normal[1], normal[2], 0.0f), blended));
+        XMStoreFloat3(&skinnedTangent, XMVector3TransformNormal(XMVectorSet(tangent[0], tangent[1], tangent[2], 0.0f), blended));
+
+        memcpy(output + layout.Position, &skinnedPosition, sizeof(float) * 3);
+        StoreNormalized3(output + layout.Normal, skinnedNormal.x, skinnedNormal.y, skinnedNormal.z);
+        StoreNormalized3(output + layout.Tangent, skinnedTangent.x, skinnedTangent.y, skinnedTangent.z);
+    }
+}
+
+const char* SkinningKernel::GetInstructionSetName()
+{
+    return CpuFeatures::GetInstructionSetName();
+}
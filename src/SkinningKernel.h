@@ -0,0 +1,41 @@
+#pragma once
+#include <directxmath.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace DirectX;
+
+// CPU 정점 스키닝 커널 (디바이스 없이 동작)
+// 정점마다 최대 4개 조인트 행렬을 가중치로 섞은 뒤 위치/노멀/탄젠트를 변환한다
+// CPU가 AVX2를 지원하면 행렬 하나를 256비트 레지스터 두 개로 섞고 (Avx2Kernels), 아니면 DirectXMath(SSE2)를 사용한다
+class SkinningKernel
+{
+public:
+    // 조인트 행렬 (행 우선, 행 4개 - 마지막 행은 이동) - AVX2에서 256비트 두 번으로 읽도록 32바이트 정렬
+    struct alignas(32) JointMatrix
+    {
+        float Rows[4][4];
+    };
+
+    // 정점 레이아웃 (바이트 단위 오프셋) - 입력과 출력은 같은 레이아웃
+    // Position/Normal은 float3, Tangent/Weights는 float4, Joints는 uint4
+    struct Layout
+    {
+        size_t Stride = 0;
+        size_t Position = 0;
+        size_t Normal = 0;
+        size_t Tangent = 0;
+        size_t Weights = 0;
+        size_t Joints = 0;
+    };
+
+    static void MakeJointMatrix(FXMMATRIX transform, JointMatrix& joint);
+
+    // [begin, end) 범위 정점을 source에서 destination으로 복사하면서 스키닝
+    // 범위를 벗어난 조인트 인덱스는 무시 (여러 스레드가 서로 다른 범위를 동시에 처리해도 됨)
+    static void Skin(const JointMatrix* palette, uint32_t jointCount, const Layout& layout,
+        const void* source, void* destination, size_t begin, size_t end);
+
+    // 실행 중에 선택된 커널 종류 (로그용)
+    static const char* GetInstructionSetName();
+};
@@ -0,0 +1,165 @@
+#include "TaskGraph.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+TaskGraph::TaskId TaskGraph::Add(const std::string& name, std::function<void()> work, const std::vector<TaskId>& dependencies)
+{
+    TaskId id = tasks.size();
+    Task task;
+    task.Work = std::move(work);
+    for (TaskId dependency : dependencies)
+    {
+        // 아직 추가되지 않은 작업은 순환을 만들 수 있으므로 무시
+        if (dependency < id)
+        {
+            tasks[dependency].Dependents.push_back(id);
+            task.DependencyCount++;
+        }
+    }
+    tasks.push_back(std::move(task));
+
+    Timing timing;
+    timing.Name = name;
+    timings.push_back(timing);
+    return id;
+}
+
+struct TaskGraph::RunState
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<TaskId> ready;
+    std::vector<size_t> remaining;
+    size_t done = 0;
+    size_t count = 0;
+    std::vector<Task>* tasks = nullptr;
+    std::vector<Timing>* timings = nullptr;
+    std::chrono::high_resolution_clock::time_point start;
+    std::exception_ptr exception; // 처음 발생한 예외 (mutex로 보호)
+};
+
+bool TaskGraph::RunReadyTask(const std::shared_ptr<RunState>& state, ThreadPool& pool)
+{
+    TaskId id;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->ready.empty())
+        {
+            return false;
+        }
+        id = state->ready.front();
+        state->ready.pop_front();
+    }
+
+    // 예외가 나도 끝난 것으로 세야 Run의 대기가 풀림 (예외는 Run이 모두 끝난 뒤 호출 스레드에서 다시 던짐)
+    std::exception_ptr exception;
+    auto taskStart = std::chrono::high_resolution_clock::now();
+    try
+    {
+        (*state->tasks)[id].Work();
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+    auto taskEnd = std::chrono::high_resolution_clock::now();
+
+    Timing& timing = (*state->timings)[id];
+    timing.StartMilliseconds = std::chrono::duration<double, std::milli>(taskStart - state->start).count();
+    timing.Milliseconds = std::chrono::duration<double, std::milli>(taskEnd - taskStart).count();
+    timing.Worker = static_cast<unsigned int>(pool.GetCurrentWorkerIndex() + 1);
+
+    // 후속 작업 중 선행 작업이 모두 끝난 것을 준비 목록에 넣고 작업마다 풀 작업 하나씩 제출
+    size_t readyCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (exception && !state->exception)
+        {
+            state->exception = exception;
+        }
+        for (TaskId dependent : (*state->tasks)[id].Dependents)
+        {
+            if (--state->remaining[dependent] == 0)
+            {
+                state->ready.push_back(dependent);
+                readyCount++;
+            }
+        }
+        state->done++;
+        if (readyCount > 0 || state->done == state->count)
+        {
+            state->condition.notify_all();
+        }
+    }
+
+    for (size_t i = 0; i < readyCount; i++)
+    {
+        pool.Submit([state, &pool]() { RunReadyTask(state, pool); }, ThreadPool::Priority::High);
+    }
+    return true;
+}
+
+void TaskGraph::Run(ThreadPool& pool)
+{
+    auto runStart = std::chrono::high_resolution_clock::now();
+    if (tasks.empty())
+    {
+        totalMilliseconds = 0.0;
+        return;
+    }
+
+    auto state = std::make_shared<RunState>();
+    state->count = tasks.size();
+    state->tasks = &tasks;
+    state->timings = &timings;
+    state->start = runStart;
+    state->remaining.resize(tasks.size());
+    for (TaskId id = 0; id < tasks.size(); id++)
+    {
+        state->remaining[id] = tasks[id].DependencyCount;
+        if (tasks[id].DependencyCount == 0)
+        {
+            state->ready.push_back(id);
+        }
+    }
+
+    // 처음부터 준비된 작업 중 하나는 호출 스레드가 바로 가져가므로 나머지만 제출
+    size_t initialCount = state->ready.size();
+    for (size_t i = 1; i < initialCount; i++)
+    {
+        pool.Submit([state, &pool]() { RunReadyTask(state, pool); }, ThreadPool::Priority::High);
+    }
+
+    // 호출 스레드는 준비된 작업을 실행하다가 없으면 새 작업이 준비되거나 모두 끝날 때까지 대기
+    for (;;)
+    {
+        if (RunReadyTask(state, pool))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->condition.wait(lock, [&state]() { return !state->ready.empty() || state->done == state->count; });
+        if (state->done == state->count)
+        {
+            break;
+        }
+    }
+
+    totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - runStart).count();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+void TaskGraph::Clear()
+{
+    tasks.clear();
+    timings.clear();
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "ThreadPool.h"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 의존성이 있는 작업 그래프
+// 선행 작업이 모두 끝난 작업마다 공유 스레드 풀에 작업을 하나씩 제출하고 호출 스레드도 준비된 작업을 가져가 실행한다
+// 풀 작업은 준비된 작업이 없으면 기다리지 않고 바로 끝나므로 프레임 작업이 작업자를 붙잡아 두지 않는다
+// 매 프레임 Clear -> Add -> Run 순서로 다시 구성해서 사용 (작업 목록의 메모리는 재사용)
+class TaskGraph
+{
+public:
+    using TaskId = size_t;
+
+    // 작업 하나의 실행 기록 (시간은 Run 시작 기준, Worker는 풀 작업자 번호 + 1이고 0은 작업자가 아닌 스레드)
+    struct Timing
+    {
+        std::string Name;
+        double StartMilliseconds = 0.0;
+        double Milliseconds = 0.0;
+        unsigned int Worker = 0;
+    };
+
+    // 작업 추가 - dependencies의 작업이 모두 끝난 뒤 실행 (먼저 추가된 작업만 지정 가능)
+    TaskId Add(const std::string& name, std::function<void()> work, const std::vector<TaskId>& dependencies = {});
+
+    // 모든 작업을 실행하고 끝날 때까지 대기
+    // 작업이 예외를 던져도 나머지 작업(후속 작업 포함)은 모두 실행하고, 처음 발생한 예외를 호출 스레드에서 다시 던짐
+    void Run(ThreadPool& pool);
+
+    void Clear();
+
+    size_t GetTaskCount() const { return tasks.size(); }
+
+    // 마지막 Run의 작업별 기록과 전체 시간
+    const std::vector<Timing>& GetTimings() const { return timings; }
+    double GetTotalMilliseconds() const { return totalMilliseconds; }
+
+private:
+    struct Task
+    {
+        std::function<void()> Work;
+        std::vector<TaskId> Dependents;
+        size_t DependencyCount = 0;
+    };
+
+    // Run 하나의 공유 상태 (늦게 시작한 풀 작업이 Run이 끝난 뒤에 확인해도 안전하도록 힙에 둠)
+    struct RunState;
+
+    // 준비된 작업 하나를 꺼내 실행 - 꺼낼 작업이 없으면 false
+    static bool RunReadyTask(const std::shared_ptr<RunState>& state, ThreadPool& pool);
+
+    std::vector<Task> tasks;
+    std::vector<Timing> timings;
+    double totalMilliseconds = 0.0;
+};
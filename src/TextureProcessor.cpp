@@ -0,0 +1,253 @@
+#include "TextureProcessor.h"
+#include <DirectXTex.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+// 선언만 포함 (구현은 GltfLoader.cpp의 tinygltf 구현부에서 컴파일됨)
+#include "stb_image.h"
+
+namespace
+{
+    inline bool IsPowerOfTwo(size_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    inline double ElapsedMilliseconds(std::chrono::high_resolution_clock::time_point start,
+        std::chrono::high_resolution_clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+bool TextureProcessor::Process(const std::vector<uint8_t>& encoded, Role role, MeshCache* textureCache, Result& result)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    result = Result();
+
+    if (encoded.empty())
+    {
+        return false;
+    }
+
+    // 캐시 조회 - 같은 이미지를 같은 용도로 처리한 결과가 있으면 디코딩과 압축을 건너뜀
+    bool useCache = textureCache && textureCache->IsEnabled();
+    MeshCache::SourceKey key;
+    if (useCache)
+    {
+        key = MakeKey(encoded, role);
+
+        MappedFile cacheFile;
+        MeshCache::Reader reader;
+        if (textureCache->Lookup(key, AssetTexture, cacheFile, reader) && ReadCache(reader, result))
+        {
+            textureCache->RecordHit();
+            result.FromCache = true;
+            result.TotalMilliseconds = ElapsedMilliseconds(start, std::chrono::high_resolution_clock::now());
+            return true;
+        }
+
+        result = Result();
+        textureCache->RecordMiss();
+    }
+
+    if (!Encode(encoded, role, result))
+    {
+        return false;
+    }
+
+    if (useCache)
+    {
+        MeshCache::Writer writer;
+        WriteCache(result, writer);
+        textureCache->Store(key, AssetTexture, writer);
+    }
+
+    result.TotalMilliseconds = ElapsedMilliseconds(start, std::chrono::high_resolution_clock::now());
+    return true;
+}
+
+bool TextureProcessor::Encode(const std::vector<uint8_t>& encoded, Role role, Result& result)
+{
+    using namespace DirectX;
+
+    // PNG/JPEG 디코딩 (채널 수와 비트 수에 관계없이 8비트 RGBA로 변환)
+    auto decodeStart = std::chrono::high_resolution_clock::now();
+    int width = 0;
+    int height = 0;
+    int components = 0;
+    stbi_uc* pixels = stbi_load_from_memory(encoded.data(), static_cast<int>(encoded.size()),
+        &width, &height, &components, 4);
+    if (!pixels)
+    {
+        return false;
+    }
+
+    Image baseImage = {};
+    baseImage.width = static_cast<size_t>(width);
+    baseImage.height = static_cast<size_t>(height);
+    baseImage.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    baseImage.rowPitch = baseImage.width * 4;
+    baseImage.slicePitch = baseImage.rowPitch * baseImage.height;
+    baseImage.pixels = pixels;
+
+    auto mipStart = std::chrono::high_resolution_clock::now();
+    result.DecodeMilliseconds = ElapsedMilliseconds(decodeStart, mipStart);
+
+    // 밉 체인 생성 - 2의 거듭제곱 크기는 박스 필터, 그 외는 삼각 필터
+    // 색상 텍스처는 sRGB 값을 선형으로 바꿔서 평균을 낸 뒤 다시 sRGB로 저장 (밉이 어두워지지 않도록)
+    TEX_FILTER_FLAGS filter = IsPowerOfTwo(baseImage.width) && IsPowerOfTwo(baseImage.height) ?
+        TEX_FILTER_BOX : TEX_FILTER_TRIANGLE;
+    if (role == Role::Color)
+    {
+        filter |= TEX_FILTER_SRGB;
+    }
+
+    ScratchImage mipChain;
+    HRESULT hr = GenerateMipMaps(baseImage, filter, 0, mipChain);
+    if (FAILED(hr))
+    {
+        // 1x1 이미지처럼 밉을 만들 수 없으면 원본만 사용
+        hr = mipChain.InitializeFromImage(baseImage);
+    }
+    stbi_image_free(pixels);
+
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    auto compressStart = std::chrono::high_resolution_clock::now();
+    result.MipMilliseconds = ElapsedMilliseconds(mipStart, compressStart);
+
+    // 용도별 압축 포맷 선택 - BC 텍스처는 밉 0의 크기가 4의 배수여야 함
+    // 셰이더가 감마를 직접 처리하므로 뷰 포맷은 기존과 같이 UNORM을 유지
+    DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    TEX_COMPRESS_FLAGS compressFlags = TEX_COMPRESS_DEFAULT;
+    CMSE_FLAGS mseFlags = CMSE_DEFAULT;
+    if (baseImage.width % 4 == 0 && baseImage.height % 4 == 0)
+    {
+        switch (role)
+        {
+        case Role::Color:
+            format = mipChain.IsAlphaAllOpaque() ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_BC3_UNORM;
+            break;
+        case Role::Normal:
+            format = DXGI_FORMAT_BC5_UNORM;
+            compressFlags = TEX_COMPRESS_UNIFORM;
+            mseFlags = CMSE_IGNORE_BLUE | CMSE_IGNORE_ALPHA;
+            break;
+        case Role::Data:
+            format = DXGI_FORMAT_BC7_UNORM;
+            compressFlags = TEX_COMPRESS_UNIFORM | TEX_COMPRESS_BC7_QUICK;
+            break;
+        default:
+            break;
+        }
+    }
+
+    ScratchImage compressed;
+    const ScratchImage* output = &mipChain;
+    if (format != DXGI_FORMAT_R8G8B8A8_UNORM)
+    {
+        hr = Compress(mipChain.GetImages(), mipChain.GetImageCount(), mipChain.GetMetadata(),
+            format, compressFlags, TEX_THRESHOLD_DEFAULT, compressed);
+        if (SUCCEEDED(hr))
+        {
+            output = &compressed;
+
+            // 밉 0 기준 압축 품질 측정
+            float mse = 0.0f;
+            if (SUCCEEDED(ComputeMSE(*mipChain.GetImage(0, 0, 0), *compressed.GetImage(0, 0, 0), mse, nullptr, mseFlags)))
+            {
+                result.Psnr = mse > 0.0f ? static_cast<float>(10.0 * std::log10(1.0 / mse)) : 99.0f;
+            }
+        }
+        else
+        {
+            OutputDebugStringA(("Texture compression failed, using RGBA8 (hr = " + std::to_string(hr) + ")\n").c_str());
+        }
+    }
+
+    result.CompressMilliseconds = ElapsedMilliseconds(compressStart, std::chrono::high_resolution_clock::now());
+
+    // 업로드용 데이터 복사 (ScratchImage는 모든 밉을 연속된 메모리에 저장)
+    const TexMetadata& metadata = output->GetMetadata();
+    result.Format = metadata.format;
+    result.Width = static_cast<uint32_t>(metadata.width);
+    result.Height = static_cast<uint32_t>(metadata.height);
+    result.Pixels.assign(output->GetPixels(), output->GetPixels() + output->GetPixelsSize());
+    result.Levels.resize(metadata.mipLevels);
+    for (size_t level = 0; level < metadata.mipLevels; level++)
+    {
+        const Image* image = output->GetImage(level, 0, 0);
+        result.Levels[level].Offset = static_cast<uint64_t>(image->pixels - output->GetPixels());
+        result.Levels[level].RowPitch = static_cast<uint32_t>(image->rowPitch);
+        result.Levels[level].SlicePitch = static_cast<uint32_t>(image->slicePitch);
+    }
+
+    return true;
+}
+
+const char* TextureProcessor::GetFormatName(DXGI_FORMAT format)
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_BC1_UNORM: return "BC1";
+    case DXGI_FORMAT_BC3_UNORM: return "BC3";
+    case DXGI_FORMAT_BC5_UNORM: return "BC5";
+    case DXGI_FORMAT_BC7_UNORM: return "BC7";
+    case DXGI_FORMAT_R8G8B8A8_UNORM: return "RGBA8";
+    default: return "unknown";
+    }
+}
+
+MeshCache::SourceKey TextureProcessor::MakeKey(const std::vector<uint8_t>& encoded, Role role)
+{
+    // 경로 대신 내용 해시로 식별 - 여러 모델에 들어 있는 같은 이미지는 항목 하나를 공유
+    MeshCache::SourceKey key;
+    key.Size = encoded.size();
+    key.ContentHash = MeshCache::HashBytes(encoded.data(), encoded.size(), PipelineVersion);
+
+    char name[64];
+    snprintf(name, sizeof(name), "texture:%016llx:%u:%u", static_cast<unsigned long long>(key.ContentHash),
+        static_cast<unsigned int>(role), PipelineVersion);
+    key.CanonicalPath = name;
+    return key;
+}
+
+void TextureProcessor::WriteCache(const Result& result, MeshCache::Writer& writer)
+{
+    writer.Write(static_cast<uint32_t>(result.Format));
+    writer.Write(result.Width);
+    writer.Write(result.Height);
+    writer.Write(result.Psnr);
+    writer.WriteVector(result.Levels);
+    writer.WriteVector(result.Pixels);
+}
+
+bool TextureProcessor::ReadCache(MeshCache::Reader& reader, Result& result)
+{
+    uint32_t format = 0;
+    if (!reader.Read(format) || !reader.Read(result.Width) || !reader.Read(result.Height) ||
+        !reader.Read(result.Psnr) || !reader.ReadVector(result.Levels) || !reader.ReadVector(result.Pixels))
+    {
+        return false;
+    }
+    result.Format = static_cast<DXGI_FORMAT>(format);
+
+    // 밉 레벨이 픽셀 데이터 범위 안에 있는지 확인
+    if (result.Levels.empty() || result.Width == 0 || result.Height == 0)
+    {
+        return false;
+    }
+    for (const auto& level : result.Levels)
+    {
+        if (level.Offset > result.Pixels.size() || level.SlicePitch > result.Pixels.size() - level.Offset)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
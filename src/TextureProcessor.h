@@ -0,0 +1,71 @@
+#pragma once
+#include <dxgiformat.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MeshCache.h"
+
+// 가져온 텍스처의 CPU 처리 파이프라인 (디바이스 없이 동작)
+// PNG/JPEG 디코딩 -> 밉맵 생성 -> 용도별 BC 압축 순서로 처리하고
+// 결과는 인코딩된 원본의 내용 해시로 디스크 캐시에 저장한다
+class TextureProcessor
+{
+public:
+    // 파이프라인 버전 - 밉 필터나 압축 설정이 바뀌면 올려서 이전 캐시를 무효화
+    static const uint32_t PipelineVersion = 1;
+
+    // 캐시 에셋 종류 태그
+    static const uint32_t AssetTexture = 0x20584554; // "TEX "
+
+    // 텍스처 용도 - 색 공간과 압축 포맷 결정에 사용
+    enum class Role : uint32_t
+    {
+        Unused = 0,        // 재질에서 쓰지 않음 (RGBA8 + 밉)
+        Color,             // 베이스 컬러, 이미시브 (sRGB) - 불투명 BC1, 알파 BC3
+        Normal,            // 노멀 맵 - BC5 (XY만 저장, Z는 셰이더에서 복원)
+        Data               // 메탈릭-러프니스, 오클루전 (선형) - BC7
+    };
+
+    // 밉 레벨 하나 (Pixels 안의 위치)
+    struct Level
+    {
+        uint64_t Offset = 0;
+        uint32_t RowPitch = 0;
+        uint32_t SlicePitch = 0;
+    };
+
+    // 처리 결과 - GPU 업로드에 필요한 데이터와 측정값
+    struct Result
+    {
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<Level> Levels;
+        std::vector<uint8_t> Pixels;
+
+        // 압축 품질 (밉 0 기준 PSNR, dB) - 압축하지 않았으면 0
+        float Psnr = 0.0f;
+
+        // 단계별 시간 (캐시 적중이면 조회 시간만 기록)
+        bool FromCache = false;
+        double DecodeMilliseconds = 0.0;
+        double MipMilliseconds = 0.0;
+        double CompressMilliseconds = 0.0;
+        double TotalMilliseconds = 0.0;
+
+        bool IsValid() const { return !Levels.empty(); }
+    };
+
+    // 인코딩된 이미지 처리 - textureCache가 있으면 캐시를 먼저 조회하고 결과를 저장
+    // 여러 스레드에서 동시에 호출해도 됨
+    static bool Process(const std::vector<uint8_t>& encoded, Role role, MeshCache* textureCache, Result& result);
+
+    // 용도별 압축 포맷 이름 (로그용)
+    static const char* GetFormatName(DXGI_FORMAT format);
+
+private:
+    static bool Encode(const std::vector<uint8_t>& encoded, Role role, Result& result);
+    static MeshCache::SourceKey MakeKey(const std::vector<uint8_t>& encoded, Role role);
+    static void WriteCache(const Result& result, MeshCache::Writer& writer);
+    static bool ReadCache(MeshCache::Reader& reader, Result& result);
+};
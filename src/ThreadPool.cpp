@@ -0,0 +1,286 @@
+#include "ThreadPool.h"
+#include <windows.h>
+#include <algorithm>
+#include <string>
+
+namespace
+{
+    // 현재 스레드가 작업자인 풀과 작업자 번호 (작업자가 제출한 작업은 자기 대기열에 넣음)
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local size_t currentWorker = 0;
+}
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    if (threadCount == 0)
+    {
+        unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    // 작업자가 시작하자마자 다른 대기열을 훔쳐볼 수 있으므로 대기열을 먼저 모두 만듦
+    workerQueues.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        workerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    lastSampleTime = std::chrono::steady_clock::now();
+    workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+ThreadPool& ThreadPool::GetShared()
+{
+    static ThreadPool sharedPool;
+    return sharedPool;
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // 작업자가 늦게 시작해도 안전하도록 공유 상태는 힙에 둠
+    struct State
+    {
+        std::atomic<size_t> next{ 0 };
+        std::atomic<size_t> done{ 0 };
+        size_t count = 0;
+        std::function<void(size_t)> body;
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+        std::exception_ptr exception; // 처음 발생한 예외 (doneMutex로 보호)
+    };
+
+    auto state = std::make_shared<State>();
+    state->count = count;
+    state->body = body;
+
+    auto run = [state]()
+    {
+        size_t completed = 0;
+        for (size_t i = state->next++; i < state->count; i = state->next++)
+        {
+            // 예외가 나도 끝난 것으로 세야 호출 스레드의 대기가 풀림 (예외는 호출 스레드에서 다시 던짐)
+            try
+            {
+                state->body(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(state->doneMutex);
+                if (!state->exception)
+                {
+                    state->exception = std::current_exception();
+                }
+            }
+            completed++;
+        }
+
+        if (completed > 0 && state->done.fetch_add(completed) + completed == state->count)
+        {
+            std::lock_guard<std::mutex> lock(state->doneMutex);
+            state->doneCondition.notify_all();
+        }
+    };
+
+    // 호출 스레드가 기다리는 작업이므로 높은 우선순위로 제출
+    size_t helperCount = (std::min)(count - 1, workers.size());
+    for (size_t i = 0; i < helperCount; i++)
+    {
+        Enqueue(run, Priority::High, CancellationToken());
+    }
+
+    run();
+
+    std::unique_lock<std::mutex> lock(state->doneMutex);
+    state->doneCondition.wait(lock, [&state]() { return state->done == state->count; });
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+int ThreadPool::GetCurrentWorkerIndex() const
+{
+    return currentPool == this ? static_cast<int>(currentWorker) : -1;
+}
+
+ThreadPool::Stats ThreadPool::GetStats()
+{
+    Stats stats;
+    stats.ThreadCount = GetThreadCount();
+
+    auto countQueue = [&stats](WorkerQueue& queue)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (size_t priority = 0; priority < static_cast<size_t>(Priority::Count); priority++)
+        {
+            stats.QueueDepth[priority] += queue.jobs[priority].size();
+        }
+    };
+    countQueue(sharedQueue);
+    for (auto& queue : workerQueues)
+    {
+        countQueue(*queue);
+    }
+
+    stats.ActiveWorkers = activeWorkers;
+    stats.Executed = executedJobs;
+    stats.Stolen = stolenJobs;
+    stats.Cancelled = cancelledJobs;
+
+    // 이전 호출 이후 작업자 전체가 일할 수 있었던 시간 중 실제로 일한 비율
+    std::lock_guard<std::mutex> lock(statsMutex);
+    auto now = std::chrono::steady_clock::now();
+    uint64_t busy = busyMicroseconds;
+    double elapsed = std::chrono::duration<double, std::micro>(now - lastSampleTime).count() * workers.size();
+    if (elapsed > 0.0)
+    {
+        stats.Utilization = (std::min)(1.0, static_cast<double>(busy - lastBusyMicroseconds) / elapsed);
+    }
+    lastSampleTime = now;
+    lastBusyMicroseconds = busy;
+
+    return stats;
+}
+
+void ThreadPool::Enqueue(std::function<void()> work, Priority priority, const CancellationToken& token)
+{
+    WorkerQueue& queue = currentPool == this ? *workerQueues[currentWorker] : sharedQueue;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs[static_cast<size_t>(priority)].push_back({ std::move(work), token });
+        pendingJobs++;
+    }
+
+    // 작업자가 대기 조건을 확인한 뒤 잠들기 전에 깨우는 신호를 놓치지 않도록 잠금을 거쳐서 알림
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCondition.notify_one();
+}
+
+bool ThreadPool::TryTakeJob(size_t workerIndex, Job& job)
+{
+    auto take = [this, &job](WorkerQueue& queue, size_t priority, bool newest)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        auto& jobs = queue.jobs[priority];
+        if (jobs.empty())
+        {
+            return false;
+        }
+
+        if (newest)
+        {
+            job = std::move(jobs.back());
+            jobs.pop_back();
+        }
+        else
+        {
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        pendingJobs--;
+        return true;
+    };
+
+    // 우선순위마다 자기 대기열(가장 최근 작업) -> 공용 대기열 -> 다른 작업자 대기열(가장 오래된 작업) 순서로 확인
+    for (size_t priority = 0; priority < static_cast<size_t>(Priority::Count); priority++)
+    {
+        if (take(*workerQueues[workerIndex], priority, true) || take(sharedQueue, priority, false))
+        {
+            return true;
+        }
+
+        for (size_t offset = 1; offset < workerQueues.size(); offset++)
+        {
+            if (take(*workerQueues[(workerIndex + offset) % workerQueues.size()], priority, false))
+            {
+                stolenJobs++;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::RunJob(Job& job)
+{
+    // 시작 전에 취소된 작업은 버림 (packaged_task가 소멸되면서 future에 broken_promise 전달)
+    if (job.Token.IsCancelled())
+    {
+        cancelledJobs++;
+        job.Work = nullptr;
+        return;
+    }
+
+    activeWorkers++;
+    auto start = std::chrono::steady_clock::now();
+    // Submit의 작업은 packaged_task가 예외를 future로 넘기지만, 직접 넣은 작업의 예외가 작업자 스레드를 끝내지 않도록 여기서 막음
+    try
+    {
+        job.Work();
+    }
+    catch (std::exception& e)
+    {
+        OutputDebugStringA(("스레드 풀 작업 예외: " + std::string(e.what()) + "\n").c_str());
+    }
+    catch (...)
+    {
+        OutputDebugStringA("스레드 풀 작업: 알 수 없는 예외 발생\n");
+    }
+    job.Work = nullptr;
+    busyMicroseconds += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    activeWorkers--;
+    executedJobs++;
+}
+
+void ThreadPool::WorkerLoop(size_t workerIndex)
+{
+    currentPool = this;
+    currentWorker = workerIndex;
+
+    for (;;)
+    {
+        Job job;
+        if (TryTakeJob(workerIndex, job))
+        {
+            RunJob(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() { return stopping || pendingJobs > 0; });
+        if (stopping && pendingJobs == 0)
+        {
+            return;
+        }
+    }
+}
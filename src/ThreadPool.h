@@ -0,0 +1,152 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 고정 크기 작업 훔치기(work-stealing) 스레드 풀
+// 로딩 중인 모든 모델의 작업(파일 로드, 메시 처리, 텍스처 디코딩)과 프레임 작업이 같은 작업자를 나눠 쓴다
+// 작업자 스레드에서 제출한 작업은 그 작업자의 대기열에, 외부에서 제출한 작업은 공용 대기열에 들어가고
+// 할 일이 없는 작업자는 다른 작업자의 대기열에서 작업을 가져온다
+// 우선순위가 높은 작업부터 꺼내며, 시작 전에 취소된 작업은 실행하지 않고 버린다 (future는 broken_promise 예외)
+class ThreadPool
+{
+public:
+    // 작업 우선순위 (숫자가 작을수록 먼저 실행)
+    enum class Priority : uint32_t
+    {
+        High = 0,   // 다른 작업이 기다리는 작업 (ParallelFor 도우미, 프레임 작업)
+        Normal,     // 모델 로드
+        Low,        // 당장 필요하지 않은 백그라운드 작업
+        Count
+    };
+
+    // 취소 토큰 - 복사본끼리 같은 상태를 공유 (기본 생성한 토큰은 취소할 수 없음)
+    class CancellationToken
+    {
+    public:
+        static CancellationToken Create()
+        {
+            CancellationToken token;
+            token.cancelled = std::make_shared<std::atomic<bool>>(false);
+            return token;
+        }
+
+        void Cancel() const
+        {
+            if (cancelled)
+            {
+                *cancelled = true;
+            }
+        }
+
+        bool IsCancelled() const { return cancelled && *cancelled; }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled;
+    };
+
+    // 진단 정보
+    struct Stats
+    {
+        unsigned int ThreadCount = 0;
+        size_t QueueDepth[static_cast<size_t>(Priority::Count)] = {}; // 우선순위별 대기 중인 작업 수
+        size_t ActiveWorkers = 0;        // 지금 작업을 실행 중인 작업자 수
+        uint64_t Executed = 0;           // 실행한 작업 수 (누적)
+        uint64_t Stolen = 0;             // 다른 작업자의 대기열에서 가져온 작업 수 (누적)
+        uint64_t Cancelled = 0;          // 취소되어 버린 작업 수 (누적)
+        double Utilization = 0.0;        // 이전 GetStats 호출 이후 작업자가 일한 시간 비율 (0 ~ 1)
+
+        size_t GetQueueDepth() const
+        {
+            size_t total = 0;
+            for (size_t depth : QueueDepth)
+            {
+                total += depth;
+            }
+            return total;
+        }
+    };
+
+    // threadCount가 0이면 하드웨어 스레드 수 - 1 (호출 스레드도 ParallelFor에 참여)
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 프로세스 전체에서 공유하는 풀
+    static ThreadPool& GetShared();
+
+    // 작업 제출 - 결과는 future로 받음
+    // token이 시작 전에 취소되면 작업을 실행하지 않음 (실행 중인 작업은 token을 직접 확인해서 중단)
+    template <typename Task>
+    auto Submit(Task&& task, Priority priority = Priority::Normal, const CancellationToken& token = CancellationToken())
+        -> std::future<decltype(task())>
+    {
+        using Result = decltype(task());
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        std::future<Result> future = packaged->get_future();
+        Enqueue([packaged]() { (*packaged)(); }, priority, token);
+        return future;
+    }
+
+    // [0, count) 범위를 작업자와 호출 스레드가 나눠서 처리하고 모두 끝날 때까지 대기
+    // 호출 스레드도 일을 가져가므로 작업자 스레드 안에서 호출해도 교착되지 않음
+    // body가 예외를 던져도 나머지 항목은 모두 처리하고, 처음 발생한 예외를 호출 스레드에서 다시 던짐
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    unsigned int GetThreadCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    // 현재 스레드가 이 풀의 작업자면 작업자 번호, 아니면 -1
+    int GetCurrentWorkerIndex() const;
+
+    Stats GetStats();
+
+private:
+    struct Job
+    {
+        std::function<void()> Work;
+        CancellationToken Token;
+    };
+
+    // 작업자별 대기열 (우선순위마다 하나)
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs[static_cast<size_t>(Priority::Count)];
+    };
+
+    void Enqueue(std::function<void()> work, Priority priority, const CancellationToken& token);
+    bool TryTakeJob(size_t workerIndex, Job& job);
+    void RunJob(Job& job);
+    void WorkerLoop(size_t workerIndex);
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkerQueue>> workerQueues;
+    WorkerQueue sharedQueue; // 작업자가 아닌 스레드에서 제출한 작업
+
+    // 대기 중인 작업이 없을 때 작업자가 잠드는 곳
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::atomic<size_t> pendingJobs{ 0 };
+    bool stopping = false;
+
+    // 통계
+    std::atomic<size_t> activeWorkers{ 0 };
+    std::atomic<uint64_t> executedJobs{ 0 };
+    std::atomic<uint64_t> stolenJobs{ 0 };
+    std::atomic<uint64_t> cancelledJobs{ 0 };
+    std::atomic<uint64_t> busyMicroseconds{ 0 };
+    std::mutex statsMutex;
+    std::chrono::steady_clock::time_point lastSampleTime;
+    uint64_t lastBusyMicroseconds = 0;
+};